@@ -0,0 +1,845 @@
+/**
+ * libstring — String manipulation library
+ * 
+ * Copyright © 2015  Mattias Andrée (m@maandree.se)
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Generates unicode-tables.h from the Unicode Character Database:
+ * 
+ *   gen-unicode-tables UnicodeData.txt EastAsianWidth.txt emoji-data.txt \
+ *                      CaseFolding.txt SpecialCasing.txt \
+ *                      GraphemeBreakProperty.txt DerivedCoreProperties.txt \
+ *                      > unicode-tables.h
+ * 
+ * or run `make unicode-tables UCD=path/to/UCD` in the top directory,
+ * with the extracted UCD.zip of the wanted version of Unicode.
+ * 
+ * The properties of each code point are packed into one byte, and
+ * stored in a three level table: the top bits of the code point
+ * select a middle block, the middle bits select a leaf block in it,
+ * and the low bits select the byte in the leaf. Identical blocks
+ * are stored only once, so a lookup is three dependent loads.
+ * 
+ * The case of each code point is stored the same way, as an index
+ * into a list of distinct case records. A record holds the offset to
+ * the simple case folding of the code point, the offset to the next
+ * code point with the same folding, so that all case variants of a
+ * code point can be visited by following the offsets around, and the
+ * offsets to its simple lower, upper and title case mappings. Full
+ * case mappings to more than one code point are listed separately.
+ * 
+ * The properties used to find extended grapheme cluster boundaries
+ * are packed into one byte per code point and stored the same way as
+ * the other properties: the Grapheme_Cluster_Break value in the low
+ * bits, whether the code point is Extended_Pictographic, and its
+ * Indic_Conjunct_Break value.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+
+
+#define CODE_POINTS  0x110000
+
+#define ROOT_SHIFT    11
+#define MIDDLE_SHIFT  6
+#define MIDDLE_SIZE   (1 << (ROOT_SHIFT - MIDDLE_SHIFT))
+#define LEAF_SIZE     (1 << MIDDLE_SHIFT)
+#define ROOT_SIZE     (CODE_POINTS >> ROOT_SHIFT)
+
+#define WIDTH               0x03
+#define COMBINING           0x04
+#define EMOJI               0x08
+#define EMOJI_PRESENTATION  0x10
+
+#define GRAPHEME_BREAK          0x0F
+#define EXTENDED_PICTOGRAPHIC   0x10
+#define INCB                    0x60
+#define INCB_CONSONANT          0x20
+#define INCB_EXTEND             0x40
+#define INCB_LINKER             0x60
+
+#define MAX_SPECIAL_CASING  256
+
+/* libstring.c has room for this many code points with the same case folding. */
+#define MAX_CASE_VARIANTS   4
+
+
+/**
+ * The properties of each code point.
+ */
+static uint8_t props[CODE_POINTS];
+
+/**
+ * The grapheme cluster properties of each code point.
+ */
+static uint8_t grapheme[CODE_POINTS];
+
+/**
+ * The Grapheme_Cluster_Break values, in the order of their
+ * numbers, and the names used for them in the generated file.
+ */
+static const char* grapheme_break[][2] =
+  {
+    {"Other", "OTHER"},
+    {"CR", "CR"},
+    {"LF", "LF"},
+    {"Control", "CONTROL"},
+    {"Extend", "EXTEND"},
+    {"ZWJ", "ZWJ"},
+    {"Regional_Indicator", "REGIONAL_INDICATOR"},
+    {"Prepend", "PREPEND"},
+    {"SpacingMark", "SPACING_MARK"},
+    {"L", "L"},
+    {"V", "V"},
+    {"T", "T"},
+    {"LV", "LV"},
+    {"LVT", "LVT"}
+  };
+
+/**
+ * The general category of each code point.
+ */
+static char category[CODE_POINTS][3];
+
+/**
+ * The East Asian Width of each code point.
+ */
+static char east_asian_width[CODE_POINTS][3];
+
+/**
+ * The simple case folding of each code point.
+ */
+static uint32_t case_fold[CODE_POINTS];
+
+/**
+ * The next code point, in ascending order and wrapping
+ * around, with the same simple case folding as each code point.
+ */
+static uint32_t case_next[CODE_POINTS];
+
+/**
+ * The simple lower case mapping of each code point.
+ */
+static uint32_t case_lower[CODE_POINTS];
+
+/**
+ * The simple upper case mapping of each code point.
+ */
+static uint32_t case_upper[CODE_POINTS];
+
+/**
+ * The simple title case mapping of each code point.
+ */
+static uint32_t case_title[CODE_POINTS];
+
+/**
+ * The code points with unconditional special case
+ * mappings, in ascending order.
+ */
+static uint32_t special_casing_keys[MAX_SPECIAL_CASING];
+
+/**
+ * The lower, upper and title case mapping of each code
+ * point in `special_casing_keys`, each terminated by a
+ * zero unless it is three code points long.
+ */
+static uint32_t special_casing[MAX_SPECIAL_CASING][3][3];
+
+/**
+ * The number of elements in `special_casing_keys`.
+ */
+static size_t n_special_casing = 0;
+
+/**
+ * The Unicode version, as read from
+ * the header of EastAsianWidth.txt.
+ */
+static char version[64] = "unknown";
+
+
+
+/**
+ * Parse a code point or a range of code points.
+ * 
+ * @param   s      The text to parse, will be updated
+ *                 to point after the parsed text.
+ * @param   first  Output parameter for the first code point.
+ * @param   last   Output parameter for the last code point.
+ * @return         0 on success, -1 on error.
+ */
+static int parse_range(char** s, unsigned long* first, unsigned long* last)
+{
+  char* end;
+  
+  *first = *last = strtoul(*s, &end, 16);
+  if (end == *s)
+    return -1;
+  if ((end[0] == '.') && (end[1] == '.'))
+    {
+      *s = end + 2;
+      *last = strtoul(*s, &end, 16);
+      if (end == *s)
+	return -1;
+    }
+  *s = end;
+  return ((*first <= *last) && (*last < CODE_POINTS)) ? 0 : -1;
+}
+
+
+/**
+ * Get the value of a field in a file in the format of
+ * EastAsianWidth.txt, emoji-data.txt or GraphemeBreakProperty.txt: the text after
+ * the semicolon, without surrounding whitespace.
+ * 
+ * @param   s  The text after the code points.
+ * @return     The value, `NULL` if there is none.
+ */
+static char* parse_value(char* s)
+{
+  char* end;
+  
+  while ((*s == ' ') || (*s == '\t'))
+    s++;
+  if (*s++ != ';')
+    return NULL;
+  while ((*s == ' ') || (*s == '\t'))
+    s++;
+  for (end = s; *end && !strchr("# \t\r\n", *end); end++);
+  *end = '\0';
+  return s;
+}
+
+
+/**
+ * Parse a simple case mapping in UnicodeData.txt.
+ * 
+ * @param   s          The field.
+ * @param   otherwise  The value to use if the field is empty.
+ * @return             The mapping, `UINT32_MAX` on error.
+ */
+static uint32_t parse_mapping(const char* s, uint32_t otherwise)
+{
+  unsigned long cp;
+  char* end;
+  
+  cp = strtoul(s, &end, 16);
+  if (end == s)
+    return otherwise;
+  return cp < CODE_POINTS ? (uint32_t)cp : UINT32_MAX;
+}
+
+
+/**
+ * Read UnicodeData.txt.
+ * 
+ * @param   f  The file.
+ * @return     0 on success, -1 on error.
+ */
+static int read_unicode_data(FILE* f)
+{
+  char line[1024];
+  char* fields[15];
+  char* s;
+  unsigned long cp, last, range_first = 0;
+  int i, in_range = 0;
+  
+  while (fgets(line, sizeof(line), f))
+    {
+      for (s = line, i = 0; i < 15; i++)
+	{
+	  fields[i] = s;
+	  if (!(s = strchr(s, ';')))
+	    break;
+	  *s++ = '\0';
+	}
+      if (i < 14)
+	continue;
+  
+      s = fields[0];
+      if (parse_range(&s, &cp, &last))
+	return errno = EINVAL, -1;
+  
+      /* Large blocks are listed as their first and last code point. */
+      if (strstr(fields[1], ", First>"))
+	{
+	  range_first = cp, in_range = 1;
+	  continue;
+	}
+      if (in_range && strstr(fields[1], ", Last>"))
+	last = cp, cp = range_first;
+      in_range = 0;
+  
+      /* Code points in large blocks have no case. */
+      if (cp == last)
+	{
+	  case_upper[cp] = parse_mapping(fields[12], (uint32_t)cp);
+	  case_lower[cp] = parse_mapping(fields[13], (uint32_t)cp);
+	  case_title[cp] = parse_mapping(fields[14], case_upper[cp]);
+	  if ((case_upper[cp] | case_lower[cp] | case_title[cp]) == UINT32_MAX)
+	    return errno = EINVAL, -1;
+	}
+  
+      for (; cp <= last; cp++)
+	snprintf(category[cp], sizeof(*category), "%.2s", fields[2]);
+    }
+  
+  return ferror(f) ? -1 : 0;
+}
+
+
+/**
+ * Read EastAsianWidth.txt.
+ * 
+ * @param   f  The file.
+ * @return     0 on success, -1 on error.
+ */
+static int read_east_asian_width(FILE* f)
+{
+  char line[1024];
+  char* s;
+  char* value;
+  unsigned long cp, last;
+  
+  while (fgets(line, sizeof(line), f))
+    {
+      s = line;
+      if (!strncmp(s, "# EastAsianWidth-", sizeof("# EastAsianWidth-") - 1))
+	{
+	  s += sizeof("# EastAsianWidth-") - 1;
+	  snprintf(version, sizeof(version), "%.*s", (int)strspn(s, "0123456789."), s);
+	  if (*version && (version[strlen(version) - 1] == '.'))
+	    version[strlen(version) - 1] = '\0';
+	  continue;
+	}
+  
+      /* Values of unlisted code points are given as comments. */
+      if (!strncmp(s, "# @missing: ", sizeof("# @missing: ") - 1))
+	s += sizeof("# @missing: ") - 1;
+      else if (*s == '#')
+	continue;
+  
+      if (parse_range(&s, &cp, &last))
+	continue;
+      if (!(value = parse_value(s)) || !*value)
+	return errno = EINVAL, -1;
+      for (; cp <= last; cp++)
+	snprintf(east_asian_width[cp], sizeof(*east_asian_width), "%.2s", value);
+    }
+  
+  return ferror(f) ? -1 : 0;
+}
+
+
+/**
+ * Read emoji-data.txt.
+ * 
+ * @param   f  The file.
+ * @return     0 on success, -1 on error.
+ */
+static int read_emoji_data(FILE* f)
+{
+  char line[1024];
+  char* s;
+  char* value;
+  unsigned long cp, last;
+  uint8_t prop;
+  
+  while (fgets(line, sizeof(line), f))
+    {
+      s = line;
+      if ((*s == '#') || parse_range(&s, &cp, &last))
+	continue;
+      if (!(value = parse_value(s)))
+	return errno = EINVAL, -1;
+      if (!strcmp(value, "Extended_Pictographic"))
+	{
+	  for (; cp <= last; cp++)
+	    grapheme[cp] |= EXTENDED_PICTOGRAPHIC;
+	  continue;
+	}
+      if (!strcmp(value, "Emoji"))
+	prop = EMOJI;
+      else if (!strcmp(value, "Emoji_Presentation"))
+	prop = EMOJI_PRESENTATION;
+      else
+	continue;
+      for (; cp <= last; cp++)
+	props[cp] |= prop;
+    }
+  
+  return ferror(f) ? -1 : 0;
+}
+
+
+/**
+ * Read CaseFolding.txt.
+ * 
+ * Only the common and simple mappings are used, so
+ * each code point folds to exactly one code point.
+ * 
+ * @param   f  The file.
+ * @return     0 on success, -1 on error.
+ */
+static int read_case_folding(FILE* f)
+{
+  char line[1024];
+  char status[2];
+  unsigned long cp, to;
+  
+  while (fgets(line, sizeof(line), f))
+    {
+      if ((*line == '#') || (sscanf(line, "%lx; %1s; %lx;", &cp, status, &to) != 3))
+	continue;
+      if ((cp >= CODE_POINTS) || (to >= CODE_POINTS))
+	return errno = EINVAL, -1;
+      if ((*status == 'C') || (*status == 'S'))
+	case_fold[cp] = (uint32_t)to;
+    }
+  
+  return ferror(f) ? -1 : 0;
+}
+
+
+/**
+ * Read SpecialCasing.txt.
+ * 
+ * Only the unconditional mappings are used.
+ * 
+ * @param   f  The file.
+ * @return     0 on success, -1 on error.
+ */
+static int read_special_casing(FILE* f)
+{
+  /* The lower, title and upper case mapping fields,
+   * in the order they are stored in. */
+  static const int order[3] = {1, 3, 2};
+  char line[1024];
+  char* fields[5];
+  char* s;
+  char* end;
+  unsigned long cp, c;
+  size_t i, j, k;
+  
+  while (fgets(line, sizeof(line), f))
+    {
+      if ((s = strchr(line, '#')))
+	*s = '\0';
+      for (s = line, i = 0; i < 5; i++)
+	{
+	  fields[i] = s;
+	  if (!(s = strchr(s, ';')))
+	    break;
+	  *s++ = '\0';
+	}
+      if ((i != 4) || fields[4][strspn(fields[4], " \t\r\n")])
+	continue;
+  
+      cp = strtoul(fields[0], &end, 16);
+      if ((end == fields[0]) || (cp >= CODE_POINTS) || (n_special_casing == MAX_SPECIAL_CASING))
+	return errno = EINVAL, -1;
+  
+      /* Keep the code points in order. */
+      for (i = n_special_casing++; (i > 0) && (special_casing_keys[i - 1] > cp); i--)
+	{
+	  special_casing_keys[i] = special_casing_keys[i - 1];
+	  memcpy(special_casing[i], special_casing[i - 1], sizeof(*special_casing));
+	}
+      special_casing_keys[i] = (uint32_t)cp;
+      memset(special_casing[i], 0, sizeof(*special_casing));
+  
+      for (j = 0; j < 3; j++)
+	for (s = fields[order[j]], k = 0;; k++)
+	  {
+	    c = strtoul(s, &end, 16);
+	    if (end == s)
+	      break;
+	    if ((k == 3) || (c == 0) || (c >= CODE_POINTS))
+	      return errno = EINVAL, -1;
+	    special_casing[i][j][k] = (uint32_t)c;
+	    s = end;
+	  }
+    }
+  
+  return ferror(f) ? -1 : 0;
+}
+
+
+/**
+ * Read GraphemeBreakProperty.txt.
+ * 
+ * @param   f  The file.
+ * @return     0 on success, -1 on error.
+ */
+static int read_grapheme_break_property(FILE* f)
+{
+  char line[1024];
+  char* s;
+  char* value;
+  unsigned long cp, last;
+  uint8_t prop;
+  
+  while (fgets(line, sizeof(line), f))
+    {
+      s = line;
+      if ((*s == '#') || parse_range(&s, &cp, &last))
+	continue;
+      if (!(value = parse_value(s)))
+	return errno = EINVAL, -1;
+      for (prop = 0; prop < sizeof(grapheme_break) / sizeof(*grapheme_break); prop++)
+	if (!strcmp(value, grapheme_break[prop][0]))
+	  break;
+      if (prop == sizeof(grapheme_break) / sizeof(*grapheme_break))
+	return errno = EINVAL, -1;
+      for (; cp <= last; cp++)
+	grapheme[cp] = (uint8_t)((grapheme[cp] & ~GRAPHEME_BREAK) | prop);
+    }
+  
+  return ferror(f) ? -1 : 0;
+}
+
+
+/**
+ * Read DerivedCoreProperties.txt.
+ * 
+ * Only the Indic_Conjunct_Break property is used.
+ * 
+ * @param   f  The file.
+ * @return     0 on success, -1 on error.
+ */
+static int read_derived_core_properties(FILE* f)
+{
+  char line[1024];
+  char value[32];
+  char* s;
+  unsigned long cp, last;
+  uint8_t prop;
+  
+  while (fgets(line, sizeof(line), f))
+    {
+      s = line;
+      if ((*s == '#') || parse_range(&s, &cp, &last))
+	continue;
+      if (sscanf(s, " ; InCB ; %31[A-Za-z]", value) != 1)
+	continue;
+      if (!strcmp(value, "Consonant"))
+	prop = INCB_CONSONANT;
+      else if (!strcmp(value, "Extend"))
+	prop = INCB_EXTEND;
+      else if (!strcmp(value, "Linker"))
+	prop = INCB_LINKER;
+      else
+	continue;
+      for (; cp <= last; cp++)
+	grapheme[cp] = (uint8_t)((grapheme[cp] & ~INCB) | prop);
+    }
+  
+  return ferror(f) ? -1 : 0;
+}
+
+
+/**
+ * Link the code points with the same case folding.
+ * 
+ * @return  0 on success, -1 if more than `MAX_CASE_VARIANTS`
+ *          code points have the same case folding.
+ */
+static int link_case_variants(void)
+{
+  static uint32_t first[CODE_POINTS], last[CODE_POINTS];
+  static unsigned char members[CODE_POINTS];
+  static char is_folding[CODE_POINTS];
+  unsigned long cp;
+  uint32_t k;
+  
+  for (cp = 0; cp < CODE_POINTS; cp++)
+    {
+      case_next[cp] = (uint32_t)cp;
+      last[cp] = UINT32_MAX;
+      if (case_fold[cp] != cp)
+	is_folding[case_fold[cp]] = 1;
+    }
+  
+  /* Code points are visited in ascending order, so each is linked to the
+   * previous one with the same folding, and then the last to the first.
+   * A folding folds to itself, so it is linked like the others. */
+  for (cp = 0; cp < CODE_POINTS; cp++)
+    {
+      k = case_fold[cp];
+      if ((k == cp) && !is_folding[cp])
+	continue;
+      if (last[k] == UINT32_MAX)
+	first[k] = (uint32_t)cp;
+      else
+	case_next[last[k]] = (uint32_t)cp;
+      last[k] = (uint32_t)cp;
+      if (++members[k] > MAX_CASE_VARIANTS)
+	{
+	  fprintf(stderr, "U+%04lX: more than %i code points fold to U+%04lX\n",
+		  cp, MAX_CASE_VARIANTS, (unsigned long)k);
+	  return -1;
+	}
+    }
+  for (cp = 0; cp < CODE_POINTS; cp++)
+    if (last[cp] != UINT32_MAX)
+      case_next[last[cp]] = first[cp];
+  return 0;
+}
+
+
+/**
+ * Get the number of columns a code point
+ * occupies when displayed on its own.
+ * 
+ * @param   cp  The code point.
+ * @return      0, 1 or 2.
+ */
+static int width(unsigned long cp)
+{
+  const char* gc = category[cp];
+  
+  if (!strcmp(gc, "Mn") || !strcmp(gc, "Me"))
+    return 0;
+  if (!strcmp(gc, "Cc") || !strcmp(gc, "Zl") || !strcmp(gc, "Zp"))
+    return 0;
+  if (!strcmp(gc, "Cf") && (cp != 0x00AD))
+    return 0;
+  /* Medial vowels and final consonants of conjoining Hangul. */
+  if (((0x1160 <= cp) && (cp <= 0x11FF)) || ((0xD7B0 <= cp) && (cp <= 0xD7FF)))
+    return 0;
+  if (!strcmp(east_asian_width[cp], "W") || !strcmp(east_asian_width[cp], "F"))
+    return 2;
+  return 1;
+}
+
+
+/**
+ * Print a table of blocks.
+ * 
+ * @param   name    The name of the table.
+ * @param   type    The type of the elements.
+ * @param   blocks  The blocks.
+ * @param   n       The number of blocks.
+ * @param   size    The number of elements per block.
+ */
+static void print_blocks(const char* name, const char* type,
+			 const unsigned* blocks, size_t n, size_t size)
+{
+  size_t i, j;
+  
+  printf("static const %s %s[%zu][%zu] =\n  {\n", type, name, n, size);
+  for (i = 0; i < n; i++)
+    {
+      printf("    {");
+      for (j = 0; j < size; j++)
+	printf("%s%s%u", j ? "," : "", (j && !(j % 16)) ? "\n     " : "", blocks[i * size + j]);
+      printf("}%s\n", i + 1 < n ? "," : "");
+    }
+  printf("  };\n\n");
+}
+
+
+/**
+ * Store a block, unless an identical block is already stored.
+ * 
+ * @param   blocks  The stored blocks.
+ * @param   n       The number of stored blocks, will be updated.
+ * @param   block   The block to store.
+ * @param   size    The number of elements per block.
+ * @return          The index of the block.
+ */
+static unsigned intern(unsigned* blocks, size_t* n, const unsigned* block, size_t size)
+{
+  size_t i;
+  for (i = 0; i < *n; i++)
+    if (!memcmp(blocks + i * size, block, size * sizeof(*block)))
+      return (unsigned)i;
+  memcpy(blocks + *n * size, block, size * sizeof(*block));
+  return (unsigned)(*n)++;
+}
+
+
+/**
+ * Print a three level table.
+ * 
+ * @param  name    The name of the table, the names of its
+ *                 levels are formed by appending "_root",
+ *                 "_middle" and "_leaves".
+ * @param  values  The value of each code point.
+ */
+static void print_table(const char* name, const unsigned* values)
+{
+  static unsigned leaves[CODE_POINTS], middles[CODE_POINTS >> MIDDLE_SHIFT], root[ROOT_SIZE];
+  unsigned block[LEAF_SIZE], middle[MIDDLE_SIZE], max = 0;
+  size_t n_leaves = 0, n_middles = 0, i, j, k;
+  char level[64];
+  
+  for (i = 0; i < ROOT_SIZE; i++)
+    {
+      for (j = 0; j < MIDDLE_SIZE; j++)
+	{
+	  for (k = 0; k < LEAF_SIZE; k++)
+	    {
+	      block[k] = values[(i << ROOT_SHIFT) | (j << MIDDLE_SHIFT) | k];
+	      max = block[k] > max ? block[k] : max;
+	    }
+	  middle[j] = intern(leaves, &n_leaves, block, LEAF_SIZE);
+	}
+      root[i] = intern(middles, &n_middles, middle, MIDDLE_SIZE);
+    }
+  
+  printf("/* %zu bytes in total. */\n\n",
+	 ROOT_SIZE * (n_middles > 256 ? 2 : 1) +
+	 n_middles * MIDDLE_SIZE * (n_leaves > 256 ? 2 : 1) +
+	 n_leaves * LEAF_SIZE * (max > 255 ? 2 : 1));
+  
+  printf("static const %s %s_root[%i] =\n  {", n_middles > 256 ? "uint16_t" : "uint8_t", name, ROOT_SIZE);
+  for (i = 0; i < ROOT_SIZE; i++)
+    printf("%s%s%u", i ? "," : "", (i % 16) ? "" : "\n    ", root[i]);
+  printf("\n  };\n\n");
+  snprintf(level, sizeof(level), "%s_middle", name);
+  print_blocks(level, n_leaves > 256 ? "uint16_t" : "uint8_t", middles, n_middles, MIDDLE_SIZE);
+  snprintf(level, sizeof(level), "%s_leaves", name);
+  print_blocks(level, max > 255 ? "uint16_t" : "uint8_t", leaves, n_leaves, LEAF_SIZE);
+}
+
+
+int main(int argc, char* argv[])
+{
+  static unsigned values[CODE_POINTS], records[CODE_POINTS * 6];
+  unsigned record[6] = {0, 0, 0, 0, 0, 0};
+  size_t n_records = 0, i, j, k;
+  unsigned long cp;
+  int (*readers[])(FILE*) = {read_unicode_data, read_east_asian_width, read_emoji_data,
+			     read_case_folding, read_special_casing,
+			     read_grapheme_break_property, read_derived_core_properties};
+  FILE* f;
+  
+  if (argc != 8)
+    {
+      fprintf(stderr, "usage: %s UnicodeData.txt EastAsianWidth.txt emoji-data.txt "
+	      "CaseFolding.txt SpecialCasing.txt GraphemeBreakProperty.txt "
+	      "DerivedCoreProperties.txt\n", *argv);
+      return 2;
+    }
+  
+  for (cp = 0; cp < CODE_POINTS; cp++)
+    {
+      strcpy(category[cp], "Cn"), strcpy(east_asian_width[cp], "N");
+      case_fold[cp] = case_lower[cp] = case_upper[cp] = case_title[cp] = (uint32_t)cp;
+    }
+  
+  for (i = 0; i < 7; i++)
+    {
+      if (!(f = fopen(argv[i + 1], "r")) || readers[i](f))
+	{
+	  perror(argv[i + 1]);
+	  return 1;
+	}
+      fclose(f);
+    }
+  if (link_case_variants())
+    return 1;
+  
+  printf("/* This file is generated by gen-unicode-tables.c from the\n");
+  printf(" * Unicode Character Database, version %s. Do not edit. */\n\n", version);
+  printf("#define UNICODE_WIDTH               0x%02X\n", WIDTH);
+  printf("#define UNICODE_COMBINING           0x%02X\n", COMBINING);
+  printf("#define UNICODE_EMOJI               0x%02X\n", EMOJI);
+  printf("#define UNICODE_EMOJI_PRESENTATION  0x%02X\n\n", EMOJI_PRESENTATION);
+  printf("#define UNICODE_ROOT_SHIFT    %i\n", ROOT_SHIFT);
+  printf("#define UNICODE_MIDDLE_SHIFT  %i\n", MIDDLE_SHIFT);
+  printf("#define UNICODE_MIDDLE_MASK   0x%X\n", MIDDLE_SIZE - 1);
+  printf("#define UNICODE_LEAF_MASK     0x%X\n\n", LEAF_SIZE - 1);
+  printf("#define UNICODE_CASE_FOLD     0\n");
+  printf("#define UNICODE_CASE_NEXT     1\n");
+  printf("#define UNICODE_CASE_LOWER    2\n");
+  printf("#define UNICODE_CASE_UPPER    3\n");
+  printf("#define UNICODE_CASE_TITLE    4\n");
+  printf("#define UNICODE_CASE_SPECIAL  5\n\n");
+  printf("#define UNICODE_GRAPHEME_BREAK          0x%02X\n", GRAPHEME_BREAK);
+  printf("#define UNICODE_EXTENDED_PICTOGRAPHIC   0x%02X\n", EXTENDED_PICTOGRAPHIC);
+  printf("#define UNICODE_INCB                    0x%02X\n", INCB);
+  printf("#define UNICODE_INCB_CONSONANT          0x%02X\n", INCB_CONSONANT);
+  printf("#define UNICODE_INCB_EXTEND             0x%02X\n", INCB_EXTEND);
+  printf("#define UNICODE_INCB_LINKER             0x%02X\n\n", INCB_LINKER);
+  for (i = 0; i < sizeof(grapheme_break) / sizeof(*grapheme_break); i++)
+    printf("#define UNICODE_GRAPHEME_%-20s%zu\n", grapheme_break[i][1], i);
+  printf("\n");
+  
+  for (cp = 0; cp < CODE_POINTS; cp++)
+    {
+      values[cp] = props[cp] | (unsigned)width(cp);
+      if (!strcmp(category[cp], "Mn") || !strcmp(category[cp], "Me"))
+	values[cp] |= COMBINING;
+    }
+  print_table("unicode", values);
+  
+  /* Record 0 is for code points without case. */
+  intern(records, &n_records, record, 6);
+  for (cp = 0, k = 0; cp < CODE_POINTS; cp++)
+    {
+      record[0] = (unsigned)(case_fold[cp] - cp);
+      record[1] = (unsigned)(case_next[cp] - cp);
+      record[2] = (unsigned)(case_lower[cp] - cp);
+      record[3] = (unsigned)(case_upper[cp] - cp);
+      record[4] = (unsigned)(case_title[cp] - cp);
+      record[5] = (k < n_special_casing) && (special_casing_keys[k] == cp);
+      k += record[5];
+      values[cp] = intern(records, &n_records, record, 6);
+    }
+  printf("/* The offsets to the simple case folding, to the next code point\n");
+  printf(" * with the same folding, and to the simple lower, upper and title\n");
+  printf(" * case mappings, and whether there are special case mappings. */\n");
+  printf("static const int32_t unicode_case[%zu][6] =\n  {", n_records);
+  for (i = 0; i < n_records; i++)
+    {
+      printf("%s%s{", i ? "," : "", (i % 4) ? " " : "\n    ");
+      for (j = 0; j < 6; j++)
+	printf("%s%i", j ? "," : "", (int)(int32_t)records[6 * i + j]);
+      printf("}");
+    }
+  printf("\n  };\n\n");
+  print_table("unicode_case", values);
+  
+  printf("/* The code points with special case mappings. */\n");
+  printf("static const uint32_t unicode_special_casing_keys[%zu] =\n  {", n_special_casing);
+  for (i = 0; i < n_special_casing; i++)
+    printf("%s%s0x%04X", i ? "," : "", (i % 8) ? " " : "\n    ", (unsigned)special_casing_keys[i]);
+  printf("\n  };\n\n");
+  printf("/* The lower, upper and title case mappings of the code points in\n");
+  printf(" * unicode_special_casing_keys, each terminated by a zero unless it\n");
+  printf(" * is three code points long. */\n");
+  printf("static const uint32_t unicode_special_casing[%zu][3][3] =\n  {", n_special_casing);
+  for (i = 0; i < n_special_casing; i++)
+    {
+      printf("%s\n    {", i ? "," : "");
+      for (j = 0; j < 3; j++)
+	printf("%s{0x%04X, 0x%04X, 0x%04X}", j ? ", " : "", (unsigned)special_casing[i][j][0],
+	       (unsigned)special_casing[i][j][1], (unsigned)special_casing[i][j][2]);
+      printf("}");
+    }
+  printf("\n  };\n\n");
+  
+  for (cp = 0; cp < CODE_POINTS; cp++)
+    values[cp] = grapheme[cp];
+  print_table("unicode_grapheme", values);
+  
+  return fflush(stdout) ? 1 : 0;
+}
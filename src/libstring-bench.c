@@ -0,0 +1,1089 @@
+/**
+ * libstring — String manipulation library
+ * 
+ * Copyright © 2015  Mattias Andrée (m@maandree.se)
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Measures the throughput of the library's functions, and prints
+ * the results as JSON, so that versions can be compared:
+ * 
+ *   libstring-bench [-l] [-s size] [-t milliseconds] [-f function] [-c corpus] > results.json
+ * 
+ *   -s  The size of each corpus, in bytes, 1 MiB by default.
+ *   -t  The least time to run each benchmark, 200 ms by default.
+ *   -f  Only run benchmarks whose name contains this text.
+ *   -c  Only use corpora whose name contains this text.
+ *   -l  List the benchmarks and corpora, and exit.
+ * 
+ * Every benchmark is run on every corpus. The corpora are generated
+ * from a fixed seed, so they are the same in every run:
+ * 
+ *   ascii      Words of ASCII letters, digits and punctuation.
+ *   latin1     Western European text, with many two-byte characters.
+ *   cjk        Chinese and Japanese text, with three-byte characters.
+ *   emoji      Emoji, with skin tones and zero-width joiner sequences.
+ *   combining  Latin letters with several combining marks each.
+ *   invalid    ASCII text with stray, truncated and overlong UTF-8.
+ * 
+ * Each corpus is made of lines of words, separated by spaces and
+ * tabs. The functions that take one string are given the whole
+ * corpus, and those that take a list of strings are given its lines.
+ * The result for each benchmark is the number of calls, the number
+ * of input bytes per call, MB/s (`null` if the function has no input
+ * text), nanoseconds per call, and allocations per call. Allocations
+ * are counted with an allocator selected with `libstring_set_allocator`,
+ * and include reallocations.
+ * 
+ * Functions that only initialise or release objects, or select the
+ * allocator, are measured as parts of the benchmarks that use them.
+ * 
+ * Build it together with the library:
+ * 
+ *   cc -O2 -pthread -o libstring-bench libstring-bench.c libstring.c
+ * 
+ * or run `make bench` in the top directory.
+ */
+#include "libstring.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+
+
+/**
+ * The number of strings given to the variadic functions.
+ */
+#define VARIADIC_N  8
+
+
+
+/**
+ * A generated text to run the benchmarks on.
+ */
+struct corpus
+{
+  /**
+   * The name of the corpus.
+   */
+  const char* name;
+  
+  /**
+   * Append a word to the corpus.
+   */
+  void (*word)(struct corpus*);
+  
+  /**
+   * The text, NUL-terminated.
+   */
+  char* text;
+  
+  /**
+   * The length of `text`.
+   */
+  size_t size;
+  
+  /**
+   * The allocation size of `text`.
+   */
+  size_t cap;
+  
+  /**
+   * The lines of `text`, without their newlines.
+   */
+  const char** lines;
+  
+  /**
+   * The lines of `text`, with their lengths.
+   */
+  struct libstring_str* strs;
+  
+  /**
+   * The number of lines.
+   */
+  size_t n_lines;
+  
+  /**
+   * The total length of the first `VARIADIC_N` lines.
+   */
+  size_t variadic_size;
+  
+  /**
+   * A copy of `text` that benchmarks may modify,
+   * restored before each benchmark.
+   */
+  char* work;
+  
+  /**
+   * Output buffer for the `_into` functions.
+   */
+  char* buf;
+  
+  /**
+   * The allocation size of `buf`.
+   */
+  size_t buf_size;
+};
+
+
+/**
+ * A benchmark of one function.
+ */
+struct bench
+{
+  /**
+   * The name of the function.
+   */
+  const char* name;
+  
+  /**
+   * Call the function once.
+   * 
+   * @param   c  The corpus.
+   * @return     The number of bytes of input text
+   *             the function was given.
+   */
+  size_t (*run)(struct corpus* c);
+};
+
+
+
+/**
+ * The state of the pseudorandom number generator.
+ */
+static uint64_t seed;
+
+/**
+ * The number of allocations and reallocations made.
+ */
+static size_t allocations;
+
+/**
+ * Result sink, so calls are not optimised away.
+ */
+static volatile size_t sink;
+
+/**
+ * Output string for the `_str` functions, reused between calls.
+ */
+static struct libstring_str str_out;
+
+/**
+ * The state of the pseudorandom number generator
+ * for `libstring_anagram`, kept between calls.
+ */
+static unsigned long long int anagram_state = 1;
+
+/**
+ * A delimiter found in all corpora.
+ */
+static struct libstring_pattern space;
+
+/**
+ * The replacer for `libstring_replace_many`.
+ */
+static struct libstring_replacer replacer;
+
+/**
+ * The substrings to replace with `libstring_replace_many`.
+ */
+static const char* const replace_from[] = {"the", "and", "\t", "\xC3\xA4", "\xE3\x80\x82"};
+
+/**
+ * The replacements for `replace_from`.
+ */
+static const char* const replace_to[] = {"THE", "&", "    ", "ae", "."};
+
+/**
+ * The number of elements in `replace_from` and `replace_to`.
+ */
+static const size_t replace_n = sizeof(replace_from) / sizeof(*replace_from);
+
+/**
+ * The fields given to `libstring_cut`.
+ */
+static const size_t cut_fields[] = {0, 2, 3};
+
+/**
+ * The number of elements in `cut_fields`.
+ */
+static const size_t cut_fields_n = sizeof(cut_fields) / sizeof(*cut_fields);
+
+
+
+/**
+ * Get a pseudorandom number.
+ * 
+ * @param   n  The number of values.
+ * @return     A number less than `n`.
+ */
+static uint32_t random_below(uint32_t n)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 7;
+  seed ^= seed << 17;
+  return (uint32_t)((seed >> 32) % n);
+}
+
+
+/**
+ * Append bytes to a corpus, growing it if necessary.
+ * 
+ * @param  c  The corpus.
+ * @param  s  The bytes.
+ * @param  n  The number of bytes.
+ */
+static void put(struct corpus* c, const char* s, size_t n)
+{
+  if (c->size + n >= c->cap)
+    {
+      c->cap = (c->cap + n) * 2;
+      c->text = realloc(c->text, c->cap);
+      if (c->text == NULL)
+	perror("libstring-bench"), exit(1);
+    }
+  memcpy(c->text + c->size, s, n);
+  c->size += n;
+}
+
+
+/**
+ * Append a code point, encoded as UTF-8, to a corpus.
+ * 
+ * @param  c   The corpus.
+ * @param  cp  The code point.
+ */
+static void put_cp(struct corpus* c, uint32_t cp)
+{
+  char s[4];
+  if (cp < 0x80)
+    s[0] = (char)cp, put(c, s, 1);
+  else if (cp < 0x800)
+    {
+      s[0] = (char)(0xC0 | (cp >> 6));
+      s[1] = (char)(0x80 | (cp & 0x3F));
+      put(c, s, 2);
+    }
+  else if (cp < 0x10000)
+    {
+      s[0] = (char)(0xE0 | (cp >> 12));
+      s[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+      s[2] = (char)(0x80 | (cp & 0x3F));
+      put(c, s, 3);
+    }
+  else
+    {
+      s[0] = (char)(0xF0 | (cp >> 18));
+      s[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+      s[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+      s[3] = (char)(0x80 | (cp & 0x3F));
+      put(c, s, 4);
+    }
+}
+
+
+/**
+ * Append a random ASCII letter to a corpus.
+ * 
+ * @param  c  The corpus.
+ */
+static void put_ascii_letter(struct corpus* c)
+{
+  uint32_t r = random_below(52);
+  put_cp(c, r < 26 ? 'a' + r : 'A' + r - 26);
+}
+
+
+/**
+ * Append an ASCII word, sometimes with
+ * digits or punctuation, to a corpus.
+ * 
+ * @param  c  The corpus.
+ */
+static void word_ascii(struct corpus* c)
+{
+  static const char punctuation[] = ".,;:!?-()'\"";
+  uint32_t i, n = 1 + random_below(10);
+  for (i = 0; i < n; i++)
+    {
+      if (random_below(10) == 0)
+	put_cp(c, '0' + random_below(10));
+      else
+	put_ascii_letter(c);
+    }
+  if (random_below(6) == 0)
+    put(c, punctuation + random_below(sizeof(punctuation) - 1), 1);
+}
+
+
+/**
+ * Append a Western European word, with many letters
+ * from the Latin-1 Supplement, to a corpus.
+ * 
+ * @param  c  The corpus.
+ */
+static void word_latin1(struct corpus* c)
+{
+  uint32_t i, n = 1 + random_below(10), cp;
+  for (i = 0; i < n; i++)
+    {
+      if (random_below(5) < 2)
+	{
+	  /* À–ÿ, without × and ÷. */
+	  do
+	    cp = 0xC0 + random_below(0x40);
+	  while ((cp == 0xD7) || (cp == 0xF7));
+	  put_cp(c, cp);
+	}
+      else
+	put_ascii_letter(c);
+    }
+}
+
+
+/**
+ * Append a word of CJK ideographs, kana
+ * and fullwidth punctuation to a corpus.
+ * 
+ * @param  c  The corpus.
+ */
+static void word_cjk(struct corpus* c)
+{
+  uint32_t i, n = 2 + random_below(12), r;
+  for (i = 0; i < n; i++)
+    {
+      r = random_below(10);
+      if (r < 7)
+	put_cp(c, 0x4E00 + random_below(0x5200));
+      else if (r < 9)
+	put_cp(c, 0x3041 + random_below(0x56));
+      else
+	put_cp(c, random_below(2) ? 0x3001 : 0x3002);
+    }
+}
+
+
+/**
+ * Append a word of emoji, with skin tone modifiers,
+ * variation selectors and zero-width joiner sequences,
+ * to a corpus.
+ * 
+ * @param  c  The corpus.
+ */
+static void word_emoji(struct corpus* c)
+{
+  static const uint32_t people[] = {0x1F468, 0x1F469, 0x1F467, 0x1F466};
+  uint32_t i, n = 1 + random_below(4), r, k, j;
+  for (i = 0; i < n; i++)
+    {
+      r = random_below(4);
+      if (r == 0)
+	{
+	  /* A family, joined with zero-width joiners. */
+	  k = 2 + random_below(3);
+	  for (j = 0; j < k; j++)
+	    {
+	      if (j > 0)
+		put_cp(c, 0x200D);
+	      put_cp(c, people[random_below(4)]);
+	    }
+	}
+      else if (r == 1)
+	{
+	  put_cp(c, 0x1F44B + random_below(6));
+	  put_cp(c, 0x1F3FB + random_below(5));
+	}
+      else if (r == 2)
+	{
+	  put_cp(c, 0x2764);
+	  put_cp(c, 0xFE0F);
+	}
+      else
+	put_cp(c, 0x1F600 + random_below(0x50));
+    }
+}
+
+
+/**
+ * Append a word of Latin letters with one
+ * to three combining marks each to a corpus.
+ * 
+ * @param  c  The corpus.
+ */
+static void word_combining(struct corpus* c)
+{
+  uint32_t i, n = 1 + random_below(8), k, j;
+  for (i = 0; i < n; i++)
+    {
+      put_ascii_letter(c);
+      k = 1 + random_below(3);
+      for (j = 0; j < k; j++)
+	put_cp(c, 0x300 + random_below(0x70));
+    }
+}
+
+
+/**
+ * Append an ASCII word, sometimes with invalid
+ * UTF-8 in it, to a corpus. No NUL bytes are added.
+ * 
+ * @param  c  The corpus.
+ */
+static void word_invalid(struct corpus* c)
+{
+  static const char* const invalid[] = {
+    "\x80", "\xBF", "\xC3", "\xE2\x82", "\xF0\x9F\x98", "\xC0\xAF",
+    "\xE0\x80\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xFE", "\xFF",
+  };
+  uint32_t r;
+  word_ascii(c);
+  if (random_below(3) == 0)
+    {
+      r = random_below(sizeof(invalid) / sizeof(*invalid));
+      put(c, invalid[r], strlen(invalid[r]));
+      word_ascii(c);
+    }
+}
+
+
+/**
+ * Generate a corpus.
+ * 
+ * @param  c     The corpus, with `.name` and `.word` set.
+ * @param  size  The least length of the text.
+ */
+static void generate(struct corpus* c, size_t size)
+{
+  size_t line = 0, i, n;
+  char* p;
+  
+  seed = 0x9E3779B97F4A7C15ULL;
+  while (c->size < size)
+    {
+      c->word(c);
+      if (c->size - line > 60 + random_below(40))
+	put(c, "\n", 1), line = c->size;
+      else
+	put(c, random_below(5) ? " " : "\t", 1);
+    }
+  put(c, "", 1);
+  c->size--;
+  
+  for (c->n_lines = 1, p = c->text; (p = strchr(p, '\n')); p++)
+    c->n_lines++;
+  c->lines = malloc(c->n_lines * sizeof(*c->lines));
+  c->strs = malloc(c->n_lines * sizeof(*c->strs));
+  c->work = malloc(c->size + 1);
+  c->buf_size = 16 * c->size + 64;
+  c->buf = malloc(c->buf_size);
+  p = malloc(c->size + 1);
+  if (!c->lines || !c->strs || !c->work || !c->buf || !p)
+    perror("libstring-bench"), exit(1);
+  
+  memcpy(p, c->text, c->size + 1);
+  for (i = 0; i < c->n_lines; i++)
+    {
+      c->lines[i] = p;
+      p += n = strcspn(p, "\n");
+      *p++ = '\0';
+      c->strs[i].ptr = (char*)c->lines[i];
+      c->strs[i].len = c->strs[i].cap = n;
+    }
+  for (i = 0; i < VARIADIC_N; i++)
+    c->variadic_size += strlen(c->lines[i % c->n_lines]);
+}
+
+
+
+/**
+ * Allocate memory, and count the allocation.
+ */
+static void* count_allocate(size_t size, void* data)
+{
+  (void) data;
+  allocations++;
+  return malloc(size);
+}
+
+
+/**
+ * Reallocate memory, and count the allocation.
+ */
+static void* count_reallocate(void* ptr, size_t old_size, size_t size, void* data)
+{
+  (void) old_size;
+  (void) data;
+  allocations++;
+  return realloc(ptr, size);
+}
+
+
+/**
+ * Deallocate memory.
+ */
+static void count_deallocate(void* ptr, void* data)
+{
+  (void) data;
+  free(ptr);
+}
+
+
+/**
+ * Allocator that counts allocations.
+ */
+static const struct libstring_allocator counting_allocator = {
+  count_allocate, count_reallocate, count_deallocate, NULL
+};
+
+
+
+/**
+ * Consume the result of a function that returns
+ * an allocated string, and deallocate it.
+ * 
+ * @param  s  The result.
+ */
+static void consume(void* s)
+{
+  sink += (size_t)s;
+  libstring_free(s);
+}
+
+
+#define TEXT  (c->text)
+#define SIZE  (c->size)
+#define BUF   c->buf, c->buf_size
+#define LINES (c->lines)
+#define LN    (&c->n_lines)
+#define L(i)  (c->lines[(i) % c->n_lines])
+#define VARIADIC_ARGS  L(0), L(1), L(2), L(3), L(4), L(5), L(6), L(7), NULL
+
+/**
+ * Define a benchmark of a function that
+ * returns a string allocated by the library.
+ */
+#define BENCH_NEW(NAME, CALL, BYTES)\
+  static size_t bench_##NAME(struct corpus* c) { consume(CALL); return (BYTES); }
+
+/**
+ * Define a benchmark of a function that returns a number.
+ */
+#define BENCH_VALUE(NAME, CALL, BYTES)\
+  static size_t bench_##NAME(struct corpus* c) { sink += (size_t)(CALL); return (BYTES); }
+
+
+BENCH_NEW(cat, libstring_cat(LINES, LN), SIZE)
+BENCH_NEW(cat_parallel, libstring_cat_parallel(LINES, LN, 0), SIZE)
+BENCH_VALUE(cat_into, libstring_cat_into(BUF, LINES, LN), SIZE)
+BENCH_VALUE(cat_str, libstring_cat_str(&str_out, c->strs, c->n_lines), SIZE)
+BENCH_NEW(vcat, libstring_vcat(VARIADIC_ARGS), c->variadic_size)
+BENCH_VALUE(vcat_into, libstring_vcat_into(BUF, VARIADIC_ARGS), c->variadic_size)
+BENCH_NEW(join, libstring_join(LINES, LN, "\n"), SIZE)
+BENCH_NEW(join_parallel, libstring_join_parallel(LINES, LN, "\n", 0), SIZE)
+BENCH_VALUE(join_into, libstring_join_into(BUF, LINES, LN, "\n"), SIZE)
+BENCH_VALUE(join_str, libstring_join_str(&str_out, c->strs, c->n_lines, "\n", 1), SIZE)
+BENCH_NEW(vjoin, libstring_vjoin(VARIADIC_ARGS, "\n"), c->variadic_size)
+BENCH_VALUE(vjoin_into, libstring_vjoin_into(BUF, VARIADIC_ARGS, "\n"), c->variadic_size)
+
+BENCH_NEW(split, libstring_split(TEXT, " ", NULL, 0), SIZE)
+BENCH_NEW(split_p, libstring_split_p(TEXT, &space, NULL, 0), SIZE)
+BENCH_NEW(split_spans, libstring_split_spans(TEXT, " ", NULL, 0), SIZE)
+BENCH_VALUE(split_spans_into, libstring_split_spans_into((void*)c->buf, c->buf_size / sizeof(struct libstring_span),
+							 TEXT, " ", 0), SIZE)
+BENCH_VALUE(split_spans_p_into, libstring_split_spans_p_into((void*)c->buf, c->buf_size / sizeof(struct libstring_span),
+							     TEXT, &space, 0), SIZE)
+BENCH_VALUE(split_spans_n_into, libstring_split_spans_n_into((void*)c->buf, c->buf_size / sizeof(struct libstring_span),
+							     TEXT, SIZE, &space, 0), SIZE)
+
+static size_t bench_split_iter(struct corpus* c)
+{
+  struct libstring_split_iter it;
+  const char* field;
+  size_t n;
+  libstring_split_iter_init(&it, TEXT, " ", 0);
+  while (libstring_split_iter_next(&it, &field, &n) == LIBSTRING_SPLIT_ITER_FIELD)
+    sink += n;
+  libstring_split_iter_destroy(&it);
+  return SIZE;
+}
+
+static size_t bench_split_iter_p(struct corpus* c)
+{
+  struct libstring_split_iter it;
+  const char* field;
+  size_t n;
+  libstring_split_iter_init_p(&it, TEXT, &space, 0);
+  while (libstring_split_iter_next(&it, &field, &n) == LIBSTRING_SPLIT_ITER_FIELD)
+    sink += n;
+  libstring_split_iter_destroy(&it);
+  return SIZE;
+}
+
+static size_t bench_split_iter_feed(struct corpus* c)
+{
+  struct libstring_split_iter it;
+  const char* field;
+  size_t n, off, len;
+  libstring_split_iter_init(&it, NULL, " ", 0);
+  for (off = 0; off < SIZE; off += len)
+    {
+      len = (SIZE - off < 4096 ? SIZE - off : 4096);
+      libstring_split_iter_feed(&it, TEXT + off, len, 0);
+      while (libstring_split_iter_next(&it, &field, &n) != LIBSTRING_SPLIT_ITER_MORE)
+	sink += n;
+    }
+  libstring_split_iter_feed(&it, "", 0, 1);
+  while (libstring_split_iter_next(&it, &field, &n))
+    sink += n;
+  libstring_split_iter_destroy(&it);
+  return SIZE;
+}
+
+BENCH_NEW(replace, libstring_replace(TEXT, " ", "  ", 0), SIZE)
+BENCH_VALUE(replace_into, libstring_replace_into(BUF, TEXT, " ", "  ", 0), SIZE)
+BENCH_NEW(replace_p, libstring_replace_p(TEXT, &space, "  ", 0), SIZE)
+BENCH_VALUE(replace_p_into, libstring_replace_p_into(BUF, TEXT, &space, "  ", 0), SIZE)
+BENCH_VALUE(replace_str, libstring_replace_str(&str_out, TEXT, SIZE, &space, "  ", 2, 0), SIZE)
+BENCH_NEW(replace_many, libstring_replace_many(TEXT, &replacer), SIZE)
+BENCH_VALUE(replace_many_into, libstring_replace_many_into(BUF, TEXT, &replacer), SIZE)
+BENCH_VALUE(replace_many_str, libstring_replace_many_str(&str_out, TEXT, SIZE, &replacer), SIZE)
+
+static size_t bench_replacer_initialise(struct corpus* c)
+{
+  struct libstring_replacer r;
+  (void) c;
+  if (!libstring_replacer_initialise(&r, replace_from, replace_to, replace_n, 0))
+    libstring_replacer_destroy(&r);
+  return 0;
+}
+
+static size_t bench_pattern_init(struct corpus* c)
+{
+  struct libstring_pattern pat;
+  (void) c;
+  libstring_pattern_init(&pat, "needle", 0);
+  sink += pat.length;
+  return 0;
+}
+
+static size_t bench_pattern_init_n(struct corpus* c)
+{
+  struct libstring_pattern pat;
+  (void) c;
+  libstring_pattern_init_n(&pat, "Needle", 6, LIBSTRING_PATTERN_IGNORE_CASE);
+  sink += pat.length;
+  return 0;
+}
+
+BENCH_NEW(shellsafe, libstring_shellsafe(TEXT), SIZE)
+BENCH_VALUE(shellsafe_into, libstring_shellsafe_into(BUF, TEXT), SIZE)
+BENCH_VALUE(shellsafe_str, libstring_shellsafe_str(&str_out, TEXT, SIZE), SIZE)
+BENCH_VALUE(length, libstring_length(TEXT, 0), SIZE)
+BENCH_VALUE(length_display, libstring_length(TEXT, LIBSTRING_LENGTH_DISPLAY_LENGTH), SIZE)
+BENCH_VALUE(length_n, libstring_length_n(TEXT, SIZE, LIBSTRING_LENGTH_IGNORE_COMBINING), SIZE)
+BENCH_VALUE(utf8verify, libstring_utf8verify(TEXT, 0), SIZE)
+BENCH_VALUE(utf8verify_n, libstring_utf8verify_n(TEXT, SIZE, 0), SIZE)
+
+static size_t bench_cut(struct corpus* c)
+{
+  size_t i;
+  for (i = 0; i < c->n_lines; i++)
+    consume(libstring_cut(c->lines[i], " ", cut_fields, cut_fields_n, NULL, 0));
+  return SIZE;
+}
+
+static size_t bench_cut_p(struct corpus* c)
+{
+  size_t i;
+  for (i = 0; i < c->n_lines; i++)
+    consume(libstring_cut_p(c->lines[i], &space, cut_fields, cut_fields_n, NULL, LIBSTRING_CUT_COMPLEMENT));
+  return SIZE;
+}
+
+static size_t bench_cut_spans_into(struct corpus* c)
+{
+  size_t i;
+  for (i = 0; i < c->n_lines; i++)
+    sink += libstring_cut_spans_into((void*)c->buf, c->buf_size / sizeof(struct libstring_span),
+				     c->lines[i], " ", cut_fields, cut_fields_n, 0);
+  return SIZE;
+}
+
+static size_t bench_cut_spans_p_into(struct corpus* c)
+{
+  size_t i;
+  for (i = 0; i < c->n_lines; i++)
+    sink += libstring_cut_spans_p_into((void*)c->buf, c->buf_size / sizeof(struct libstring_span),
+				       c->lines[i], &space, cut_fields, cut_fields_n, LIBSTRING_CUT_COMPLEMENT);
+  return SIZE;
+}
+
+static size_t bench_vcut(struct corpus* c)
+{
+  size_t i;
+  for (i = 0; i < c->n_lines; i++)
+    consume(libstring_vcut(c->lines[i], " ", 0, 2, 3, SIZE_MAX, NULL, LIBSTRING_CUT_REVERSED));
+  return SIZE;
+}
+
+BENCH_NEW(substring, libstring_substring(TEXT, 16, SIZE / 2, 0), SIZE)
+BENCH_VALUE(substring_into, libstring_substring_into(BUF, TEXT, 16, SIZE / 2, 0), SIZE)
+BENCH_VALUE(substring_str, libstring_substring_str(&str_out, TEXT, SIZE, 16, SIZE / 2, 0), SIZE)
+BENCH_NEW(trim, libstring_trim(TEXT, NULL, LIBSTRING_TRIM_DUPLICATES), SIZE)
+BENCH_VALUE(trim_into, libstring_trim_into(BUF, TEXT, NULL, LIBSTRING_TRIM_DUPLICATES), SIZE)
+BENCH_VALUE(trim_str, libstring_trim_str(&str_out, TEXT, SIZE, NULL, LIBSTRING_TRIM_DUPLICATES), SIZE)
+BENCH_NEW(reverse, libstring_reverse(TEXT, 0), SIZE)
+BENCH_NEW(reverse_clusters, libstring_reverse(TEXT, LIBSTRING_REVERSE_KEEP_COMBINING), SIZE)
+BENCH_VALUE(reverse_into, libstring_reverse_into(BUF, TEXT, LIBSTRING_REVERSE_KEEP_COMBINING), SIZE)
+BENCH_VALUE(reverse_str, libstring_reverse_str(&str_out, TEXT, SIZE, LIBSTRING_REVERSE_KEEP_COMBINING), SIZE)
+BENCH_NEW(anagram, libstring_anagram(TEXT, &anagram_state, 0), SIZE)
+BENCH_NEW(anagram_clusters, libstring_anagram(TEXT, &anagram_state, LIBSTRING_ANAGRAM_KEEP_COMBINING), SIZE)
+BENCH_VALUE(anagram_into, libstring_anagram_into(BUF, TEXT, &anagram_state, LIBSTRING_ANAGRAM_KEEP_COMBINING), SIZE)
+BENCH_VALUE(anagram_str, libstring_anagram_str(&str_out, TEXT, SIZE, &anagram_state, LIBSTRING_ANAGRAM_KEEP_COMBINING), SIZE)
+
+/**
+ * Define benchmarks of a transform's
+ * allocating, `_into`, and `_str` forms.
+ */
+#define BENCH_TRANSFORM(NAME)\
+  BENCH_NEW(NAME, libstring_##NAME(TEXT), SIZE)\
+  BENCH_VALUE(NAME##_into, libstring_##NAME##_into(BUF, TEXT), SIZE)\
+  BENCH_VALUE(NAME##_str, libstring_##NAME##_str(&str_out, TEXT, SIZE), SIZE)
+
+/**
+ * Define a benchmark of a transform's `_inplace` form.
+ */
+#define BENCH_INPLACE(NAME)\
+  BENCH_VALUE(NAME##_inplace, libstring_##NAME##_inplace(c->work, &c->size), SIZE)
+
+/**
+ * Define a benchmark of a transform's `_batch` form.
+ */
+#define BENCH_BATCH(NAME)\
+  static size_t bench_##NAME##_batch(struct corpus* c)\
+  {\
+    struct libstring_batch b;\
+    if (!libstring_##NAME##_batch(&b, LINES, c->n_lines))\
+      libstring_batch_destroy(&b);\
+    return SIZE;\
+  }
+
+BENCH_TRANSFORM(lcase)
+BENCH_INPLACE(lcase)
+BENCH_BATCH(lcase)
+BENCH_TRANSFORM(ucase)
+BENCH_INPLACE(ucase)
+BENCH_BATCH(ucase)
+BENCH_TRANSFORM(capitalise)
+BENCH_INPLACE(capitalise)
+BENCH_TRANSFORM(swapcase)
+BENCH_INPLACE(swapcase)
+BENCH_TRANSFORM(unexpand)
+BENCH_TRANSFORM(rot13)
+BENCH_INPLACE(rot13)
+BENCH_BATCH(rot13)
+BENCH_TRANSFORM(double_rot13)
+BENCH_NEW(expand, libstring_expand(TEXT, 0), SIZE)
+BENCH_VALUE(expand_into, libstring_expand_into(BUF, TEXT, 0), SIZE)
+BENCH_VALUE(expand_str, libstring_expand_str(&str_out, TEXT, SIZE, 0), SIZE)
+
+static size_t bench_trim_batch(struct corpus* c)
+{
+  struct libstring_batch b;
+  if (!libstring_trim_batch(&b, LINES, c->n_lines, NULL, 0))
+    libstring_batch_destroy(&b);
+  return SIZE;
+}
+
+static size_t bench_replace_batch(struct corpus* c)
+{
+  struct libstring_batch b;
+  if (!libstring_replace_batch(&b, LINES, c->n_lines, &space, "  ", 0))
+    libstring_batch_destroy(&b);
+  return SIZE;
+}
+
+static size_t bench_str_reserve(struct corpus* c)
+{
+  struct libstring_str s = {NULL, 0, 0};
+  size_t n;
+  for (n = 16; n <= SIZE; n *= 2)
+    libstring_str_reserve(&s, n);
+  libstring_str_destroy(&s);
+  return 0;
+}
+
+static size_t bench_builder_append(struct corpus* c)
+{
+  struct libstring_builder b;
+  size_t i;
+  libstring_builder_initialise(&b);
+  for (i = 0; i < c->n_lines; i++)
+    {
+      libstring_builder_append(&b, c->lines[i]);
+      libstring_builder_append_char(&b, '\n', 1);
+    }
+  consume(libstring_builder_finalise(&b));
+  return SIZE;
+}
+
+static size_t bench_builder_append_n(struct corpus* c)
+{
+  struct libstring_builder b;
+  size_t i;
+  libstring_builder_initialise(&b);
+  libstring_builder_reserve(&b, SIZE + c->n_lines);
+  for (i = 0; i < c->n_lines; i++)
+    libstring_builder_append_n(&b, c->strs[i].ptr, c->strs[i].len + 1);
+  libstring_builder_destroy(&b);
+  return SIZE;
+}
+
+static size_t bench_builder_append_join(struct corpus* c)
+{
+  struct libstring_builder b;
+  libstring_builder_initialise(&b);
+  libstring_builder_append_join(&b, LINES, LN, "\n");
+  libstring_builder_destroy(&b);
+  return SIZE;
+}
+
+static size_t bench_builder_append_numbers(struct corpus* c)
+{
+  struct libstring_builder b;
+  long long int i;
+  (void) c;
+  libstring_builder_initialise(&b);
+  for (i = -500; i < 500; i++)
+    {
+      libstring_builder_append_int(&b, i * 1000003);
+      libstring_builder_append_uint(&b, (unsigned long long int)i * 7919ULL);
+    }
+  libstring_builder_destroy(&b);
+  return 0;
+}
+
+static size_t bench_builder_append_format(struct corpus* c)
+{
+  struct libstring_builder b;
+  size_t i;
+  libstring_builder_initialise(&b);
+  for (i = 0; i < c->n_lines; i++)
+    libstring_builder_append_format(&b, "%zu: %s\n", i, c->lines[i]);
+  libstring_builder_destroy(&b);
+  return SIZE;
+}
+
+static size_t bench_builder_commit(struct corpus* c)
+{
+  struct libstring_builder b;
+  size_t i, n;
+  libstring_builder_initialise(&b);
+  for (i = 0; i < c->n_lines; i++)
+    do
+      n = libstring_lcase_into(b.ptr + b.len, b.cap - b.len, c->lines[i]);
+    while (libstring_builder_commit(&b, n) > 0);
+  libstring_builder_destroy(&b);
+  return SIZE;
+}
+
+static size_t bench_arena(struct corpus* c)
+{
+  struct libstring_arena arena;
+  const struct libstring_allocator* old;
+  size_t i;
+  libstring_arena_initialise(&arena, 0);
+  old = libstring_set_allocator(&arena.allocator);
+  for (i = 0; i < c->n_lines; i++)
+    {
+      sink += (size_t)libstring_split_p(c->lines[i], &space, NULL, 0);
+      libstring_arena_reset(&arena);
+    }
+  libstring_set_allocator(old);
+  libstring_arena_destroy(&arena);
+  return SIZE;
+}
+
+
+#define B(NAME)  {#NAME, bench_##NAME}
+
+/**
+ * The benchmarks.
+ */
+static const struct bench benches[] = {
+  B(cat), B(cat_parallel), B(cat_into), B(cat_str), B(vcat), B(vcat_into),
+  B(join), B(join_parallel), B(join_into), B(join_str), B(vjoin), B(vjoin_into),
+  B(pattern_init), B(pattern_init_n),
+  B(split), B(split_p), B(split_spans), B(split_spans_into), B(split_spans_p_into),
+  B(split_spans_n_into), B(split_iter), B(split_iter_p), B(split_iter_feed),
+  B(replace), B(replace_into), B(replace_p), B(replace_p_into), B(replace_str), B(replace_batch),
+  B(replacer_initialise), B(replace_many), B(replace_many_into), B(replace_many_str),
+  B(shellsafe), B(shellsafe_into), B(shellsafe_str),
+  B(length), B(length_display), B(length_n), B(utf8verify), B(utf8verify_n),
+  B(cut), B(cut_p), B(cut_spans_into), B(cut_spans_p_into), B(vcut),
+  B(substring), B(substring_into), B(substring_str),
+  B(trim), B(trim_into), B(trim_str), B(trim_batch),
+  B(reverse), B(reverse_clusters), B(reverse_into), B(reverse_str),
+  B(anagram), B(anagram_clusters), B(anagram_into), B(anagram_str),
+  B(lcase), B(lcase_into), B(lcase_inplace), B(lcase_str), B(lcase_batch),
+  B(ucase), B(ucase_into), B(ucase_inplace), B(ucase_str), B(ucase_batch),
+  B(capitalise), B(capitalise_into), B(capitalise_inplace), B(capitalise_str),
+  B(swapcase), B(swapcase_into), B(swapcase_inplace), B(swapcase_str),
+  B(expand), B(expand_into), B(expand_str), B(unexpand), B(unexpand_into), B(unexpand_str),
+  B(rot13), B(rot13_into), B(rot13_inplace), B(rot13_str), B(rot13_batch),
+  B(double_rot13), B(double_rot13_into), B(double_rot13_str),
+  B(str_reserve), B(builder_append), B(builder_append_n), B(builder_append_join),
+  B(builder_append_numbers), B(builder_append_format), B(builder_commit), B(arena),
+};
+
+#undef B
+
+/**
+ * The corpora.
+ */
+static struct corpus corpora[] = {
+  {.name = "ascii",     .word = word_ascii},
+  {.name = "latin1",    .word = word_latin1},
+  {.name = "cjk",       .word = word_cjk},
+  {.name = "emoji",     .word = word_emoji},
+  {.name = "combining", .word = word_combining},
+  {.name = "invalid",   .word = word_invalid},
+};
+
+
+
+/**
+ * Get the current time.
+ * 
+ * @return  The time, in seconds.
+ */
+static double now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+
+/**
+ * Run a benchmark on a corpus, and print the result.
+ * 
+ * @param  b         The benchmark.
+ * @param  c         The corpus.
+ * @param  min_time  The least time to run the benchmark, in seconds.
+ * @param  first     Whether this is the first result printed.
+ */
+static void run(const struct bench* b, struct corpus* c, double min_time, int first)
+{
+  size_t calls = 0, batch = 1, i, bytes = 0;
+  double start, elapsed;
+  
+  memcpy(c->work, c->text, c->size + 1);
+  b->run(c);
+  
+  allocations = 0;
+  start = now();
+  do
+    {
+      for (i = 0; i < batch; i++)
+	bytes = b->run(c);
+      calls += batch;
+      batch *= 2;
+      elapsed = now() - start;
+    }
+  while (elapsed < min_time);
+  libstring_str_destroy(&str_out);
+  
+  printf("%s\n    {\"function\": \"%s\", \"corpus\": \"%s\", \"calls\": %zu, \"bytes_per_call\": %zu, ",
+	 first ? "" : ",", b->name, c->name, calls, bytes);
+  if (bytes > 0)
+    printf("\"mb_per_s\": %.2f, ", (double)bytes * (double)calls / elapsed / 1e6);
+  else
+    printf("\"mb_per_s\": null, ");
+  printf("\"ns_per_call\": %.1f, \"allocations_per_call\": %.3f}",
+	 elapsed * 1e9 / (double)calls, (double)allocations / (double)calls);
+  fflush(stdout);
+}
+
+
+int main(int argc, char* argv[])
+{
+  const char* bench_filter = "";
+  const char* corpus_filter = "";
+  size_t size = 1 << 20, i, j;
+  long ms = 200;
+  int c, list = 0, first = 1;
+  char* end;
+  
+  while ((c = getopt(argc, argv, "c:f:ls:t:")) != -1)
+    switch (c)
+      {
+      case 'c':  corpus_filter = optarg;  break;
+      case 'f':  bench_filter = optarg;   break;
+      case 'l':  list = 1;                break;
+      case 's':
+	size = (size_t)strtoul(optarg, &end, 10);
+	if (*end || (size < 1024))
+	  goto usage;
+	break;
+      case 't':
+	ms = strtol(optarg, &end, 10);
+	if (*end || (ms < 1))
+	  goto usage;
+	break;
+      default:
+	goto usage;
+      }
+  if (optind != argc)
+    goto usage;
+  
+  if (list)
+    {
+      for (i = 0; i < sizeof(benches) / sizeof(*benches); i++)
+	printf("%s\n", benches[i].name);
+      printf("\n");
+      for (j = 0; j < sizeof(corpora) / sizeof(*corpora); j++)
+	printf("%s\n", corpora[j].name);
+      return 0;
+    }
+  
+  libstring_set_allocator(&counting_allocator);
+  libstring_pattern_init(&space, " ", 0);
+  if (libstring_replacer_initialise(&replacer, replace_from, replace_to, replace_n, 0))
+    return perror(*argv), 1;
+  
+  printf("{\n  \"corpus_size\": %zu,\n  \"min_time_ms\": %ld,\n  \"results\": [", size, ms);
+  for (j = 0; j < sizeof(corpora) / sizeof(*corpora); j++)
+    {
+      if (!strstr(corpora[j].name, corpus_filter))
+	continue;
+      generate(&corpora[j], size);
+      for (i = 0; i < sizeof(benches) / sizeof(*benches); i++)
+	if (strstr(benches[i].name, bench_filter))
+	  run(&benches[i], &corpora[j], (double)ms / 1000, first), first = 0;
+    }
+  printf("\n  ]\n}\n");
+  
+  libstring_replacer_destroy(&replacer);
+  return 0;
+  
+ usage:
+  fprintf(stderr, "usage: %s [-l] [-s size] [-t milliseconds] [-f function] [-c corpus]\n", *argv);
+  return 2;
+}
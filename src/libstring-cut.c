@@ -0,0 +1,631 @@
+/**
+ * libstring — String manipulation library
+ * 
+ * Copyright © 2015  Mattias Andrée (m@maandree.se)
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Selects fields from each line of a file, like cut(1), with `libstring_cut_p`:
+ * 
+ *   libstring-cut [-criRst] [-d delimiter] [-o delimiter] [-j threads] -f list [file]
+ * 
+ *   -d  The delimiter, a tab by default. It may be longer than one byte.
+ *   -f  The fields to select, counted from 1, as a comma-separated list
+ *       of fields and ranges, for example 1,3-5. Ranges must be closed.
+ *   -o  The delimiter to put between the selected fields, -d by default.
+ *   -c  Select all fields except the listed ones, `LIBSTRING_CUT_COMPLEMENT`.
+ *   -r  Count the fields from the right, `LIBSTRING_CUT_REVERSED`.
+ *   -R  Match the delimiter from the right, `LIBSTRING_CUT_FROM_RIGHT`.
+ *   -i  Ignore case when matching the delimiter, `LIBSTRING_CUT_IGNORE_CASE`.
+ *   -s  Output the fields in sorted order, `LIBSTRING_CUT_ORDERED`.
+ *   -j  The number of threads, the number of online processors by default.
+ *   -t  Print the time taken, and the throughput, to standard error.
+ * 
+ * The input is mapped into memory, or read into memory if it cannot be
+ * mapped, and split into chunks that end at a newline. The threads take
+ * the chunks in order, cut each line into a buffer for the chunk, and the
+ * main thread writes the buffers in order, so the output is the same as
+ * if one thread had processed the whole input. At most twice as many
+ * chunks as there are threads are held in memory at a time. A line ends
+ * at its first NUL byte, if it has any. Unlike cut(1), a line without
+ * the delimiter is one field, rather than output whole.
+ * 
+ * Build it together with the library:
+ * 
+ *   cc -O2 -pthread -o libstring-cut libstring-cut.c libstring.c
+ * 
+ * or run `make libstring-cut` in the top directory.
+ */
+#define _POSIX_C_SOURCE  200112L
+#include "libstring.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+/**
+ * The number of bytes in a chunk, before it is
+ * extended to the end of its last line.
+ */
+#define CHUNK_SIZE  (4 << 20)
+
+
+
+/**
+ * The output buffer for a chunk.
+ */
+struct slot
+{
+  /**
+   * The output of the chunk.
+   */
+  struct libstring_builder out;
+  
+  /**
+   * Whether the chunk has been processed.
+   */
+  int done;
+  
+  /**
+   * Whether processing the chunk failed.
+   */
+  int failed;
+  
+  /**
+   * The error that processing the chunk failed with.
+   */
+  int error;
+};
+
+
+/**
+ * The state shared between the threads.
+ */
+struct job
+{
+  /**
+   * The input.
+   */
+  const char* data;
+  
+  /**
+   * The offsets of the chunks in `data`, followed
+   * by the size of `data`. `chunks + 1` entries.
+   */
+  size_t* bounds;
+  
+  /**
+   * The number of chunks.
+   */
+  size_t chunks;
+  
+  /**
+   * The delimiter.
+   */
+  struct libstring_pattern delimiter;
+  
+  /**
+   * The delimiter to put between selected fields.
+   */
+  const char* output_delimiter;
+  
+  /**
+   * The selected fields, counted from 0.
+   */
+  size_t* fields;
+  
+  /**
+   * The number of elements in `fields`.
+   */
+  size_t fields_n;
+  
+  /**
+   * The flags for `libstring_cut_p`.
+   */
+  enum libstring_cut flags;
+  
+  /**
+   * The output buffers, chunk `i` uses
+   * slot `i % window`.
+   */
+  struct slot* slots;
+  
+  /**
+   * The number of elements in `slots`.
+   */
+  size_t window;
+  
+  /**
+   * The next chunk to take.
+   */
+  size_t next;
+  
+  /**
+   * The number of chunks that have been written.
+   */
+  size_t written;
+  
+  /**
+   * Protects `next`, `written` and the
+   * `done` members of `slots`.
+   */
+  pthread_mutex_t mutex;
+  
+  /**
+   * Signalled when a chunk has been
+   * processed or written.
+   */
+  pthread_cond_t cond;
+};
+
+
+/**
+ * The name of the program.
+ */
+static const char* argv0;
+
+
+
+/**
+ * Print usage information and exit.
+ */
+static void usage(void)
+{
+  fprintf(stderr, "usage: %s [-criRst] [-d delimiter] [-o delimiter] [-j threads] -f list [file]\n", argv0);
+  exit(2);
+}
+
+
+/**
+ * Parse a number in a field list.
+ * 
+ * @param   s    The text to parse, updated to
+ *               point to the end of the number.
+ * @param   out  Output parameter for the number.
+ * @return       0 on success, -1 if there is no
+ *               number or it is out of range.
+ */
+static int parse_number(const char** s, size_t* out)
+{
+  size_t value = 0;
+  if ((**s < '0') || (**s > '9'))
+    return -1;
+  for (; (**s >= '0') && (**s <= '9'); (*s)++)
+    {
+      if (value > (SIZE_MAX - 9) / 10)
+	return -1;
+      value = value * 10 + (size_t)(**s - '0');
+    }
+  *out = value;
+  return 0;
+}
+
+
+/**
+ * Parse a field list, such as "1,3-5".
+ * 
+ * @param   list  The field list, counted from 1.
+ * @param   n     Output parameter for the number of fields.
+ * @return        The fields, counted from 0. `NULL` on error.
+ * 
+ * @throws  EINVAL  The field list is invalid.
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+static size_t* parse_fields(const char* list, size_t* n)
+{
+  size_t* fields = NULL;
+  size_t* new;
+  size_t first, last, cap = 0;
+  
+  for (*n = 0;; list++)
+    {
+      if (parse_number(&list, &first) || (first == 0))
+	goto invalid;
+      last = first;
+      if ((*list == '-') && (list++, parse_number(&list, &last) || (last < first)))
+	goto invalid;
+      for (; first <= last; first++)
+	{
+	  if (*n == cap)
+	    {
+	      cap = cap ? (cap << 1) : 16;
+	      new = realloc(fields, cap * sizeof(size_t));
+	      if (new == NULL)
+		return free(fields), NULL;
+	      fields = new;
+	    }
+	  fields[(*n)++] = first - 1;
+	}
+      if (*list != ',')
+	break;
+    }
+  if (*list == '\0')
+    return fields;
+  
+ invalid:
+  free(fields);
+  errno = EINVAL;
+  return NULL;
+}
+
+
+/**
+ * Cut each line in a chunk.
+ * 
+ * @param   job    The shared state.
+ * @param   chunk  The index of the chunk.
+ * @param   arena  The arena to allocate the fields in.
+ * @param   line   Buffer for a NUL-terminated copy of the
+ *                 line, may be reallocated.
+ * @param   cap    The allocation size of `*line`.
+ * @return         0 on success, -1 on error.
+ */
+static int cut_chunk(struct job* job, size_t chunk, struct libstring_arena* arena, char** line, size_t* cap)
+{
+  struct libstring_builder* out = &job->slots[chunk % job->window].out;
+  const char* p = job->data + job->bounds[chunk];
+  const char* end = job->data + job->bounds[chunk + 1];
+  const char* e;
+  const struct libstring_allocator* old;
+  char** fields;
+  size_t n, len;
+  char* new;
+  int r;
+  
+  out->len = 0;
+  for (; p < end; p = e + 1)
+    {
+      e = memchr(p, '\n', (size_t)(end - p));
+      e = (e == NULL ? end : e);
+      len = (size_t)(e - p);
+      if (len >= *cap)
+	{
+	  new = realloc(*line, len + 1);
+	  if (new == NULL)
+	    return -1;
+	  *line = new, *cap = len + 1;
+	}
+      memcpy(*line, p, len);
+      (*line)[len] = '\0';
+  
+      /* Only the fields are allocated in the arena, the output is not. */
+      old = libstring_set_allocator(&arena->allocator);
+      fields = libstring_cut_p(*line, &job->delimiter, job->fields, job->fields_n, &n, job->flags);
+      libstring_set_allocator(old);
+      r = ((fields == NULL) ||
+	   libstring_builder_append_join(out, (const char* const*)fields, &n, job->output_delimiter) ||
+	   libstring_builder_append_char(out, '\n', 1));
+      libstring_arena_reset(arena);
+      if (r)
+	return -1;
+    }
+  return 0;
+}
+
+
+/**
+ * Process chunks until there are none left.
+ * 
+ * @param   data  The shared state.
+ * @return        `NULL`.
+ */
+static void* worker(void* data)
+{
+  struct job* job = data;
+  struct libstring_arena arena;
+  struct slot* slot;
+  char* line = NULL;
+  size_t cap = 0, chunk;
+  int failed, error;
+  
+  libstring_arena_initialise(&arena, 0);
+  for (;;)
+    {
+      pthread_mutex_lock(&job->mutex);
+      while ((job->next < job->chunks) && (job->next >= job->written + job->window))
+	pthread_cond_wait(&job->cond, &job->mutex);
+      chunk = job->next;
+      if (chunk < job->chunks)
+	job->next++;
+      pthread_mutex_unlock(&job->mutex);
+      if (chunk >= job->chunks)
+	break;
+  
+      failed = cut_chunk(job, chunk, &arena, &line, &cap) ? 1 : 0;
+      error = errno;
+  
+      pthread_mutex_lock(&job->mutex);
+      slot = &job->slots[chunk % job->window];
+      slot->failed = failed;
+      slot->error = error;
+      slot->done = 1;
+      pthread_cond_broadcast(&job->cond);
+      pthread_mutex_unlock(&job->mutex);
+    }
+  
+  free(line);
+  libstring_arena_destroy(&arena);
+  return NULL;
+}
+
+
+/**
+ * Write the chunks' output in order, as they are processed.
+ * 
+ * @param   job  The shared state.
+ * @return       0 on success, -1 on error.
+ */
+static int write_chunks(struct job* job)
+{
+  struct slot* slot;
+  size_t chunk;
+  int rc = 0;
+  
+  for (chunk = 0; chunk < job->chunks; chunk++)
+    {
+      slot = &job->slots[chunk % job->window];
+      pthread_mutex_lock(&job->mutex);
+      while (!slot->done)
+	pthread_cond_wait(&job->cond, &job->mutex);
+      pthread_mutex_unlock(&job->mutex);
+  
+      /* Keep taking chunks after an error, so that the threads finish. */
+      if (slot->failed)
+	errno = slot->error, rc = -1;
+      else if (!rc && (fwrite(slot->out.ptr, 1, slot->out.len, stdout) != slot->out.len))
+	rc = -1;
+  
+      pthread_mutex_lock(&job->mutex);
+      slot->done = 0;
+      job->written++;
+      pthread_cond_broadcast(&job->cond);
+      pthread_mutex_unlock(&job->mutex);
+    }
+  return rc;
+}
+
+
+/**
+ * Map a file into memory, or read it into
+ * memory if it cannot be mapped.
+ * 
+ * @param   path    The file, `NULL` or "-" for standard input.
+ * @param   size    Output parameter for the size of the file.
+ * @param   mapped  Output parameter for whether the file was
+ *                  mapped, rather than read into an allocation.
+ * @return          The contents of the file, `NULL` on error.
+ */
+static char* load(const char* path, size_t* size, int* mapped)
+{
+  struct stat attr;
+  char* data = NULL;
+  char* new;
+  size_t cap = 0;
+  ssize_t r;
+  int fd = STDIN_FILENO, saved_errno;
+  
+  *size = 0;
+  *mapped = 0;
+  if ((path != NULL) && strcmp(path, "-"))
+    if ((fd = open(path, O_RDONLY)) < 0)
+      return NULL;
+  
+  if (!fstat(fd, &attr) && S_ISREG(attr.st_mode) && (attr.st_size > 0))
+    {
+      data = mmap(NULL, (size_t)attr.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED)
+	{
+	  posix_madvise(data, (size_t)attr.st_size, POSIX_MADV_SEQUENTIAL);
+	  *size = (size_t)attr.st_size;
+	  *mapped = 1;
+	  goto done;
+	}
+      data = NULL;
+    }
+  
+  for (;;)
+    {
+      if (*size == cap)
+	{
+	  cap = cap ? (cap << 1) : CHUNK_SIZE;
+	  new = realloc(data, cap);
+	  if (new == NULL)
+	    goto fail;
+	  data = new;
+	}
+      r = read(fd, data + *size, cap - *size);
+      if (r < 0)
+	{
+	  if (errno == EINTR)
+	    continue;
+	  goto fail;
+	}
+      if (r == 0)
+	break;
+      *size += (size_t)r;
+    }
+  
+ done:
+  if (fd != STDIN_FILENO)
+    close(fd);
+  return data;
+  
+ fail:
+  saved_errno = errno;
+  free(data);
+  if (fd != STDIN_FILENO)
+    close(fd);
+  errno = saved_errno;
+  return NULL;
+}
+
+
+/**
+ * Split the input into chunks that end at a newline.
+ * 
+ * @param   data  The input.
+ * @param   size  The size of `data`.
+ * @param   n     Output parameter for the number of chunks.
+ * @return        The offsets of the chunks, followed by `size`.
+ *                `NULL` on error.
+ */
+static size_t* split_chunks(const char* data, size_t size, size_t* n)
+{
+  size_t* bounds = malloc((size / CHUNK_SIZE + 2) * sizeof(size_t));
+  const char* nl;
+  size_t at = 0;
+  
+  if (bounds == NULL)
+    return NULL;
+  for (*n = 0; at < size; (*n)++)
+    {
+      bounds[*n] = at;
+      at = (size - at > CHUNK_SIZE ? at + CHUNK_SIZE : size);
+      if ((at < size) && ((nl = memchr(data + at, '\n', size - at)) != NULL))
+	at = (size_t)(nl - data) + 1;
+      else
+	at = size;
+    }
+  bounds[*n] = size;
+  return bounds;
+}
+
+
+int main(int argc, char* argv[])
+{
+  struct job job;
+  pthread_t* threads = NULL;
+  const char* delimiter = "\t";
+  const char* list = NULL;
+  const char* path;
+  struct timespec start, stop;
+  char* data;
+  char* end;
+  size_t size, i, started;
+  long threads_n = 0;
+  int mapped, timed = 0, c, rc = 1;
+  double seconds;
+  
+  argv0 = argv[0] ? argv[0] : "libstring-cut";
+  memset(&job, 0, sizeof(job));
+  
+  while ((c = getopt(argc, argv, "cd:f:ij:o:rRst")) != -1)
+    switch (c)
+      {
+      case 'c':  job.flags |= LIBSTRING_CUT_COMPLEMENT;   break;
+      case 'd':  delimiter = optarg;                      break;
+      case 'f':  list = optarg;                           break;
+      case 'i':  job.flags |= LIBSTRING_CUT_IGNORE_CASE;  break;
+      case 'o':  job.output_delimiter = optarg;           break;
+      case 'r':  job.flags |= LIBSTRING_CUT_REVERSED;     break;
+      case 'R':  job.flags |= LIBSTRING_CUT_FROM_RIGHT;   break;
+      case 's':  job.flags |= LIBSTRING_CUT_ORDERED;      break;
+      case 't':  timed = 1;                               break;
+      case 'j':
+	threads_n = strtol(optarg, &end, 10);
+	if (*end || (threads_n < 1) || (threads_n > 4096))
+	  usage();
+	break;
+      default:
+	usage();
+      }
+  if ((list == NULL) || (*delimiter == '\0') || (argc - optind > 1))
+    usage();
+  path = (argc > optind ? argv[optind] : NULL);
+  if (job.output_delimiter == NULL)
+    job.output_delimiter = delimiter;
+  if (threads_n == 0)
+    if ((threads_n = sysconf(_SC_NPROCESSORS_ONLN)) < 1)
+      threads_n = 1;
+  
+  job.fields = parse_fields(list, &job.fields_n);
+  if (job.fields == NULL)
+    {
+      if (errno == EINVAL)
+	fprintf(stderr, "%s: invalid field list: %s\n", argv0, list);
+      else
+	perror(argv0);
+      return 1;
+    }
+  libstring_pattern_init(&job.delimiter, delimiter,
+			 (job.flags & LIBSTRING_CUT_IGNORE_CASE) ? LIBSTRING_PATTERN_IGNORE_CASE : 0);
+  
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  data = load(path, &size, &mapped);
+  if (data == NULL)
+    {
+      fprintf(stderr, "%s: %s: %s\n", argv0, path ? path : "-", strerror(errno));
+      free(job.fields);
+      return 1;
+    }
+  
+  job.data = data;
+  job.bounds = split_chunks(data, size, &job.chunks);
+  job.window = 2 * (size_t)threads_n;
+  job.slots = calloc(job.window, sizeof(*job.slots));
+  threads = malloc((size_t)threads_n * sizeof(*threads));
+  if ((job.bounds == NULL) || (job.slots == NULL) || (threads == NULL))
+    {
+      perror(argv0);
+      goto cleanup;
+    }
+  pthread_mutex_init(&job.mutex, NULL);
+  pthread_cond_init(&job.cond, NULL);
+  
+  for (started = 0; started < (size_t)threads_n; started++)
+    if ((errno = pthread_create(threads + started, NULL, worker, &job)))
+      break;
+  if ((started == 0) || write_chunks(&job))
+    perror(argv0);
+  else
+    rc = 0;
+  for (i = 0; i < started; i++)
+    pthread_join(threads[i], NULL);
+  if (fflush(stdout) && !rc)
+    perror(argv0), rc = 1;
+  pthread_cond_destroy(&job.cond);
+  pthread_mutex_destroy(&job.mutex);
+  
+  if (timed)
+    {
+      clock_gettime(CLOCK_MONOTONIC, &stop);
+      seconds = (double)(stop.tv_sec - start.tv_sec) + (double)(stop.tv_nsec - start.tv_nsec) / 1e9;
+      fprintf(stderr, "%zu bytes in %.3f s, %.1f MB/s, %ld threads\n",
+	      size, seconds, seconds > 0 ? (double)size / seconds / 1e6 : 0.0, threads_n);
+    }
+  
+ cleanup:
+  if (job.slots != NULL)
+    for (i = 0; i < job.window; i++)
+      libstring_builder_destroy(&job.slots[i].out);
+  free(job.slots);
+  free(threads);
+  free(job.bounds);
+  free(job.fields);
+  if (mapped)
+    munmap(data, size);
+  else
+    free(data);
+  return rc;
+}
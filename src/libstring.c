@@ -19,848 +19,7857 @@
 #include "libstring.h"
 #include <string.h>
 #include <stdlib.h>
-#include <ctypes.h>
 #include <stdarg.h>
+#include <stdio.h>
 #include <errno.h>
 #include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <time.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define HAVE_X86_SIMD
+# include <immintrin.h>
+#endif
+#ifdef LIBSTRING_PROBES
+# include <sys/sdt.h>
+#endif
+#include "unicode-tables.h"
 
 
 
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+# define THREAD_LOCAL  _Thread_local
+#else
+# define THREAD_LOCAL  __thread
+#endif
+
+
+
+/**
+ * The allocator selected in the calling thread,
+ * `NULL` for `malloc`, `realloc` and `free`.
+ */
+static THREAD_LOCAL const struct libstring_allocator* allocator = NULL;
+
+
+
+#ifdef LIBSTRING_STATS
+# ifndef __GNUC__
+#  error "LIBSTRING_STATS requires GCC or a compatible compiler"
+# endif
+
+
+/**
+ * The functions that have performance counters,
+ * in the order `libstring_stats_snapshot` lists them.
+ * 
+ * Functions that only initialise or release an object,
+ * or select the allocator, are not counted.
+ */
+# define LIST_STATS_FUNCTIONS(X)\
+  X(cat) X(cat_parallel) X(cat_into) X(cat_str) X(vcat) X(vcat_into)\
+  X(join) X(join_parallel) X(join_into) X(join_str) X(vjoin) X(vjoin_into)\
+  X(split) X(split_p) X(split_spans) X(split_spans_into) X(split_spans_p_into)\
+  X(split_spans_n_into) X(split_iter_feed) X(split_iter_next)\
+  X(replace) X(replace_into) X(replace_p) X(replace_p_into) X(replace_str) X(replace_batch)\
+  X(replacer_initialise) X(replace_many) X(replace_many_into) X(replace_many_str)\
+  X(shellsafe) X(shellsafe_into) X(shellsafe_str)\
+  X(length) X(length_n) X(utf8verify) X(utf8verify_n) X(cut) X(cut_p) X(vcut)\
+  X(cut_spans_into) X(cut_spans_p_into)\
+  X(substring) X(substring_into) X(substring_str)\
+  X(trim) X(trim_into) X(trim_str) X(trim_batch)\
+  X(reverse) X(reverse_into) X(reverse_str) X(anagram) X(anagram_into) X(anagram_str)\
+  X(lcase) X(lcase_into) X(lcase_inplace) X(lcase_str) X(lcase_batch)\
+  X(ucase) X(ucase_into) X(ucase_inplace) X(ucase_str) X(ucase_batch)\
+  X(capitalise) X(capitalise_into) X(capitalise_inplace) X(capitalise_str)\
+  X(swapcase) X(swapcase_into) X(swapcase_inplace) X(swapcase_str)\
+  X(expand) X(expand_into) X(expand_str) X(unexpand) X(unexpand_into) X(unexpand_str)\
+  X(rot13) X(rot13_into) X(rot13_inplace) X(rot13_str) X(rot13_batch)\
+  X(double_rot13) X(double_rot13_into) X(double_rot13_str) X(str_reserve)\
+  X(builder_reserve) X(builder_append) X(builder_append_n) X(builder_append_char)\
+  X(builder_append_uint) X(builder_append_int) X(builder_append_format)\
+  X(builder_append_join) X(builder_commit) X(builder_finalise)
+
+
+/**
+ * Indices of the counted functions.
+ */
+enum stats_function
+{
+# define X(NAME)  stats_##NAME,
+  LIST_STATS_FUNCTIONS(X)
+# undef X
+  STATS_FUNCTIONS
+};
+
+
+/**
+ * Indices of the counters of a function,
+ * in the order of `struct libstring_stats`.
+ */
+enum stats_counter
+{
+  COUNTER_CALLS,
+  COUNTER_INPUT_BYTES,
+  COUNTER_OUTPUT_BYTES,
+  COUNTER_ALLOCATIONS,
+  COUNTER_ALLOCATION_FAILURES,
+  STATS_COUNTERS
+};
+
+
+/**
+ * The names of the counted functions.
+ */
+static const char* const stats_names[] =
+{
+# define X(NAME)  "libstring_" #NAME,
+  LIST_STATS_FUNCTIONS(X)
+# undef X
+};
+
+
+/**
+ * The counters of one thread.
+ * 
+ * A block is only written by the thread that owns
+ * it, so counting needs neither locks nor atomic
+ * read-modify-write instructions. When the thread
+ * exits, the block is released for reuse by another
+ * thread, keeping its counts, so blocks are never
+ * deallocated.
+ */
+struct stats_block
+{
+  /**
+   * The next block in `stats_blocks`.
+   */
+  struct stats_block* next;
+  
+  /**
+   * Whether a thread owns the block.
+   */
+  int in_use;
+  
+  /**
+   * The counts since the block was created.
+   */
+  unsigned long long int counts[STATS_FUNCTIONS][STATS_COUNTERS];
+  
+  /**
+   * The counts at the last `libstring_stats_reset`.
+   * Only accessed with `stats_mutex` held.
+   */
+  unsigned long long int base[STATS_FUNCTIONS][STATS_COUNTERS];
+};
+
+
+/**
+ * All blocks ever created.
+ */
+static struct stats_block* stats_blocks = NULL;
+
+/**
+ * Protects `stats_blocks` and the `base` of each block.
+ */
+static pthread_mutex_t stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Key whose destructor releases the
+ * block of a thread when it exits.
+ */
+static pthread_key_t stats_key;
+
+/**
+ * Creates `stats_key` once.
+ */
+static pthread_once_t stats_key_once = PTHREAD_ONCE_INIT;
+
+/**
+ * The block of the calling thread,
+ * `NULL` until it makes a counted call.
+ */
+static THREAD_LOCAL struct stats_block* stats_block = NULL;
+
+/**
+ * The counters of the outermost counted function
+ * that the calling thread is running, `NULL` if none.
+ * Calls that a counted function makes to other
+ * counted functions are not counted, and the
+ * allocations they make belong to the outermost one.
+ */
+static THREAD_LOCAL unsigned long long int* stats_current = NULL;
+
+
+/**
+ * Release the block of an exiting thread.
+ * 
+ * @param  block  The block.
+ */
+static void stats_release(void* block)
+{
+  __atomic_store_n(&((struct stats_block*)block)->in_use, 0, __ATOMIC_RELEASE);
+}
+
+
+/**
+ * Create `stats_key`.
+ */
+static void stats_create_key(void)
+{
+  pthread_key_create(&stats_key, stats_release);
+}
+
+
+/**
+ * Give the calling thread a block, reusing
+ * one released by an exited thread if any.
+ * 
+ * @return  The block, `NULL` if the thread has none and
+ *          none could be allocated, in which case the
+ *          call is not counted.
+ */
+static struct stats_block* stats_acquire(void)
+{
+  struct stats_block* block;
+  
+  pthread_once(&stats_key_once, stats_create_key);
+  pthread_mutex_lock(&stats_mutex);
+  for (block = stats_blocks; block != NULL; block = block->next)
+    if (!__atomic_load_n(&block->in_use, __ATOMIC_ACQUIRE))
+      break;
+  if (block == NULL)
+    {
+      block = calloc(1, sizeof(*block));
+      if (block != NULL)
+	{
+	  block->next = stats_blocks;
+	  stats_blocks = block;
+	}
+    }
+  if (block != NULL)
+    __atomic_store_n(&block->in_use, 1, __ATOMIC_RELAXED);
+  pthread_mutex_unlock(&stats_mutex);
+  
+  if (block != NULL)
+    pthread_setspecific(stats_key, block);
+  return stats_block = block;
+}
+
+
+/**
+ * Add to a counter of the calling thread.
+ * 
+ * The counter is read and written atomically only
+ * so that `libstring_stats_snapshot` can read it
+ * while it is being written.
+ * 
+ * @param  counter  The counter.
+ * @param  value    The value to add.
+ */
+static inline void stats_add(unsigned long long int* counter, unsigned long long int value)
+{
+  __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + value, __ATOMIC_RELAXED);
+}
+
+
+/**
+ * Count a call to a function, unless it was made
+ * by another counted function.
+ * 
+ * @param   function  The function.
+ * @param   input     The number of input bytes.
+ * @return            Whether the call is counted, and
+ *                    must be ended with `stats_leave`.
+ */
+static int stats_enter(enum stats_function function, size_t input)
+{
+  if ((stats_block == NULL) && (stats_acquire() == NULL))
+    return 0;
+  stats_current = stats_block->counts[function];
+  stats_add(stats_current + COUNTER_CALLS, 1);
+  stats_add(stats_current + COUNTER_INPUT_BYTES, input);
+  return 1;
+}
+
+
+/**
+ * End a call started with `STATS_ENTER`.
+ * 
+ * @param  counted  The variable declared by `STATS_ENTER`.
+ */
+static inline void stats_leave(const int* counted)
+{
+  if (*counted)
+    stats_current = NULL;
+}
+
+
+/**
+ * Count the bytes written by an `_into` function.
+ * 
+ * @param   counted  Whether the call is counted.
+ * @param   len      The length of the untruncated result.
+ * @param   size     The allocation size of the output buffer.
+ * @return           `len`.
+ */
+static inline size_t stats_into(int counted, size_t len, size_t size)
+{
+  if (counted)
+    stats_add(stats_current + COUNTER_OUTPUT_BYTES, len < size ? len : size - (size > 0));
+  return len;
+}
+
+
+/**
+ * Get a counter of one thread, from the last
+ * `libstring_stats_reset`.
+ * 
+ * `stats_mutex` must be held.
+ * 
+ * @param   block     The thread's block.
+ * @param   function  The function.
+ * @param   counter   The counter.
+ * @return            The count.
+ */
+static unsigned long long int stats_count(struct stats_block* block, size_t function,
+					  enum stats_counter counter)
+{
+  return __atomic_load_n(&block->counts[function][counter], __ATOMIC_RELAXED) - block->base[function][counter];
+}
+
+
+/**
+ * Get the total length of an array of strings.
+ * 
+ * @param   strings  The strings.
+ * @param   n        The maximum number of strings, the
+ *                   array ends earlier at a `NULL`.
+ * @return           The total length of the strings.
+ */
+static size_t stats_bytes(const char* const* strings, size_t n)
+{
+  size_t i, len = 0;
+  for (i = 0; (i < n) && (strings[i] != NULL); i++)
+    len += strlen(strings[i]);
+  return len;
+}
+
+
+/**
+ * Get the total length of an array of `struct libstring_str`:s.
+ * 
+ * @param   strings  The strings.
+ * @param   n        The number of strings.
+ * @return           The total length of the strings.
+ */
+static size_t stats_str_bytes(const struct libstring_str* strings, size_t n)
+{
+  size_t i, len = 0;
+  for (i = 0; i < n; i++)
+    len += strings[i].len;
+  return len;
+}
+
+
+/**
+ * Count a call to a function, if it is not made by another
+ * counted function, until the end of the enclosing block.
+ * 
+ * This is a declaration, and the input is only
+ * evaluated if the call is counted.
+ * 
+ * @param  FUNCTION  The function's name without the `libstring_` prefix.
+ * @param  INPUT     The number of input bytes.
+ */
+# define STATS_ENTER(FUNCTION, INPUT)\
+  __attribute__((__cleanup__(stats_leave))) const int stats_counted =\
+    (stats_current == NULL) && stats_enter(stats_##FUNCTION, (INPUT))
+
+/**
+ * Count input bytes that were not known
+ * when the call was counted.
+ * 
+ * @param  BYTES  The number of bytes.
+ */
+# define STATS_INPUT(BYTES)\
+  do { if (stats_counted) stats_add(stats_current + COUNTER_INPUT_BYTES, (BYTES)); } while (0)
+
+/**
+ * Count the bytes of text a call produced.
+ * 
+ * @param  BYTES  The number of bytes.
+ */
+# define STATS_OUTPUT(BYTES)\
+  do { if (stats_counted) stats_add(stats_current + COUNTER_OUTPUT_BYTES, (BYTES)); } while (0)
+
+/**
+ * Count the bytes written by an `_into` function.
+ * 
+ * @param   LEN   The length of the untruncated result.
+ * @param   SIZE  The allocation size of the output buffer.
+ * @return        `LEN`.
+ */
+# define STATS_INTO(LEN, SIZE)  stats_into(stats_counted, (LEN), (SIZE))
+
+/**
+ * Count an allocation made for the running counted function.
+ * 
+ * @param  PTR  The allocation, `NULL` if it failed.
+ */
+# define STATS_ALLOCATION(PTR)\
+  do\
+    if (stats_current != NULL)\
+      {\
+	stats_add(stats_current + COUNTER_ALLOCATIONS, 1);\
+	stats_add(stats_current + COUNTER_ALLOCATION_FAILURES, (PTR) == NULL);\
+      }\
+  while (0)
+
+#else
+# define STATS_ENTER(FUNCTION, INPUT)  /* not counted */
+# define STATS_INPUT(BYTES)            ((void) 0)
+# define STATS_OUTPUT(BYTES)           ((void) 0)
+# define STATS_INTO(LEN, SIZE)         (LEN)
+# define STATS_ALLOCATION(PTR)         ((void) 0)
+#endif
+
+
+
+#ifdef LIBSTRING_PROBES
+/**
+ * Fire the USDT probe `libstring:OPERATION-entry`.
+ * 
+ * The probes are `split` (`libstring_split` and
+ * `libstring_split_p`), `cut` (`libstring_cut`,
+ * `libstring_cut_p` and `libstring_vcut`), `join`
+ * (`libstring_join`, `libstring_join_parallel`,
+ * `libstring_cat` and `libstring_cat_parallel`),
+ * `utf8verify` (`libstring_utf8verify` and
+ * `libstring_utf8verify_n`), `length` (`libstring_length`
+ * and `libstring_length_n`), and one for each of the
+ * replace functions, including the `replace_many`
+ * functions, and each of the lcase, ucase, capitalise
+ * and swapcase functions other than the `_batch`
+ * functions, named after the function. Each call
+ * fires exactly one pair.
+ * 
+ * @param  OPERATION  The name of the probe.
+ * @param  INPUT      The length of the input, for `join`
+ *                    the number of strings.
+ * @param  FLAGS      The function's flags, 0 if it has none.
+ */
+# define PROBE_ENTRY(OPERATION, INPUT, FLAGS)\
+  DTRACE_PROBE2(libstring, OPERATION##__entry, (size_t)(INPUT), (int)(FLAGS))
+
+/**
+ * Fire the USDT probe `libstring:OPERATION-return`.
+ * 
+ * @param  OPERATION  The name of the probe.
+ * @param  INPUT      The length of the input, for `join`
+ *                    the number of strings.
+ * @param  OUTPUT     The length of the result, for `split` and `cut`
+ *                    the number of fields, for `length` the number of
+ *                    characters, `(size_t)-1` on error or, for
+ *                    `utf8verify`, if the string is invalid.
+ * @param  FLAGS      The function's flags, 0 if it has none.
+ */
+# define PROBE_RETURN(OPERATION, INPUT, OUTPUT, FLAGS)\
+  DTRACE_PROBE3(libstring, OPERATION##__return, (size_t)(INPUT), (size_t)(OUTPUT), (int)(FLAGS))
+
+#else
+# define PROBE_ENTRY(OPERATION, INPUT, FLAGS)           ((void) 0)
+# define PROBE_RETURN(OPERATION, INPUT, OUTPUT, FLAGS)  ((void) 0)
+#endif
+
+
+
+/**
+ * Allocate memory with the selected allocator.
+ * 
+ * @param   size  The number of bytes to allocate.
+ * @return        The allocated memory, `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+static void* allocate(size_t size)
+{
+  void* rc = (allocator == NULL ? malloc(size) : allocator->allocate(size, allocator->data));
+  STATS_ALLOCATION(rc);
+  return rc;
+}
+
+
+/**
+ * Change the size of an allocation made with
+ * the selected allocator.
+ * 
+ * @param   ptr       The allocation.
+ * @param   old_size  The size `ptr` was allocated with.
+ * @param   size      The new size of the allocation.
+ * @return            The new allocation, `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+static void* reallocate(void* ptr, size_t old_size, size_t size)
+{
+  void* rc = (allocator == NULL ? realloc(ptr, size) :
+	      allocator->reallocate(ptr, old_size, size, allocator->data));
+  STATS_ALLOCATION(rc);
+  return rc;
+}
+
+
+/**
+ * Deallocate memory allocated with the selected allocator.
+ * 
+ * @param  ptr  The memory to deallocate, may be `NULL`.
+ */
+static void deallocate(void* ptr)
+{
+  if (allocator == NULL)
+    free(ptr);
+  else
+    allocator->deallocate(ptr, allocator->data);
+}
+
+
+/**
+ * Write a piece of the result of an `_into` function,
+ * discarding whatever does not fit in the buffer.
+ * 
+ * @param   buf   The output buffer, may be `NULL` if `size` is 0.
+ * @param   size  The allocation size of `buf`.
+ * @param   off   The position in the result of the piece.
+ * @param   s     The piece.
+ * @param   n     The length of `s`.
+ * @return        `off + n`.
+ */
+static size_t put(char* buf, size_t size, size_t off, const char* s, size_t n)
+{
+  if (off + 1 < size)
+    memcpy(buf + off, s, (n < size - 1 - off ? n : size - 1 - off) * sizeof(char));
+  return off + n;
+}
+
+
+/**
+ * NUL-terminate the result of an `_into` function.
+ * 
+ * @param   buf   The output buffer, may be `NULL` if `size` is 0.
+ * @param   size  The allocation size of `buf`.
+ * @param   len   The length of the untruncated result.
+ * @return        `len`.
+ */
+static size_t terminate(char* buf, size_t size, size_t len)
+{
+  if (size > 0)
+    buf[len < size ? len : size - 1] = '\0';
+  return len;
+}
+
+
+/**
+ * Get the allocation size to grow a `struct libstring_str` to.
+ * 
+ * @param   cap  The current allocation size.
+ * @param   len  The length the string must have room for.
+ * @return       The new allocation size, 0 if it would overflow.
+ */
+static size_t str_capacity(size_t cap, size_t len)
+{
+  if (len == SIZE_MAX)
+    return 0;
+  return ((cap <= SIZE_MAX / 2) && (cap * 2 > len)) ? cap * 2 : len + 1;
+}
+
+
+/**
+ * Store the length of the result of a `_str` function,
+ * after the result has been written into the string
+ * in the same way as an `_into` function does.
+ * 
+ * If the result did not fit, the string is given
+ * a larger allocation, without copying its contents,
+ * and the result has to be written again.
+ * 
+ * @param   out  The output string.
+ * @param   len  The length of the untruncated result.
+ * @return       0 if the result fit, 1 if it must be
+ *               written again, -1 on error, in which
+ *               case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+static int str_result(struct libstring_str* out, size_t len)
+{
+  size_t cap = str_capacity(out->cap, len);
+  
+  if (len < out->cap)
+    return out->len = len, 0;
+  
+  deallocate(out->ptr);
+  out->ptr = NULL;
+  out->len = out->cap = 0;
+  if (cap == 0)
+    return errno = ENOMEM, -1;
+  out->ptr = allocate(cap * sizeof(char));
+  if (out->ptr == NULL)
+    return -1;
+  out->cap = cap;
+  return 1;
+}
+
+
+/**
+ * Grow the allocation of a string, keeping its contents.
+ * 
+ * @param   ptr   The allocation, `NULL` if there is none,
+ *                updated on success.
+ * @param   cap   The allocation size, updated on success.
+ * @param   len   The length of the string.
+ * @param   need  The length to make room for.
+ * @return        0 on success, -1 on error, in
+ *                which case nothing is changed.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+static int str_grow(char** ptr, size_t* cap, size_t len, size_t need)
+{
+  size_t new_cap = str_capacity(*cap, need);
+  char* new;
+  
+  if (need < *cap)
+    return 0;
+  if (new_cap == 0)
+    return errno = ENOMEM, -1;
+  
+  if (*ptr == NULL)
+    new = allocate(new_cap * sizeof(char));
+  else
+    new = reallocate(*ptr, *cap * sizeof(char), new_cap * sizeof(char));
+  if (new == NULL)
+    return -1;
+  
+  new[len] = '\0';
+  *ptr = new;
+  *cap = new_cap;
+  return 0;
+}
+
+
+/**
+ * Transform a string of a given length, and
+ * store the result in a caller-provided buffer.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to transform.
+ * @param   n       The length of `string`.
+ * @param   ctx     The transform's options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+typedef size_t batch_transform_t(char* buf, size_t size, const char* string, size_t n, const void* ctx);
+
+
+/**
+ * Apply a transform to an array of strings, packing the
+ * results into one allocation.
+ * 
+ * The first pass measures every result, so that the
+ * offsets, and the total size, are known before the
+ * second pass writes the results.
+ * 
+ * @param   out      Output parameter for the results.
+ * @param   strings  The strings to transform.
+ * @param   n        The number of strings in `strings`.
+ * @param   f        The transform.
+ * @param   ctx      The transform's options.
+ * @return           0 on success, -1 on error, in
+ *                   which case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+static int batch(struct libstring_batch* out, const char* const* strings, size_t n,
+		 batch_transform_t* f, const void* ctx)
+{
+  size_t i, m, len = 0;
+  
+  out->data = NULL;
+  out->offsets = NULL;
+  out->n = 0;
+  
+  if (n >= SIZE_MAX / sizeof(size_t))
+    return errno = ENOMEM, -1;
+  out->offsets = allocate((n + 1) * sizeof(size_t));
+  if (out->offsets == NULL)
+    return -1;
+  
+  for (i = 0; i < n; i++)
+    {
+      out->offsets[i] = len;
+      m = f(NULL, 0, strings[i], strlen(strings[i]), ctx) + 1;
+      if ((m == 0) || (len > SIZE_MAX - m))
+	goto enomem;
+      len += m;
+    }
+  out->offsets[n] = len;
+  
+  out->data = allocate((len > 0 ? len : 1) * sizeof(char));
+  if (out->data == NULL)
+    goto fail;
+  
+  for (i = 0; i < n; i++)
+    f(out->data + out->offsets[i], out->offsets[i + 1] - out->offsets[i],
+      strings[i], strlen(strings[i]), ctx);
+  out->n = n;
+  return 0;
+  
+ enomem:
+  errno = ENOMEM;
+ fail:
+  deallocate(out->offsets);
+  out->offsets = NULL;
+  return -1;
+}
+
+
+/**
+ * Get the number of bytes in a UTF-8 character
+ * from its first byte.
+ * 
+ * @param   c  The first byte of the character.
+ * @return     The length of the character, 1 for
+ *             continuation bytes and invalid bytes.
+ */
+static size_t utf8_width(unsigned char c)
+{
+  if (c < 0xC0)  return 1;
+  if (c < 0xE0)  return 2;
+  if (c < 0xF0)  return 3;
+  if (c < 0xF8)  return 4;
+  if (c < 0xFC)  return 5;
+  if (c < 0xFE)  return 6;
+  return 1;
+}
+
+
+/**
+ * Get the length of the UTF-8 character at
+ * a position in a string, never reading
+ * past the end of the string.
+ * 
+ * @param   s  The character.
+ * @param   n  The number of bytes left in the string.
+ * @return     The number of bytes in the character.
+ */
+static size_t utf8_charlen(const char* s, size_t n)
+{
+  size_t i, w = utf8_width((unsigned char)*s);
+  w = w < n ? w : n;
+  for (i = 1; i < w; i++)
+    if ((s[i] & 0xC0) != 0x80)
+      return i;
+  return w;
+}
+
+
+/**
+ * Get the position of a character in a string.
+ * 
+ * @param   s  The string.
+ * @param   n  The length of `s`.
+ * @param   k  The index of the character.
+ * @return     The byte offset of the character, `n`
+ *             if there are not that many characters.
+ */
+static size_t utf8_offset(const char* s, size_t n, size_t k)
+{
+  size_t i;
+  for (i = 0; i < n; i++)
+    if ((s[i] & 0xC0) != 0x80)
+      if (!k--)
+	return i;
+  return i;
+}
+
+
+/**
+ * Decode the UTF-8 character at a position in a
+ * string, never reading past the end of the string.
+ * 
+ * @param   s      The character.
+ * @param   avail  The number of bytes left in the string.
+ * @param   n      Output parameter for the number of
+ *                 bytes in the character.
+ * @return         The code point of the character, the value of
+ *                 the byte if it does not start a complete character.
+ */
+static uint32_t utf8_decode(const char* s, size_t avail, size_t* n)
+{
+  size_t i, w = utf8_width((unsigned char)*s);
+  uint32_t cp;
+  
+  *n = utf8_charlen(s, avail);
+  if ((w == 1) || (*n != w))
+    return (unsigned char)*s;
+  
+  cp = (unsigned char)*s & (0x7F >> w);
+  for (i = 1; i < w; i++)
+    cp = (cp << 6) | (s[i] & 0x3F);
+  return cp;
+}
+
+
+/**
+ * Get the properties of a character.
+ * 
+ * @param   cp  The code point of the character.
+ * @return      The `UNICODE_*` properties of the character.
+ */
+static unsigned char unicode_props(uint32_t cp)
+{
+  if (cp >= 0x110000)
+    return 1;
+  return unicode_leaves[unicode_middle[unicode_root[cp >> UNICODE_ROOT_SHIFT]]
+				      [(cp >> UNICODE_MIDDLE_SHIFT) & UNICODE_MIDDLE_MASK]]
+		       [cp & UNICODE_LEAF_MASK];
+}
+
+
+/**
+ * Get the case of a character.
+ * 
+ * @param   cp  The code point of the character.
+ * @return      The offsets to the simple case folding and
+ *              mappings of the character, indexed by the
+ *              `UNICODE_CASE_*` constants, all 0 if it
+ *              has no case.
+ */
+static const int32_t* unicode_case_of(uint32_t cp)
+{
+  if (cp >= 0x110000)
+    return unicode_case[0];
+  return unicode_case[unicode_case_leaves[unicode_case_middle[unicode_case_root[cp >> UNICODE_ROOT_SHIFT]]
+							    [(cp >> UNICODE_MIDDLE_SHIFT) & UNICODE_MIDDLE_MASK]]
+				       [cp & UNICODE_LEAF_MASK]];
+}
+
+
+/**
+ * Get the grapheme cluster properties of a character.
+ * 
+ * @param   cp  The code point of the character.
+ * @return      The `UNICODE_GRAPHEME_*` value of the character,
+ *              and its `UNICODE_EXTENDED_PICTOGRAPHIC` and
+ *              `UNICODE_INCB` properties.
+ */
+static unsigned char unicode_grapheme_of(uint32_t cp)
+{
+  if (cp >= 0x110000)
+    return UNICODE_GRAPHEME_CONTROL;
+  return unicode_grapheme_leaves[unicode_grapheme_middle[unicode_grapheme_root[cp >> UNICODE_ROOT_SHIFT]]
+							    [(cp >> UNICODE_MIDDLE_SHIFT) & UNICODE_MIDDLE_MASK]]
+				 [cp & UNICODE_LEAF_MASK];
+}
+
+
+/**
+ * Encode a character in UTF-8.
+ * 
+ * @param   cp  The code point of the character, less than 0x110000.
+ * @param   s   Output buffer, must have room for 4 bytes.
+ * @return      The number of bytes in the character.
+ */
+static size_t utf8_encode(uint32_t cp, char* s)
+{
+  if (cp < 0x80)
+    return s[0] = (char)cp, 1;
+  if (cp < 0x800)
+    {
+      s[0] = (char)(0xC0 | (cp >> 6));
+      s[1] = (char)(0x80 | (cp & 0x3F));
+      return 2;
+    }
+  if (cp < 0x10000)
+    {
+      s[0] = (char)(0xE0 | (cp >> 12));
+      s[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+      s[2] = (char)(0x80 | (cp & 0x3F));
+      return 3;
+    }
+  s[0] = (char)(0xF0 | (cp >> 18));
+  s[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+  s[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+  s[3] = (char)(0x80 | (cp & 0x3F));
+  return 4;
+}
+
+
+/**
+ * Get the number of columns a character is counted as.
+ * 
+ * @param   cp     The code point of the character.
+ * @param   prev   The code point of the previous character, 0 if none.
+ * @param   flags  Options for `libstring_length`.
+ * @return         The number of columns.
+ */
+static size_t char_length(uint32_t cp, uint32_t prev, enum libstring_length flags)
+{
+  unsigned char props;
+  
+  if (!(flags & (LIBSTRING_LENGTH_IGNORE_COMBINING | LIBSTRING_LENGTH_DISPLAY_LENGTH)))
+    return 1;
+  
+  props = unicode_props(cp);
+  if ((props & UNICODE_COMBINING))
+    {
+      if (!(flags & LIBSTRING_LENGTH_IGNORE_COMBINING))
+	return 1;
+      /* Variation selector 16 widens emoji that are displayed as text by default. */
+      if ((cp == 0xFE0F) && (flags & LIBSTRING_LENGTH_DISPLAY_LENGTH) && (prev >= 0x80))
+	{
+	  props = unicode_props(prev) & (UNICODE_EMOJI | UNICODE_EMOJI_PRESENTATION | UNICODE_WIDTH);
+	  return props == (UNICODE_EMOJI | 1);
+	}
+      return 0;
+    }
+  
+  return (flags & LIBSTRING_LENGTH_DISPLAY_LENGTH) ? (props & UNICODE_WIDTH) : 1;
+}
+
+
+/**
+ * Check whether two strings are equal, ignoring
+ * the case of ASCII letters.
+ * 
+ * @param   a  One of the strings.
+ * @param   b  The other string.
+ * @param   n  The number of bytes to compare.
+ * @return     1 if equal, 0 otherwise.
+ */
+static int ascii_caseeq(const char* a, const char* b, size_t n)
+{
+  unsigned char x, y;
+#if defined(__SSE2__)
+  const __m128i before_a = _mm_set1_epi8('A' - 1), after_z = _mm_set1_epi8('Z' + 1);
+  const __m128i bit = _mm_set1_epi8(0x20);
+  __m128i x16, y16;
+  
+  /* Bytes from 0x80 are negative, so they are not taken for letters. */
+  for (; n >= 16; n -= 16, a += 16, b += 16)
+    {
+      x16 = _mm_loadu_si128((const __m128i*)a);
+      y16 = _mm_loadu_si128((const __m128i*)b);
+      x16 = _mm_or_si128(x16, _mm_and_si128(bit, _mm_and_si128(_mm_cmpgt_epi8(x16, before_a),
+								  _mm_cmpgt_epi8(after_z, x16))));
+      y16 = _mm_or_si128(y16, _mm_and_si128(bit, _mm_and_si128(_mm_cmpgt_epi8(y16, before_a),
+								  _mm_cmpgt_epi8(after_z, y16))));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(x16, y16)) != 0xFFFF)
+	return 0;
+    }
+#endif
+  while (n--)
+    {
+      x = (unsigned char)*a++;
+      y = (unsigned char)*b++;
+      if (x == y)
+	continue;
+      if (((x | 0x20) != (y | 0x20)) || ((x | 0x20) < 'a') || ((x | 0x20) > 'z'))
+	return 0;
+    }
+  return 1;
+}
+
+
+/**
+ * Get the length of the character at a position
+ * in a substring to search for.
+ * 
+ * @param   s      The character.
+ * @param   avail  The number of bytes left in the substring.
+ * @return         The number of bytes in the character, 1 if
+ *                 it is not a complete UTF-8 character.
+ */
+static size_t pattern_charlen(const char* s, size_t avail)
+{
+  size_t n = utf8_width((unsigned char)*s);
+  return ((n <= 4) && (utf8_charlen(s, avail) == n)) ? n : 1;
+}
+
+
+/**
+ * Get the length of the character that ends at a position
+ * in a substring, as `pattern_charlen` splits the substring.
+ * 
+ * A complete character starts with a byte that cannot be
+ * in the middle of a character, so `pattern_charlen`
+ * always finds it, and it is found from its end too.
+ * 
+ * @param   s    The substring.
+ * @param   end  The position after the character, must not be 0.
+ * @return       The number of bytes in the character.
+ */
+static size_t pattern_charlen_before(const char* s, size_t end)
+{
+  size_t n;
+  for (n = 2; (n <= 4) && (n <= end); n++)
+    if (pattern_charlen(s + end - n, n) == n)
+      return n;
+  return 1;
+}
+
+
+/**
+ * Get the other case variants of a character
+ * that have as many bytes as the character.
+ * 
+ * gen-unicode-tables.c fails if more than 4 code points have the
+ * same case folding, so there are at most 3 variants.
+ * 
+ * @param   s         The character.
+ * @param   n         The number of bytes in the character,
+ *                    as returned by `pattern_charlen`.
+ * @param   variants  Output buffer for the variants.
+ * @param   size      The number of variants `variants` can hold.
+ * @return            The number of variants, at most `size`.
+ */
+static size_t case_variants(const char* s, size_t n, char variants[][4], size_t size)
+{
+  char buf[4];
+  uint32_t cp, c;
+  size_t k = 0;
+  
+  if (n == 1)
+    {
+      if ((size == 0) || (((unsigned char)*s | 0x20) < 'a') || (((unsigned char)*s | 0x20) > 'z'))
+	return 0;
+      variants[0][0] = (char)(*s ^ 0x20);
+      return 1;
+    }
+  
+  /* Overlong characters have no variants. */
+  cp = utf8_decode(s, n, &n);
+  if ((cp >= 0x110000) || (utf8_encode(cp, buf) != n))
+    return 0;
+  
+  for (c = cp + (uint32_t)unicode_case_of(cp)[UNICODE_CASE_NEXT]; (c != cp) && (k < size);
+       c += (uint32_t)unicode_case_of(c)[UNICODE_CASE_NEXT])
+    if (utf8_encode(c, buf) == n)
+      memcpy(variants[k++], buf, n);
+  return k;
+}
+
+
+/**
+ * Prepare a substring to search for.
+ * 
+ * @param  pat          The prepared substring.
+ * @param  pattern      The substring.
+ * @param  plen         The length of `pattern`.
+ * @param  ignore_case  Whether to ignore case.
+ */
+static void pattern_compile(struct libstring_pattern* pat, const char* pattern,
+			    size_t plen, int ignore_case)
+{
+  char variants[4][4];
+  size_t i, j, k, m, n, o;
+  unsigned char c;
+  
+  pat->pattern = pattern;
+  pat->length = plen;
+  pat->ignore_case = ignore_case;
+  pat->unicode = 0;
+  pat->first_fold = pat->last_fold = 0;
+  
+  /* Shifts are capped to fit in a byte, shorter shifts are always safe. */
+  k = plen < 255 ? plen : 255;
+  memset(pat->skip, (int)k, sizeof(pat->skip));
+  memset(pat->skip_right, (int)k, sizeof(pat->skip_right));
+  
+  /* Every byte a case variant can have at a position counts as occurring
+   * there. The last occurrence, other than at the end, decides the forward
+   * shift, and the first occurrence, other than at the start, decides the
+   * backward shift. */
+  for (o = 0; o < plen; o += n)
+    {
+      n = pattern_charlen(pattern + o, plen - o);
+      memcpy(variants[0], pattern + o, n);
+      m = 1;
+      if (ignore_case)
+	m += case_variants(pattern + o, n, variants + 1, sizeof(variants) / sizeof(*variants) - 1);
+      pat->unicode |= (n > 1) && (m > 1);
+      for (j = 0; j < n; j++)
+	for (i = o + j, k = 0; k < m; k++)
+	  {
+	    c = (unsigned char)variants[k][j];
+	    if (i + 1 < plen)
+	      pat->skip[c] = (unsigned char)(plen - 1 - i < 255 ? plen - 1 - i : 255);
+	    if ((i > 0) && (pat->skip_right[c] > i))
+	      pat->skip_right[c] = (unsigned char)i;
+	    if (i == 0)
+	      pat->first_fold |= (unsigned char)(c ^ (unsigned char)pattern[0]);
+	    if (i + 1 == plen)
+	      pat->last_fold |= (unsigned char)(c ^ (unsigned char)pattern[plen - 1]);
+	  }
+    }
+}
+
+
+/**
+ * Check whether text is an occurrence of a prepared substring
+ * with case variants of non-ASCII characters in it.
+ * 
+ * The text may be split in two parts.
+ * 
+ * @param   pat  The prepared substring.
+ * @param   a    The first part of the text.
+ * @param   an   The length of `a`.
+ * @param   b    The second part of the text, may be `NULL`
+ *               if `an` is at least the length of `pat`.
+ * @return       1 if equal, 0 otherwise.
+ */
+static int unicode_caseeq(const struct libstring_pattern* pat, const char* a, size_t an, const char* b)
+{
+  char variants[3][4], buf[4];
+  const char* p = pat->pattern;
+  const char* t;
+  size_t j, k, m, n, o;
+  
+  for (o = 0; o < pat->length; o += n)
+    {
+      n = pattern_charlen(p + o, pat->length - o);
+      if (o + n <= an)
+	t = a + o;
+      else if (o >= an)
+	t = b + (o - an);
+      else
+	for (t = buf, j = 0; j < n; j++)
+	  buf[j] = (o + j < an) ? a[o + j] : b[o + j - an];
+      if (!memcmp(t, p + o, n))
+	continue;
+      m = case_variants(p + o, n, variants, sizeof(variants) / sizeof(*variants));
+      for (k = 0; (k < m) && memcmp(t, variants[k], n); k++);
+      if (k == m)
+	return 0;
+    }
+  return 1;
+}
+
+
+/**
+ * Check whether text can be a part of an occurrence of a prepared
+ * substring with case variants of non-ASCII characters in it.
+ * 
+ * Each byte is compared on its own, so the text may
+ * mix bytes of different case variants of a character.
+ * 
+ * @param   pat     The prepared substring.
+ * @param   s       The text.
+ * @param   offset  The position of the part of the substring.
+ * @param   n       The number of bytes to compare.
+ * @return          1 if the bytes can be equal, 0 otherwise.
+ */
+static int unicode_caseeq_part(const struct libstring_pattern* pat, const char* s, size_t offset, size_t n)
+{
+  char variants[3][4];
+  const char* p = pat->pattern;
+  size_t i, j, k, m, w, o;
+  
+  for (o = 0; o < offset + n; o += w)
+    {
+      w = pattern_charlen(p + o, pat->length - o);
+      if (o + w <= offset)
+	continue;
+      m = case_variants(p + o, w, variants, sizeof(variants) / sizeof(*variants));
+      for (j = 0; j < w; j++)
+	{
+	  i = o + j;
+	  if ((i < offset) || (i >= offset + n) || (s[i - offset] == p[i]))
+	    continue;
+	  for (k = 0; (k < m) && (variants[k][j] != s[i - offset]); k++);
+	  if (k == m)
+	    return 0;
+	}
+    }
+  return 1;
+}
+
+
+/**
+ * Check whether a prepared substring occurs at a position.
+ * 
+ * @param   pat  The prepared substring.
+ * @param   s    The position in the text.
+ * @return       1 if the substring occurs at `s`, 0 otherwise.
+ */
+static int pattern_eq(const struct libstring_pattern* pat, const char* s)
+{
+  if (!pat->ignore_case)
+    return !memcmp(s, pat->pattern, pat->length);
+  if (pat->unicode)
+    return unicode_caseeq(pat, s, pat->length, NULL);
+  return ascii_caseeq(s, pat->pattern, pat->length);
+}
+
+
+/**
+ * Find the next or previous occurrence of a substring.
+ * 
+ * @param   string      The string to search.
+ * @param   len         The length of `string`.
+ * @param   pat         The substring to find, must not be empty.
+ * @param   from_right  Whether to search backwards from
+ *                      the end of `string`.
+ * @return              The position of the match, `SIZE_MAX`
+ *                      if there is none.
+ */
+static size_t find(const char* string, size_t len, const struct libstring_pattern* pat, int from_right)
+{
+  const unsigned char* s = (const unsigned char*)string;
+  size_t plen = pat->length, lo = 0, hi, i;
+  unsigned char skip;
+#if defined(__SSE2__)
+  const unsigned char* p = (const unsigned char*)pat->pattern;
+  __m128i first, last, fold_first, fold_last, a, b;
+  unsigned mask, k;
+#endif
+  
+  if (plen > len)
+    return SIZE_MAX;
+  hi = len - plen;
+  
+#if defined(__SSE2__)
+  /* Find candidates 16 positions at a time, by the first and the last
+   * byte of the substring. When ignoring case, the bits that differ
+   * between the case variants of the bytes are set before comparing. */
+  fold_first = _mm_set1_epi8((char)pat->first_fold);
+  fold_last = _mm_set1_epi8((char)pat->last_fold);
+  first = _mm_set1_epi8((char)(p[0] | pat->first_fold));
+  last = _mm_set1_epi8((char)(p[plen - 1] | pat->last_fold));
+  
+  if (!from_right)
+    {
+      for (; (lo <= hi) && (hi - lo >= 15); lo += 16)
+	{
+	  a = _mm_or_si128(_mm_loadu_si128((const __m128i*)(s + lo)), fold_first);
+	  b = _mm_or_si128(_mm_loadu_si128((const __m128i*)(s + lo + plen - 1)), fold_last);
+	  mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+	  for (; mask; mask &= mask - 1)
+	    if (pattern_eq(pat, string + lo + (k = (unsigned)__builtin_ctz(mask))))
+	      return lo + k;
+	}
+      if (lo > hi)
+	return SIZE_MAX;
+    }
+  else
+    {
+      for (; hi >= 15; hi -= 16)
+	{
+	  a = _mm_or_si128(_mm_loadu_si128((const __m128i*)(s + hi - 15)), fold_first);
+	  b = _mm_or_si128(_mm_loadu_si128((const __m128i*)(s + hi - 15 + plen - 1)), fold_last);
+	  mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last)));
+	  for (; mask; mask &= ~(1U << k))
+	    if (pattern_eq(pat, string + hi - 15 + (k = 31U - (unsigned)__builtin_clz(mask))))
+	      return hi - 15 + k;
+	  if (hi == 15)
+	    return SIZE_MAX;
+	}
+    }
+#endif
+  
+  /* Boyer-Moore-Horspool for the rest. */
+  if (!from_right)
+    {
+      for (i = lo;; i += skip)
+	{
+	  if (pattern_eq(pat, string + i))
+	    return i;
+	  skip = pat->skip[s[i + plen - 1]];
+	  if (hi - i < skip)
+	    break;
+	}
+    }
+  else
+    {
+      for (i = hi;; i -= skip)
+	{
+	  if (pattern_eq(pat, string + i))
+	    return i;
+	  skip = pat->skip_right[s[i]];
+	  if (i - lo < skip)
+	    break;
+	}
+    }
+  return SIZE_MAX;
+}
+
+
+
+/**
+ * The least number of strings each thread must
+ * get for `join` to split the work between threads.
+ */
+#define JOIN_PARALLEL_MIN  4096
+
+/**
+ * The greatest number of threads `join` uses.
+ */
+#define JOIN_THREADS_MAX  64
+
+
+/**
+ * A contiguous slice of the strings `join` joins,
+ * handled by one thread.
+ */
+struct join_slice
+{
+  /**
+   * The strings to join, including those
+   * not in this slice.
+   */
+  const char* const* strings;
+  
+  /**
+   * The index of the first string in the slice.
+   */
+  size_t first;
+  
+  /**
+   * The number of strings in the slice.
+   */
+  size_t n;
+  
+  /**
+   * The delimiter.
+   */
+  const char* delimiter;
+  
+  /**
+   * The length of `delimiter`.
+   */
+  size_t dlen;
+  
+  /**
+   * The total length of the strings in the
+   * slice, excluding delimiters.
+   */
+  size_t len;
+  
+  /**
+   * Where in the result the slice is copied,
+   * starting with the delimiter before it.
+   */
+  char* out;
+};
+
+
+/**
+ * Measure the strings in a slice.
+ * 
+ * @param   slice  The slice, its `.len` is set.
+ * @return         `NULL`.
+ */
+static void* join_measure(void* slice)
+{
+  struct join_slice* s = slice;
+  size_t i, len = 0;
+  for (i = s->first; i < s->first + s->n; i++)
+    len += strlen(s->strings[i]);
+  s->len = len;
+  return NULL;
+}
+
+
+/**
+ * Copy the strings in a slice, and the delimiters before them,
+ * to the result. The terminating NUL byte is not written.
+ * 
+ * @param   slice  The slice.
+ * @return         `NULL`.
+ */
+static void* join_copy(void* slice)
+{
+  struct join_slice* s = slice;
+  char* p = s->out;
+  size_t i, len;
+  
+  for (i = s->first; i < s->first + s->n; i++)
+    {
+      if (i > 0)
+	memcpy(p, s->delimiter, s->dlen * sizeof(char)), p += s->dlen;
+      len = strlen(s->strings[i]);
+      memcpy(p, s->strings[i], len * sizeof(char)), p += len;
+    }
+  return NULL;
+}
+
+
+/**
+ * Run a function on each slice, each in its own thread. The
+ * calling thread handles the first slice itself, and any
+ * slice for which a thread could not be started.
+ * 
+ * @param  slices  The slices.
+ * @param  k       The number of slices.
+ * @param  f       The function.
+ */
+static void join_run(struct join_slice* slices, size_t k, void* (*f)(void*))
+{
+  pthread_t threads[JOIN_THREADS_MAX];
+  int started[JOIN_THREADS_MAX];
+  size_t i;
+  
+  for (i = 1; i < k; i++)
+    started[i] = !pthread_create(threads + i, NULL, f, slices + i);
+  f(slices);
+  for (i = 1; i < k; i++)
+    if (started[i])
+      pthread_join(threads[i], NULL);
+    else
+      f(slices + i);
+}
+
+
+/**
+ * Concatenate strings and insert a delimiter between the strings.
+ * 
+ * The strings are split into contiguous slices, one per thread.
+ * Each thread measures its slice, the slices' offsets in the
+ * result are the prefix sums of their lengths, and each
+ * thread then copies its slice to its offset.
+ * 
+ * @param   strings    List of strings to join.
+ * @param   n          Either a pointer the number of strings
+ *                     stored in `strings`, or `NULL` if
+ *                     `strings` is `NULL`-terminated.
+ * @param   delimiter  A string to insert between all strings.
+ * @param   threads    The greatest number of threads to use,
+ *                     0 for the number of online processors.
+ *                     Fewer are used if there are less than
+ *                     `JOIN_PARALLEL_MIN` strings per thread.
+ * @return             The joined strings. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+static char* join(const char* const* strings, const size_t* n, const char* delimiter, size_t threads)
+{
+  struct join_slice slices[JOIN_THREADS_MAX];
+  size_t i, k, m = (n == NULL ? SIZE_MAX : *n);
+  size_t len, dlen = strlen(delimiter);
+  char* rc;
+  long cpus;
+  
+  for (i = 0; (i < m) && (strings[i] != NULL); i++);
+  m = i;
+  PROBE_ENTRY(join, m, 0);
+  
+  if (threads == 0)
+    {
+      cpus = sysconf(_SC_NPROCESSORS_ONLN);
+      threads = (cpus > 0 ? (size_t)cpus : 1);
+    }
+  k = m / JOIN_PARALLEL_MIN;
+  k = (threads < k ? threads : k);
+  k = (k < 1 ? 1 : k > JOIN_THREADS_MAX ? JOIN_THREADS_MAX : k);
+  
+  for (i = 0; i < k; i++)
+    {
+      slices[i].strings = strings;
+      slices[i].first = m * i / k;
+      slices[i].n = m * (i + 1) / k - slices[i].first;
+      slices[i].delimiter = delimiter;
+      slices[i].dlen = dlen;
+    }
+  join_run(slices, k, join_measure);
+  
+  len = (m > 0 ? (m - 1) * dlen : 0);
+  for (i = 0; i < k; i++)
+    len += slices[i].len;
+  
+  rc = allocate((len + 1) * sizeof(char));
+  if (rc == NULL)
+    {
+      PROBE_RETURN(join, m, -1, 0);
+      return NULL;
+    }
+  
+  for (len = i = 0; i < k; len += slices[i++].len)
+    slices[i].out = rc + len + (slices[i].first > 0 ? (slices[i].first - 1) * dlen : 0);
+  join_run(slices, k, join_copy);
+  
+  len += (m > 0 ? (m - 1) * dlen : 0);
+  rc[len] = '\0';
+  PROBE_RETURN(join, m, len, 0);
+  return rc;
+}
+
+
+
+/**
+ * Concatenate strings.
+ * 
+ * Example:
+ *   const char* strings[] = {"alpha", "bet", "s", NULL};
+ *   s = libstring_cat(strings, NULL);
+ *   # s is "alphabets"
+ *   free(s);
+ * 
+ * Example:
+ *   const char* strings[] = {"alpha", "bet", "s"};
+ *   size_t n = 3;
+ *   s = libstring_cat(strings, &n);
+ *   # s is "alphabets"
+ *   free(s);
+ * 
+ * @param   strings  List of strings to concatenate, must
+ *                   not be `NULL` or contain `NULL`:s.
+ * @param   n        Either a pointer the number of strings
+ *                   stored in `strings`, or `NULL` if
+ *                   `strings` is `NULL`-terminated.
+ * @return           A string with all strings in `strings`
+ *                   concatenated in order, without any
+ *                   delimiter. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_cat(const char* const* strings, const size_t* n)
+{
+  STATS_ENTER(cat, stats_bytes(strings, n == NULL ? SIZE_MAX : *n));
+  char* rc = join(strings, n, "", 1);
+  STATS_OUTPUT(rc == NULL ? 0 : strlen(rc));
+  return rc;
+}
+
+
+/**
+ * Concatenate strings, using multiple threads.
+ * 
+ * This is the same as `libstring_cat`, except the strings
+ * are measured and copied by multiple threads, each
+ * handling a contiguous slice of them. Only one thread
+ * is used if there are few strings, as starting threads
+ * would then take longer than the work itself.
+ * 
+ * @param   strings  List of strings to concatenate, must
+ *                   not be `NULL` or contain `NULL`:s.
+ * @param   n        Either a pointer the number of strings
+ *                   stored in `strings`, or `NULL` if
+ *                   `strings` is `NULL`-terminated.
+ * @param   threads  The greatest number of threads to use, 0
+ *                   for the number of online processors.
+ * @return           A string with all strings in `strings`
+ *                   concatenated in order, without any
+ *                   delimiter. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_cat_parallel(const char* const* strings, const size_t* n, size_t threads)
+{
+  STATS_ENTER(cat_parallel, stats_bytes(strings, n == NULL ? SIZE_MAX : *n));
+  char* rc = join(strings, n, "", threads);
+  STATS_OUTPUT(rc == NULL ? 0 : strlen(rc));
+  return rc;
+}
+
+
+/**
+ * Concatenate strings into a caller-provided buffer.
+ * 
+ * This is the same as `libstring_cat`, except the result
+ * is stored in `buf` and truncated, in the same way as
+ * `snprintf` does, if it does not fit.
+ * 
+ * @param   buf      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size     The allocation size of `buf`.
+ * @param   strings  List of strings to concatenate, must
+ *                   not be `NULL` or contain `NULL`:s.
+ * @param   n        Either a pointer the number of strings
+ *                   stored in `strings`, or `NULL` if
+ *                   `strings` is `NULL`-terminated.
+ * @return           The length of the result, excluding the
+ *                   terminating NUL byte. The result was
+ *                   truncated if this is not less than `size`.
+ */
+size_t libstring_cat_into(char* buf, size_t size, const char* const* strings, const size_t* n)
+{
+  STATS_ENTER(cat_into, stats_bytes(strings, n == NULL ? SIZE_MAX : *n));
+  size_t i, m = (n == NULL ? SIZE_MAX : *n);
+  size_t len = 0;
+  
+  for (i = 0; (i < m) && (strings[i] != NULL); i++)
+    len = put(buf, size, len, strings[i], strlen(strings[i]));
+  
+  return STATS_INTO(terminate(buf, size, len), size);
+}
+
+
+/**
+ * Concatenate strings of given lengths.
+ * 
+ * This is the same as `libstring_cat`, except the
+ * strings have given lengths, so they may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out      Output string, its allocation is reused
+ *                   if the result fits in it. Must not
+ *                   overlap any of `strings`.
+ * @param   strings  The strings to concatenate, only
+ *                   `.ptr` and `.len` are used.
+ * @param   n        The number of strings in `strings`.
+ * @return           0 on success, -1 on error, in which
+ *                   case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_cat_str(struct libstring_str* out, const struct libstring_str* strings, size_t n)
+{
+  STATS_ENTER(cat_str, stats_str_bytes(strings, n));
+  size_t i, len = 0;
+  
+  for (i = 0; i < n; i++)
+    len += strings[i].len;
+  if (str_result(out, len) < 0)
+    return -1;
+  
+  for (len = i = 0; i < n; len += strings[i++].len)
+    memcpy(out->ptr + len, strings[i].ptr, strings[i].len * sizeof(char));
+  out->ptr[len] = '\0';
+  out->len = len;
+  STATS_OUTPUT(len);
+  return 0;
+}
+
+
+/**
+ * Concatenate a `va_list` of strings into a caller-provided buffer.
+ * 
+ * @param   buf      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size     The allocation size of `buf`.
+ * @param   strings  The first string, `NULL` if there are none.
+ * @param   args     The rest of the strings, ending with `NULL`.
+ * @return           The length of the result, excluding the
+ *                   terminating NUL byte.
+ */
+static size_t vcat_into(char* buf, size_t size, const char* strings, va_list args)
+{
+  size_t len = 0;
+  for (; strings != NULL; strings = va_arg(args, const char*))
+    len = put(buf, size, len, strings, strlen(strings));
+  return terminate(buf, size, len);
+}
+
+
+/**
+ * Concatenate strings.
+ * 
+ * Example:
+ *   s = libstring_vcat("alpha", "bet", "s", NULL);
+ *   # s is "alphabets"
+ *   free(s);
+ * 
+ * @param   strings...  List of strings to concatenate, end
+ *                      with a `NULL`.
+ * @return              A string with all strings in `strings`
+ *                      concatenated in order, without any
+ *                      delimiter. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_vcat(const char* strings, ... /*, (char*)0 */)
+{
+  STATS_ENTER(vcat, 0);
+  va_list args, args_copy;
+  size_t len;
+  char* rc;
+  
+  va_start(args, strings);
+  va_copy(args_copy, args);
+  len = vcat_into(NULL, 0, strings, args_copy);
+  va_end(args_copy);
+  STATS_INPUT(len);
+  
+  rc = allocate((len + 1) * sizeof(char));
+  if (rc != NULL)
+    vcat_into(rc, len + 1, strings, args);
+  va_end(args);
+  STATS_OUTPUT(rc == NULL ? 0 : len);
+  return rc;
+}
+
+
+/**
+ * Concatenate strings into a caller-provided buffer.
+ * 
+ * This is the same as `libstring_vcat`, except the result
+ * is stored in `buf` and truncated, in the same way as
+ * `snprintf` does, if it does not fit.
+ * 
+ * @param   buf         Output buffer, may be `NULL` if `size` is 0.
+ * @param   size        The allocation size of `buf`.
+ * @param   strings...  List of strings to concatenate, end
+ *                      with a `NULL`.
+ * @return              The length of the result, excluding the
+ *                      terminating NUL byte. The result was
+ *                      truncated if this is not less than `size`.
+ */
+size_t libstring_vcat_into(char* buf, size_t size, const char* strings, ... /*, (char*)0 */)
+{
+  STATS_ENTER(vcat_into, 0);
+  va_list args;
+  size_t rc;
+  va_start(args, strings);
+  rc = vcat_into(buf, size, strings, args);
+  va_end(args);
+  STATS_INPUT(rc);
+  return STATS_INTO(rc, size);
+}
+
+
+/**
+ * Concatenate strings and insert a delimiter between the strings.
+ * 
+ * Example:
+ *   const char* strings[] = {"alpha", "bet", "s", NULL};
+ *   s = libstring_join(strings, NULL, "--");
+ *   # s is "alpha--bet--s"
+ *   free(s);
+ * 
+ * Example:
+ *   const char* strings[] = {"alpha", "bet", "s"};
+ *   size_t n = 3;
+ *   s = libstring_join(strings, &n, "--");
+ *   # s is "alpha--bet--s"
+ *   free(s);
+ * 
+ * @param   strings    List of strings to join, must
+ *                     not be `NULL` or contain `NULL`:s.
+ * @param   n          Either a pointer the number of strings
+ *                     stored in `strings`, or `NULL` if
+ *                     `strings` is `NULL`-terminated.
+ * @param   delimiter  A string to insert between all strings.
+ * @return             A string with all strings in `strings`
+ *                     concatenated in order, with the
+ *                     delimiter `delimiter`. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_join(const char* const* strings, const size_t* n, const char* delimiter)
+{
+  STATS_ENTER(join, stats_bytes(strings, n == NULL ? SIZE_MAX : *n));
+  char* rc = join(strings, n, delimiter, 1);
+  STATS_OUTPUT(rc == NULL ? 0 : strlen(rc));
+  return rc;
+}
+
+
+/**
+ * Concatenate strings and insert a delimiter between
+ * the strings, using multiple threads.
+ * 
+ * This is the same as `libstring_join`, except the strings
+ * are measured and copied by multiple threads, each
+ * handling a contiguous slice of them. Only one thread
+ * is used if there are few strings, as starting threads
+ * would then take longer than the work itself.
+ * 
+ * Example:
+ *   s = libstring_join_parallel(rows, &n, "\n", 0);
+ * 
+ * @param   strings    List of strings to join, must
+ *                     not be `NULL` or contain `NULL`:s.
+ * @param   n          Either a pointer the number of strings
+ *                     stored in `strings`, or `NULL` if
+ *                     `strings` is `NULL`-terminated.
+ * @param   delimiter  A string to insert between all strings.
+ * @param   threads    The greatest number of threads to use, 0
+ *                     for the number of online processors.
+ * @return             A string with all strings in `strings`
+ *                     concatenated in order, with the
+ *                     delimiter `delimiter`. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_join_parallel(const char* const* strings, const size_t* n,
+			      const char* delimiter, size_t threads)
+{
+  STATS_ENTER(join_parallel, stats_bytes(strings, n == NULL ? SIZE_MAX : *n));
+  char* rc = join(strings, n, delimiter, threads);
+  STATS_OUTPUT(rc == NULL ? 0 : strlen(rc));
+  return rc;
+}
+
+
+/**
+ * Concatenate strings and insert a delimiter between the
+ * strings, into a caller-provided buffer.
+ * 
+ * This is the same as `libstring_join`, except the result
+ * is stored in `buf` and truncated, in the same way as
+ * `snprintf` does, if it does not fit.
+ * 
+ * @param   buf        Output buffer, may be `NULL` if `size` is 0.
+ * @param   size       The allocation size of `buf`.
+ * @param   strings    List of strings to join, must
+ *                     not be `NULL` or contain `NULL`:s.
+ * @param   n          Either a pointer the number of strings
+ *                     stored in `strings`, or `NULL` if
+ *                     `strings` is `NULL`-terminated.
+ * @param   delimiter  A string to insert between all strings.
+ * @return             The length of the result, excluding the
+ *                     terminating NUL byte. The result was
+ *                     truncated if this is not less than `size`.
+ */
+size_t libstring_join_into(char* buf, size_t size, const char* const* strings,
+			   const size_t* n, const char* delimiter)
+{
+  STATS_ENTER(join_into, stats_bytes(strings, n == NULL ? SIZE_MAX : *n));
+  size_t i, m = (n == NULL ? SIZE_MAX : *n);
+  size_t len = 0, dlen = strlen(delimiter);
+  
+  for (i = 0; (i < m) && (strings[i] != NULL); i++)
+    {
+      if (i > 0)
+	len = put(buf, size, len, delimiter, dlen);
+      len = put(buf, size, len, strings[i], strlen(strings[i]));
+    }
+  
+  return STATS_INTO(terminate(buf, size, len), size);
+}
+
+
+/**
+ * Concatenate strings of given lengths and
+ * insert a delimiter between the strings.
+ * 
+ * This is the same as `libstring_join`, except the
+ * strings and the delimiter have given lengths, so they
+ * may contain NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out        Output string, its allocation is reused
+ *                     if the result fits in it. Must not overlap
+ *                     any of `strings` or `delimiter`.
+ * @param   strings    The strings to join, only
+ *                     `.ptr` and `.len` are used.
+ * @param   n          The number of strings in `strings`.
+ * @param   delimiter  A string to insert between all strings.
+ * @param   dlen       The length of `delimiter`.
+ * @return             0 on success, -1 on error, in which
+ *                     case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_join_str(struct libstring_str* out, const struct libstring_str* strings,
+		       size_t n, const char* delimiter, size_t dlen)
+{
+  STATS_ENTER(join_str, stats_str_bytes(strings, n));
+  size_t i, len = (n > 0 ? (n - 1) * dlen : 0);
+  
+  for (i = 0; i < n; i++)
+    len += strings[i].len;
+  if (str_result(out, len) < 0)
+    return -1;
+  
+  for (len = i = 0; i < n; len += strings[i++].len)
+    {
+      if (i > 0)
+	memcpy(out->ptr + len, delimiter, dlen * sizeof(char)), len += dlen;
+      memcpy(out->ptr + len, strings[i].ptr, strings[i].len * sizeof(char));
+    }
+  out->ptr[len] = '\0';
+  out->len = len;
+  STATS_OUTPUT(len);
+  return 0;
+}
+
+
+/**
+ * Join a `va_list` of strings into a caller-provided buffer.
+ * 
+ * @param   buf      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size     The allocation size of `buf`.
+ * @param   strings  The first string, `NULL` if there are none.
+ * @param   args     The rest of the strings, ending with `NULL`,
+ *                   followed by the delimiter.
+ * @return           The length of the result, excluding the
+ *                   terminating NUL byte.
+ */
+static size_t vjoin_into(char* buf, size_t size, const char* strings, va_list args)
+{
+  va_list args_copy;
+  const char* delimiter;
+  const char* str;
+  size_t len = 0, dlen, i;
+  
+  if (strings == NULL)
+    return terminate(buf, size, 0);
+  
+  va_copy(args_copy, args);
+  while (va_arg(args_copy, const char*) != NULL);
+  delimiter = va_arg(args_copy, const char*);
+  va_end(args_copy);
+  dlen = strlen(delimiter);
+  
+  for (i = 0, str = strings; str != NULL; i++, str = va_arg(args, const char*))
+    {
+      if (i > 0)
+	len = put(buf, size, len, delimiter, dlen);
+      len = put(buf, size, len, str, strlen(str));
+    }
+  
+  return terminate(buf, size, len);
+}
+
+
+/**
+ * Concatenate strings and insert a delimiter between the strings.
+ * 
+ * Example:
+ *   s = libstring_vjoin("alpha", "bet", "s", NULL, "--");
+ *   # s is "alpha--bet--s"
+ *   free(s);
+ * 
+ * @param   strings...  List of strings to concatenate, end
+ *                      with a `NULL`.
+ * @param   delimiter   A string to insert between all strings.
+ * @return              A string with all strings in `strings`
+ *                      concatenated in order, with the
+ *                      delimiter `delimiter`. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_vjoin(const char* strings, ... /*, (char*)0, const char* delimiter */)
+{
+  STATS_ENTER(vjoin, 0);
+  va_list args, args_copy;
+  size_t len;
+  char* rc;
+  
+  va_start(args, strings);
+  va_copy(args_copy, args);
+  len = vjoin_into(NULL, 0, strings, args_copy);
+  va_end(args_copy);
+  STATS_INPUT(len);
+  
+  rc = allocate((len + 1) * sizeof(char));
+  if (rc != NULL)
+    vjoin_into(rc, len + 1, strings, args);
+  va_end(args);
+  STATS_OUTPUT(rc == NULL ? 0 : len);
+  return rc;
+}
+
+
+/**
+ * Concatenate strings and insert a delimiter between the
+ * strings, into a caller-provided buffer.
+ * 
+ * This is the same as `libstring_vjoin`, except the result
+ * is stored in `buf` and truncated, in the same way as
+ * `snprintf` does, if it does not fit.
+ * 
+ * @param   buf         Output buffer, may be `NULL` if `size` is 0.
+ * @param   size        The allocation size of `buf`.
+ * @param   strings...  List of strings to concatenate, end
+ *                      with a `NULL`.
+ * @param   delimiter   A string to insert between all strings.
+ * @return              The length of the result, excluding the
+ *                      terminating NUL byte. The result was
+ *                      truncated if this is not less than `size`.
+ */
+size_t libstring_vjoin_into(char* buf, size_t size, const char* strings,
+			    ... /*, (char*)0, const char* delimiter */)
+{
+  STATS_ENTER(vjoin_into, 0);
+  va_list args;
+  size_t rc;
+  va_start(args, strings);
+  rc = vjoin_into(buf, size, strings, args);
+  va_end(args);
+  STATS_INPUT(rc);
+  return STATS_INTO(rc, size);
+}
+
+
+/**
+ * Record a field found by `split`.
+ * 
+ * @param  spans   Output buffer for the spans, may be `NULL` if `size` is 0.
+ * @param  size    The number of elements `spans` can hold.
+ * @param  fields  Output buffer for the fields, `NULL` if not used.
+ * @param  bytes   Output buffer for the text of the fields.
+ * @param  k       The index of the field.
+ * @param  string  The string being split.
+ * @param  start   The position of the field in `string`.
+ * @param  end     The end of the field in `string`.
+ * @param  dlen    The length of the delimiter.
+ */
+static void split_store(struct libstring_span* spans, size_t size, char** fields, char* bytes,
+			size_t k, const char* string, size_t start, size_t end, size_t dlen)
+{
+  if (k < size)
+    {
+      spans[k].offset = start;
+      spans[k].length = end - start;
+    }
+  if (fields != NULL)
+    {
+      /* The k first fields are preceded by k delimiters and k NUL bytes. */
+      fields[k] = bytes + (start - k * dlen + k);
+      memcpy(fields[k], string + start, (end - start) * sizeof(char));
+      fields[k][end - start] = '\0';
+    }
+}
+
+
+/**
+ * Split a string at each occurrence of a selected delimiter.
+ * 
+ * @param   string     String to split.
+ * @param   len        The length of `string`.
+ * @param   delimiter  The delimiter.
+ * @param   flags      Additional options.
+ * @param   spans      Output buffer for the spans of the fields,
+ *                     may be `NULL` if `size` is 0.
+ * @param   size       The number of elements `spans` can hold.
+ * @param   fields     Output buffer for copies of the fields,
+ *                     `NULL` if not wanted. The copies are stored
+ *                     in `bytes`, which must be large enough.
+ * @param   bytes      Output buffer for the text of the fields.
+ * @return             The number of fields.
+ */
+static size_t split(const char* string, size_t len, const struct libstring_pattern* delimiter,
+		    enum libstring_split flags, struct libstring_span* spans, size_t size,
+		    char** fields, char* bytes)
+{
+  size_t i, p, k, n = 0, dlen = delimiter->length;
+  
+  if (dlen == 0)
+    {
+      split_store(spans, size, fields, bytes, 0, string, 0, len, 0);
+      return 1;
+    }
+  
+  if (!(flags & LIBSTRING_SPLIT_FROM_RIGHT))
+    {
+      for (i = 0; (p = find(string + i, len - i, delimiter, 0)) != SIZE_MAX; i += p + dlen)
+	split_store(spans, size, fields, bytes, n++, string, i, i + p, dlen);
+      split_store(spans, size, fields, bytes, n++, string, i, len, dlen);
+      return n;
+    }
+  
+  /* Matches are found from the end, so count first, then fill backwards. */
+  for (n = 1, i = len; (p = find(string, i, delimiter, 1)) != SIZE_MAX; i = p)
+    n++;
+  if ((size == 0) && (fields == NULL))
+    return n;
+  for (k = n, i = len; k-- > 0; i = p)
+    {
+      p = (k > 0) ? find(string, i, delimiter, 1) : 0;
+      split_store(spans, size, fields, bytes, k, string, (k > 0) ? (p + dlen) : 0, i, dlen);
+    }
+  return n;
+}
+
+
+/**
+ * Prepare a substring to search for, so that it can be
+ * used for any number of searches with the `_p` functions.
+ * 
+ * Nothing is allocated, so there is nothing to release.
+ * 
+ * @param  pattern  The prepared substring.
+ * @param  string   The substring, must remain valid
+ *                  while `pattern` is used.
+ * @param  flags    Additional options.
+ */
+void libstring_pattern_init(struct libstring_pattern* pattern, const char* string, enum libstring_pattern_init flags)
+{
+  pattern_compile(pattern, string, strlen(string), (flags & LIBSTRING_PATTERN_IGNORE_CASE) ? 1 : 0);
+}
+
+
+/**
+ * Prepare a substring of a given length to search for.
+ * 
+ * This is the same as `libstring_pattern_init`, except
+ * `string` has a given length, so it may contain NUL bytes.
+ * 
+ * @param  pattern  The prepared substring.
+ * @param  string   The substring, must remain valid
+ *                  while `pattern` is used.
+ * @param  n        The length of `string`.
+ * @param  flags    Additional options.
+ */
+void libstring_pattern_init_n(struct libstring_pattern* pattern, const char* string,
+			       size_t n, enum libstring_pattern_init flags)
+{
+  pattern_compile(pattern, string, n, (flags & LIBSTRING_PATTERN_IGNORE_CASE) ? 1 : 0);
+}
+
+
+/**
+ * Split a string at each occurrence of a selected delimiter.
+ * 
+ * The list and all strings in it are stored in
+ * a single allocation, only the list shall be freed.
+ * 
+ * Example:
+ *   fields = libstring_split("a,b,,c", ",", &n, 0);
+ *   # fields is {"a", "b", "", "c", NULL}, n is 4
+ *   free(fields);
+ * 
+ * @param   string     String to split.
+ * @param   delimiter  The delimiter.
+ * @param   n          Output parameter for the number of
+ *                     strings in the returned list. May be `NULL`.
+ * @param   flags      Additional options.
+ * @return             `NULL`-terminated list of the substrings in
+ *                     `string` which had `delimiter` between them.
+ *                     `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char** libstring_split(const char* string, const char* delimiter, size_t* n, enum libstring_split flags)
+{
+  STATS_ENTER(split, strlen(string));
+  struct libstring_pattern pat;
+  char** rc;
+  pattern_compile(&pat, delimiter, strlen(delimiter), (flags & LIBSTRING_SPLIT_IGNORE_CASE) ? 1 : 0);
+  rc = libstring_split_p(string, &pat, n, flags);
+  STATS_OUTPUT(rc == NULL ? 0 : stats_bytes((const char* const*)rc, SIZE_MAX));
+  return rc;
+}
+
+
+/**
+ * Split a string at each occurrence of a prepared delimiter.
+ * 
+ * This is the same as `libstring_split`, except the
+ * delimiter is prepared with `libstring_pattern_init`,
+ * which also selects whether case is ignored, so
+ * `LIBSTRING_SPLIT_IGNORE_CASE` is not used.
+ * 
+ * @param   string     String to split.
+ * @param   delimiter  The delimiter.
+ * @param   n          Output parameter for the number of
+ *                     strings in the returned list. May be `NULL`.
+ * @param   flags      Additional options.
+ * @return             `NULL`-terminated list of the substrings in
+ *                     `string` which had `delimiter` between them.
+ *                     `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char** libstring_split_p(const char* string, const struct libstring_pattern* delimiter,
+			 size_t* n, enum libstring_split flags)
+{
+  size_t len = strlen(string), dlen = delimiter->length, m;
+  STATS_ENTER(split_p, len);
+  char** rc;
+  
+  PROBE_ENTRY(split, len, flags);
+  m = split(string, len, delimiter, flags, NULL, 0, NULL, NULL);
+  rc = allocate((m + 1) * sizeof(char*) + (len - (m - 1) * dlen + m) * sizeof(char));
+  if (rc == NULL)
+    {
+      PROBE_RETURN(split, len, -1, flags);
+      return NULL;
+    }
+  
+  split(string, len, delimiter, flags, NULL, 0, rc, (char*)(rc + m + 1));
+  rc[m] = NULL;
+  if (n != NULL)
+    *n = m;
+  STATS_OUTPUT(stats_bytes((const char* const*)rc, m));
+  PROBE_RETURN(split, len, m, flags);
+  return rc;
+}
+
+
+/**
+ * Split a string at each occurrence of a selected delimiter,
+ * without copying the fields.
+ * 
+ * Example:
+ *   spans = libstring_split_spans("a,bc,,d", ",", &n, 0);
+ *   # spans is {{0, 1}, {2, 2}, {5, 0}, {6, 1}}, n is 4
+ *   free(spans);
+ * 
+ * @param   string     String to split.
+ * @param   delimiter  The delimiter.
+ * @param   n          Output parameter for the number of
+ *                     elements in the returned list. May be `NULL`.
+ * @param   flags      Additional options.
+ * @return             List of the positions and lengths in `string`
+ *                     of the substrings which had `delimiter` between
+ *                     them. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+struct libstring_span* libstring_split_spans(const char* string, const char* delimiter,
+					     size_t* n, enum libstring_split flags)
+{
+  STATS_ENTER(split_spans, strlen(string));
+  size_t m = libstring_split_spans_into(NULL, 0, string, delimiter, flags);
+  struct libstring_span* rc = allocate(m * sizeof(struct libstring_span));
+  if (rc == NULL)
+    return NULL;
+  libstring_split_spans_into(rc, m, string, delimiter, flags);
+  if (n != NULL)
+    *n = m;
+  return rc;
+}
+
+
+/**
+ * Split a string at each occurrence of a selected delimiter,
+ * without copying the fields, and store the positions of
+ * the fields in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_split_spans`, except
+ * the result is stored in `spans`, and truncated if it
+ * does not fit.
+ * 
+ * @param   spans      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size       The number of elements `spans` can hold.
+ * @param   string     String to split.
+ * @param   delimiter  The delimiter.
+ * @param   flags      Additional options.
+ * @return             The number of fields. The result was
+ *                     truncated if this is greater than `size`.
+ */
+size_t libstring_split_spans_into(struct libstring_span* spans, size_t size, const char* string,
+				  const char* delimiter, enum libstring_split flags)
+{
+  STATS_ENTER(split_spans_into, strlen(string));
+  struct libstring_pattern pat;
+  pattern_compile(&pat, delimiter, strlen(delimiter), (flags & LIBSTRING_SPLIT_IGNORE_CASE) ? 1 : 0);
+  return split(string, strlen(string), &pat, flags, spans, size, NULL, NULL);
+}
+
+
+/**
+ * Split a string at each occurrence of a prepared delimiter,
+ * without copying the fields, and store the positions of
+ * the fields in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_split_spans_into`, except
+ * the delimiter is prepared with `libstring_pattern_init`,
+ * which also selects whether case is ignored, so
+ * `LIBSTRING_SPLIT_IGNORE_CASE` is not used.
+ * 
+ * @param   spans      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size       The number of elements `spans` can hold.
+ * @param   string     String to split.
+ * @param   delimiter  The delimiter.
+ * @param   flags      Additional options.
+ * @return             The number of fields. The result was
+ *                     truncated if this is greater than `size`.
+ */
+size_t libstring_split_spans_p_into(struct libstring_span* spans, size_t size, const char* string,
+				    const struct libstring_pattern* delimiter, enum libstring_split flags)
+{
+  STATS_ENTER(split_spans_p_into, strlen(string));
+  return split(string, strlen(string), delimiter, flags, spans, size, NULL, NULL);
+}
+
+
+/**
+ * Split a string of a given length at each occurrence
+ * of a prepared delimiter, without copying the fields,
+ * and store the positions of the fields in a
+ * caller-provided buffer.
+ * 
+ * This is the same as `libstring_split_spans_p_into`,
+ * except `string` has a given length, so it may
+ * contain NUL bytes.
+ * 
+ * @param   spans      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size       The number of elements `spans` can hold.
+ * @param   string     String to split.
+ * @param   n          The length of `string`.
+ * @param   delimiter  The delimiter.
+ * @param   flags      Additional options.
+ * @return             The number of fields. The result was
+ *                     truncated if this is greater than `size`.
+ */
+size_t libstring_split_spans_n_into(struct libstring_span* spans, size_t size, const char* string, size_t n,
+				    const struct libstring_pattern* delimiter, enum libstring_split flags)
+{
+  STATS_ENTER(split_spans_n_into, n);
+  return split(string, n, delimiter, flags, spans, size, NULL, NULL);
+}
+
+
+/**
+ * Compare text with a part of the delimiter
+ * of a split iterator.
+ * 
+ * @param   it      The iterator.
+ * @param   s       The text.
+ * @param   offset  The position of the part of the delimiter.
+ * @param   n       The number of bytes to compare.
+ * @return          1 if equal, 0 otherwise.
+ */
+static int iter_eq(const struct libstring_split_iter* it, const char* s, size_t offset, size_t n)
+{
+  if (!it->pattern.ignore_case)
+    return !memcmp(s, it->delimiter + offset, n);
+  if (it->pattern.unicode)
+    return unicode_caseeq_part(&it->pattern, s, offset, n);
+  return ascii_caseeq(s, it->delimiter + offset, n);
+}
+
+
+/**
+ * Initialise an iterator over the fields of a string
+ * split at each occurrence of a selected delimiter.
+ * 
+ * With `LIBSTRING_SPLIT_FROM_RIGHT`, the fields are
+ * returned from the last to the first, and the input
+ * must be fed from its end to its beginning.
+ * 
+ * Example:
+ *   libstring_split_iter_init(&it, "a,b,,c", ",", 0);
+ *   while (libstring_split_iter_next(&it, &f, &n) == LIBSTRING_SPLIT_ITER_FIELD)
+ *     # f is "a", "b", "" and "c", n is the length of f
+ *   libstring_split_iter_destroy(&it);
+ * 
+ * @param  it         The iterator.
+ * @param  string     The string to split, `NULL` if the input
+ *                    will be fed with `libstring_split_iter_feed`.
+ * @param  delimiter  The delimiter, must remain valid until
+ *                    the iterator is destroyed.
+ * @param  flags      Additional options.
+ */
+void libstring_split_iter_init(struct libstring_split_iter* it, const char* string,
+			       const char* delimiter, enum libstring_split flags)
+{
+  struct libstring_pattern pat;
+  pattern_compile(&pat, delimiter, strlen(delimiter), (flags & LIBSTRING_SPLIT_IGNORE_CASE) ? 1 : 0);
+  libstring_split_iter_init_p(it, string, &pat, flags);
+}
+
+
+/**
+ * Initialise an iterator over the fields of a string
+ * split at each occurrence of a prepared delimiter.
+ * 
+ * This is the same as `libstring_split_iter_init`,
+ * except the delimiter is prepared with
+ * `libstring_pattern_init`, which also selects
+ * whether case is ignored, so
+ * `LIBSTRING_SPLIT_IGNORE_CASE` is not used.
+ * 
+ * @param  it         The iterator.
+ * @param  string     The string to split, `NULL` if the input
+ *                    will be fed with `libstring_split_iter_feed`.
+ * @param  delimiter  The delimiter, its substring must remain
+ *                    valid until the iterator is destroyed.
+ * @param  flags      Additional options.
+ */
+void libstring_split_iter_init_p(struct libstring_split_iter* it, const char* string,
+				 const struct libstring_pattern* delimiter, enum libstring_split flags)
+{
+  it->pattern = *delimiter;
+  it->delimiter = delimiter->pattern;
+  it->delimiter_length = delimiter->length;
+  it->flags = flags;
+  it->chunk = "";
+  it->chunk_length = it->position = 0;
+  it->last = 0;
+  it->done = 0;
+  it->carry = it->carry_buffer = NULL;
+  it->carry_length = 0;
+  if (string != NULL)
+    libstring_split_iter_feed(it, string, strlen(string), 1);
+}
+
+
+/**
+ * Feed the next chunk of input to a split iterator.
+ * 
+ * This shall be done once, at the beginning, or
+ * when `libstring_split_iter_next` has returned
+ * `LIBSTRING_SPLIT_ITER_MORE`.
+ * 
+ * @param   it      The iterator.
+ * @param   chunk   The chunk, must remain valid until
+ *                  `libstring_split_iter_next` returns
+ *                  `LIBSTRING_SPLIT_ITER_MORE` again.
+ * @param   length  The length of `chunk`.
+ * @param   last    Whether this is the last chunk.
+ * @return          0 on success, -1 on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_split_iter_feed(struct libstring_split_iter* it, const char* chunk, size_t length, int last)
+{
+  STATS_ENTER(split_iter_feed, length);
+  if (!last && (it->carry_buffer == NULL) && (it->delimiter_length > 1))
+    {
+      it->carry_buffer = allocate(it->delimiter_length * sizeof(char));
+      if (it->carry_buffer == NULL)
+	return -1;
+    }
+  it->chunk = chunk;
+  it->chunk_length = length;
+  it->position = (it->flags & LIBSTRING_SPLIT_FROM_RIGHT) ? length : 0;
+  it->last = last;
+  return 0;
+}
+
+
+/**
+ * Get the next field from a split iterator,
+ * when matching from left to right.
+ * 
+ * @param   it      The iterator.
+ * @param   field   Output parameter for the field.
+ * @param   length  Output parameter for the length of the field.
+ * @return          See `libstring_split_iter_next`.
+ */
+static enum libstring_split_iter_status iter_next(struct libstring_split_iter* it,
+						  const char** field, size_t* length)
+{
+  const char* chunk = it->chunk + it->position;
+  size_t dlen = it->delimiter_length, avail = it->chunk_length - it->position;
+  size_t s, r, need, p, k;
+  
+  /* Held back bytes from the previous chunk may begin a delimiter. */
+  if (it->carry_length > 0)
+    {
+      if ((avail == 0) && !it->last)
+	return LIBSTRING_SPLIT_ITER_MORE;
+      for (s = 0; s < it->carry_length; s++)
+	{
+	  r = it->carry_length - s;
+	  need = dlen - r;
+	  if (!iter_eq(it, it->carry + s, 0, r))
+	    continue;
+	  if (avail >= need)
+	    {
+	      if (!iter_eq(it, chunk, r, need))
+		continue;
+	      if (it->pattern.unicode && !unicode_caseeq(&it->pattern, it->carry + s, r, chunk))
+		continue;
+	      *field = it->carry, *length = s;
+	      it->position += need;
+	      it->carry_length = 0;
+	      return LIBSTRING_SPLIT_ITER_FIELD;
+	    }
+	  if (it->last || !iter_eq(it, chunk, r, avail))
+	    continue;
+	  if (s > 0)
+	    {
+	      *field = it->carry, *length = s;
+	      it->carry += s, it->carry_length -= s;
+	      return LIBSTRING_SPLIT_ITER_PARTIAL;
+	    }
+	  memmove(it->carry_buffer, it->carry, it->carry_length * sizeof(char));
+	  memcpy(it->carry_buffer + it->carry_length, chunk, avail * sizeof(char));
+	  it->carry = it->carry_buffer;
+	  it->carry_length += avail;
+	  it->position += avail;
+	  return LIBSTRING_SPLIT_ITER_MORE;
+	}
+      *field = it->carry, *length = it->carry_length;
+      it->carry_length = 0;
+      return LIBSTRING_SPLIT_ITER_PARTIAL;
+    }
+  
+  if ((dlen > 0) && ((p = find(chunk, avail, &it->pattern, 0)) != SIZE_MAX))
+    {
+      *field = chunk, *length = p;
+      it->position += p + dlen;
+      return LIBSTRING_SPLIT_ITER_FIELD;
+    }
+  
+  it->position += avail;
+  *field = chunk, *length = avail;
+  if (it->last)
+    {
+      it->done = 1;
+      return LIBSTRING_SPLIT_ITER_FIELD;
+    }
+  
+  /* Hold back the longest tail that can be the beginning of a delimiter. */
+  for (k = (dlen > 0) ? (avail < dlen - 1 ? avail : dlen - 1) : 0; k > 0; k--)
+    if (iter_eq(it, chunk + avail - k, 0, k))
+      break;
+  if (k > 0)
+    memcpy(it->carry_buffer, chunk + avail - k, k * sizeof(char));
+  it->carry = it->carry_buffer;
+  it->carry_length = k;
+  *length -= k;
+  return (*length > 0) ? LIBSTRING_SPLIT_ITER_PARTIAL : LIBSTRING_SPLIT_ITER_MORE;
+}
+
+
+/**
+ * Get the next field from a split iterator,
+ * when matching from right to left.
+ * 
+ * @param   it      The iterator.
+ * @param   field   Output parameter for the field.
+ * @param   length  Output parameter for the length of the field.
+ * @return          See `libstring_split_iter_next`.
+ */
+static enum libstring_split_iter_status iter_next_right(struct libstring_split_iter* it,
+							const char** field, size_t* length)
+{
+  const char* chunk = it->chunk;
+  size_t dlen = it->delimiter_length, avail = it->position;
+  size_t e, need, p, k;
+  
+  /* Held back bytes from the previous chunk may end a delimiter. */
+  if (it->carry_length > 0)
+    {
+      if ((avail == 0) && !it->last)
+	return LIBSTRING_SPLIT_ITER_MORE;
+      for (e = it->carry_length; e > 0; e--)
+	{
+	  need = dlen - e;
+	  if (!iter_eq(it, it->carry, need, e))
+	    continue;
+	  if (avail >= need)
+	    {
+	      if (!iter_eq(it, chunk + avail - need, 0, need))
+		continue;
+	      if (it->pattern.unicode && !unicode_caseeq(&it->pattern, chunk + avail - need, need, it->carry))
+		continue;
+	      *field = it->carry + e, *length = it->carry_length - e;
+	      it->position -= need;
+	      it->carry_length = 0;
+	      return LIBSTRING_SPLIT_ITER_FIELD;
+	    }
+	  if (it->last || !iter_eq(it, chunk, need - avail, avail))
+	    continue;
+	  if (e < it->carry_length)
+	    {
+	      *field = it->carry + e, *length = it->carry_length - e;
+	      it->carry_length = e;
+	      return LIBSTRING_SPLIT_ITER_PARTIAL;
+	    }
+	  memmove(it->carry_buffer + avail, it->carry, it->carry_length * sizeof(char));
+	  memcpy(it->carry_buffer, chunk, avail * sizeof(char));
+	  it->carry = it->carry_buffer;
+	  it->carry_length += avail;
+	  it->position = 0;
+	  return LIBSTRING_SPLIT_ITER_MORE;
+	}
+      *field = it->carry, *length = it->carry_length;
+      it->carry_length = 0;
+      return LIBSTRING_SPLIT_ITER_PARTIAL;
+    }
+  
+  if ((dlen > 0) && ((p = find(chunk, avail, &it->pattern, 1)) != SIZE_MAX))
+    {
+      *field = chunk + p + dlen, *length = avail - p - dlen;
+      it->position = p;
+      return LIBSTRING_SPLIT_ITER_FIELD;
+    }
+  
+  it->position = 0;
+  *field = chunk, *length = avail;
+  if (it->last)
+    {
+      it->done = 1;
+      return LIBSTRING_SPLIT_ITER_FIELD;
+    }
+  
+  /* Hold back the longest head that can be the end of a delimiter. */
+  for (k = (dlen > 0) ? (avail < dlen - 1 ? avail : dlen - 1) : 0; k > 0; k--)
+    if (iter_eq(it, chunk, dlen - k, k))
+      break;
+  if (k > 0)
+    memcpy(it->carry_buffer, chunk, k * sizeof(char));
+  it->carry = it->carry_buffer;
+  it->carry_length = k;
+  *field += k, *length -= k;
+  return (*length > 0) ? LIBSTRING_SPLIT_ITER_PARTIAL : LIBSTRING_SPLIT_ITER_MORE;
+}
+
+
+/**
+ * Get the next field, or part of a field, from a split iterator.
+ * 
+ * The returned text is not NUL-terminated, and is only
+ * valid until the next call to this function.
+ * 
+ * @param   it      The iterator.
+ * @param   field   Output parameter for the field.
+ * @param   length  Output parameter for the length of the field.
+ * @return          `LIBSTRING_SPLIT_ITER_FIELD` if the end of a field
+ *                  was found, `LIBSTRING_SPLIT_ITER_PARTIAL` if only a
+ *                  part of a field was found, `LIBSTRING_SPLIT_ITER_MORE`
+ *                  if the next chunk must be fed, or
+ *                  `LIBSTRING_SPLIT_ITER_END` if there are no more fields.
+ */
+enum libstring_split_iter_status libstring_split_iter_next(struct libstring_split_iter* it,
+							   const char** field, size_t* length)
+{
+  STATS_ENTER(split_iter_next, 0);
+  if (it->done)
+    return LIBSTRING_SPLIT_ITER_END;
+  if ((it->flags & LIBSTRING_SPLIT_FROM_RIGHT))
+    return iter_next_right(it, field, length);
+  return iter_next(it, field, length);
+}
+
+
+/**
+ * Release the resources of a split iterator.
+ * 
+ * This may be done before the last field
+ * has been returned.
+ * 
+ * @param  it  The iterator.
+ */
+void libstring_split_iter_destroy(struct libstring_split_iter* it)
+{
+  deallocate(it->carry_buffer);
+  it->carry = it->carry_buffer = NULL;
+  it->carry_length = 0;
+}
+
+
+/**
+ * Replace a prepared substring in a string of a given
+ * length, and store the result in a caller-provided buffer.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @param   from    Substring to replace.
+ * @param   to      String to substitute for `from`.
+ * @param   tn      The length of `to`.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+static size_t replace_into(char* buf, size_t size, const char* string, size_t n,
+			   const struct libstring_pattern* from, const char* to, size_t tn,
+			   enum libstring_replace flags)
+{
+  size_t fn = from->length, i, p, off, len = 0;
+  
+  if (fn == 0)
+    return terminate(buf, size, put(buf, size, 0, string, n));
+  
+  if (!(flags & LIBSTRING_REPLACE_FROM_RIGHT))
+    {
+      for (i = 0; (p = find(string + i, n - i, from, 0)) != SIZE_MAX; i += p + fn)
+	{
+	  len = put(buf, size, len, string + i, p);
+	  len = put(buf, size, len, to, tn);
+	}
+      len = put(buf, size, len, string + i, n - i);
+      return terminate(buf, size, len);
+    }
+  
+  /* Matches are found from the end, so measure first, then fill backwards. */
+  for (len = n, i = n; (p = find(string, i, from, 1)) != SIZE_MAX; i = p)
+    len = len - fn + tn;
+  if (size == 0)
+    return len;
+  for (off = len, i = n; (p = find(string, i, from, 1)) != SIZE_MAX; i = p)
+    {
+      off -= i - (p + fn);
+      put(buf, size, off, string + p + fn, i - (p + fn));
+      off -= tn;
+      put(buf, size, off, to, tn);
+    }
+  put(buf, size, 0, string, i);
+  return terminate(buf, size, len);
+}
+
+
+/**
+ * Replace a substrings in a string.
+ * 
+ * @param   string  The string to manipulate.
+ * @param   from    Substring to replace.
+ * @param   to      String to substitute for `from`.
+ * @param   flags   Additional options.
+ * @return          `string` with `to` substituted for `from`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_replace(const char* string, const char* from, const char* to, enum libstring_replace flags)
+{
+  size_t len = strlen(string), tn = strlen(to), n;
+  STATS_ENTER(replace, len);
+  struct libstring_pattern pat;
+  char* rc;
+  PROBE_ENTRY(replace, len, flags);
+  pattern_compile(&pat, from, strlen(from), (flags & LIBSTRING_REPLACE_IGNORE_CASE) ? 1 : 0);
+  n = replace_into(NULL, 0, string, len, &pat, to, tn, flags);
+  rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    replace_into(rc, n + 1, string, len, &pat, to, tn, flags);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  PROBE_RETURN(replace, len, rc == NULL ? (size_t)-1 : n, flags);
+  return rc;
+}
+
+
+/**
+ * Replace a substrings in a string, and store the
+ * result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_replace`, except the
+ * result is stored in `buf` and truncated, in the same
+ * way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @param   from    Substring to replace.
+ * @param   to      String to substitute for `from`.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+size_t libstring_replace_into(char* buf, size_t size, const char* string, const char* from,
+			      const char* to, enum libstring_replace flags)
+{
+  size_t len = strlen(string), rc;
+  STATS_ENTER(replace_into, len);
+  struct libstring_pattern pat;
+  PROBE_ENTRY(replace_into, len, flags);
+  pattern_compile(&pat, from, strlen(from), (flags & LIBSTRING_REPLACE_IGNORE_CASE) ? 1 : 0);
+  rc = replace_into(buf, size, string, len, &pat, to, strlen(to), flags);
+  PROBE_RETURN(replace_into, len, rc, flags);
+  return STATS_INTO(rc, size);
+}
+
+
+/**
+ * Replace a prepared substring in a string.
+ * 
+ * This is the same as `libstring_replace`, except the
+ * substring is prepared with `libstring_pattern_init`,
+ * which also selects whether case is ignored, so
+ * `LIBSTRING_REPLACE_IGNORE_CASE` is not used.
+ * 
+ * @param   string  The string to manipulate.
+ * @param   from    Substring to replace.
+ * @param   to      String to substitute for `from`.
+ * @param   flags   Additional options.
+ * @return          `string` with `to` substituted for `from`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_replace_p(const char* string, const struct libstring_pattern* from,
+			  const char* to, enum libstring_replace flags)
+{
+  size_t len = strlen(string), tn = strlen(to), n;
+  STATS_ENTER(replace_p, len);
+  char* rc;
+  PROBE_ENTRY(replace_p, len, flags);
+  n = replace_into(NULL, 0, string, len, from, to, tn, flags);
+  rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    replace_into(rc, n + 1, string, len, from, to, tn, flags);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  PROBE_RETURN(replace_p, len, rc == NULL ? (size_t)-1 : n, flags);
+  return rc;
+}
+
+
+/**
+ * Replace a prepared substring in a string, and store
+ * the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_replace_p`, except the
+ * result is stored in `buf` and truncated, in the same
+ * way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @param   from    Substring to replace.
+ * @param   to      String to substitute for `from`.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+size_t libstring_replace_p_into(char* buf, size_t size, const char* string,
+				const struct libstring_pattern* from, const char* to,
+				enum libstring_replace flags)
+{
+  size_t len = strlen(string), rc;
+  STATS_ENTER(replace_p_into, len);
+  PROBE_ENTRY(replace_p_into, len, flags);
+  rc = replace_into(buf, size, string, len, from, to, strlen(to), flags);
+  PROBE_RETURN(replace_p_into, len, rc, flags);
+  return STATS_INTO(rc, size);
+}
+
+
+/**
+ * Replace a prepared substring in a string of a given
+ * length, and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_replace_p`, except
+ * `string` and `to` have given lengths, so they may
+ * contain NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string` or `to`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @param   from    Substring to replace.
+ * @param   to      String to substitute for `from`.
+ * @param   tn      The length of `to`.
+ * @param   flags   Additional options.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_replace_str(struct libstring_str* out, const char* string, size_t n,
+			  const struct libstring_pattern* from, const char* to, size_t tn,
+			  enum libstring_replace flags)
+{
+  STATS_ENTER(replace_str, n);
+  int r;
+  PROBE_ENTRY(replace_str, n, flags);
+  while ((r = str_result(out, replace_into(out->ptr, out->cap, string, n, from, to, tn, flags))) > 0);
+  STATS_OUTPUT(out->len);
+  PROBE_RETURN(replace_str, n, r == 0 ? out->len : (size_t)-1, flags);
+  return r;
+}
+
+
+/**
+ * The options for `batch_replace`.
+ */
+struct batch_replace_ctx
+{
+  /**
+   * Substring to replace.
+   */
+  const struct libstring_pattern* from;
+  
+  /**
+   * String to substitute for `from`.
+   */
+  const char* to;
+  
+  /**
+   * The length of `to`.
+   */
+  size_t tn;
+  
+  /**
+   * Additional options.
+   */
+  enum libstring_replace flags;
+};
+
+
+/**
+ * `replace_into` as a `batch_transform_t`.
+ */
+static size_t batch_replace(char* buf, size_t size, const char* string, size_t n, const void* ctx)
+{
+  const struct batch_replace_ctx* r = ctx;
+  return replace_into(buf, size, string, n, r->from, r->to, r->tn, r->flags);
+}
+
+
+/**
+ * Replace a prepared substring in each string in an array.
+ * 
+ * This is the same as `libstring_replace_p`, applied to each string
+ * in an array, except the results are packed into one
+ * allocation, with their offsets in another.
+ * 
+ * @param   out      Output parameter for the results.
+ * @param   strings  The strings to manipulate.
+ * @param   n        The number of strings in `strings`.
+ * @param   from     Substring to replace.
+ * @param   to       String to substitute for `from`.
+ * @param   flags    Additional options.
+ * @return           0 on success, -1 on error, in
+ *                   which case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_replace_batch(struct libstring_batch* out, const char* const* strings, size_t n,
+			    const struct libstring_pattern* from, const char* to,
+			    enum libstring_replace flags)
+{
+  STATS_ENTER(replace_batch, stats_bytes(strings, n));
+  struct batch_replace_ctx ctx;
+  int r;
+  ctx.from = from;
+  ctx.to = to;
+  ctx.tn = strlen(to);
+  ctx.flags = flags;
+  r = batch(out, strings, n, batch_replace, &ctx);
+  STATS_OUTPUT(r == 0 ? out->offsets[n] - n : 0);
+  return r;
+}
+
+
+/**
+ * Compile a set of substrings to replace,
+ * for `libstring_replace_many`.
+ * 
+ * Empty substrings are never matched. If a substring
+ * occurs more than once, the first occurrence is used.
+ * With `LIBSTRING_REPLACE_IGNORE_CASE`, every combination
+ * of the case variants of the non-ASCII characters in a
+ * substring is added to the automaton, so its size grows
+ * with the number of such combinations.
+ * 
+ * @param   replacer  The replacer to initialise.
+ * @param   from      Substrings to replace.
+ * @param   to        Strings to substitute for the
+ *                    corresponding strings in `from`.
+ * @param   n         The number of elements in `from` and `to`.
+ * @param   flags     Additional options.
+ * @return            0 on success, -1 on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_replacer_initialise(struct libstring_replacer* replacer, const char* const* from,
+				  const char* const* to, size_t n, enum libstring_replace flags)
+{
+  STATS_ENTER(replacer_initialise, stats_bytes(from, n) + stats_bytes(to, n));
+  char variants[4][4];
+  const char* p;
+  size_t* transitions;
+  size_t* fail;
+  size_t* queue;
+  size_t* frontier;
+  size_t* next;
+  size_t states = 1, total = 0, bytes = 0, classes = 1, words, i, j, k, c, u, v, head, tail;
+  size_t len, paths, o, w, m, f, fn, nn;
+  int right = (flags & LIBSTRING_REPLACE_FROM_RIGHT) ? 1 : 0;
+  int icase = (flags & LIBSTRING_REPLACE_IGNORE_CASE) ? 1 : 0;
+  unsigned char b;
+  
+  /* Give each byte that occurs in a substring, or in a case variant of one of
+   * its non-ASCII characters, a class, so that the transition table does not
+   * need a column for every byte value. Substrings cannot contain NUL, so
+   * there are at most 256 classes, including class 0. Each combination of
+   * case variants is a path in the trie, of which there are `paths` through
+   * each character, in the order the characters are added to the trie, so
+   * a substring needs at most that many states per byte. */
+  memset(replacer->class_of, 0, sizeof(replacer->class_of));
+  for (i = 0; i < n; i++)
+    {
+      len = strlen(from[i]);
+      for (o = 0, paths = 1; o < len; o += w)
+	{
+	  w = right ? pattern_charlen_before(from[i], len - o) : pattern_charlen(from[i] + o, len - o);
+	  p = from[i] + (right ? len - o - w : o);
+	  memcpy(variants[0], p, w);
+	  m = 1;
+	  if (icase && (w > 1))
+	    m += case_variants(p, w, variants + 1, sizeof(variants) / sizeof(*variants) - 1);
+	  for (k = 0; k < m; k++)
+	    for (j = 0; j < w; j++)
+	      {
+		b = (unsigned char)variants[k][j];
+		if (icase && ((b | 0x20) >= 'a') && ((b | 0x20) <= 'z'))
+		  b |= 0x20;
+		if (replacer->class_of[b] == 0)
+		  {
+		    replacer->class_of[b] = (unsigned char)classes++;
+		    if (icase && (b >= 'a') && (b <= 'z'))
+		      replacer->class_of[b ^ 0x20] = replacer->class_of[b];
+		  }
+	      }
+	  if ((paths > SIZE_MAX / m) || (paths * m > (SIZE_MAX - total) / w))
+	    return errno = ENOMEM, -1;
+	  paths *= m;
+	  total += paths * w;
+	}
+      bytes += strlen(to[i]) + 1;
+    }
+  
+  /* Everything is stored in one allocation: the transitions, the depth,
+   * the match, the failure link and a queue slot for each state, the
+   * lengths of the substrings and the replacements, and the replacements. */
+  if (total >= SIZE_MAX / sizeof(size_t) / (classes + 4))
+    return errno = ENOMEM, -1;
+  words = (total + 1) * (classes + 4);
+  if (n > (SIZE_MAX / sizeof(size_t) - words) / 3)
+    return errno = ENOMEM, -1;
+  words += 3 * n;
+  if (bytes > SIZE_MAX - words * sizeof(size_t))
+    return errno = ENOMEM, -1;
+  transitions = allocate(words * sizeof(size_t) + bytes);
+  if (transitions == NULL)
+    return -1;
+  
+  replacer->flags       = flags;
+  replacer->n           = n;
+  replacer->classes     = classes;
+  replacer->transitions = transitions;
+  replacer->depth       = transitions + (total + 1) * classes;
+  replacer->match       = replacer->depth + (total + 1);
+  fail                  = replacer->match + (total + 1);
+  queue                 = fail + (total + 1);
+  replacer->from_length = queue + (total + 1);
+  replacer->to_length   = replacer->from_length + n;
+  replacer->to_offset   = replacer->to_length + n;
+  replacer->to_bytes    = (char*)(replacer->to_offset + n);
+  
+  memset(transitions, 0, (total + 1) * classes * sizeof(size_t));
+  replacer->depth[0] = 0;
+  replacer->match[0] = SIZE_MAX;
+  
+  /* Build a trie of the substrings, reversed if matching from the right.
+   * The root is never a child, so a transition to it means there is none.
+   * The states that each combination of case variants of the characters so
+   * far leads to, are kept in `queue` and `fail`, which are not used yet. */
+  for (i = 0, k = 0; i < n; i++)
+    {
+      replacer->from_length[i] = len = strlen(from[i]);
+      replacer->to_length[i] = strlen(to[i]);
+      replacer->to_offset[i] = k;
+      memcpy(replacer->to_bytes + k, to[i], (replacer->to_length[i] + 1) * sizeof(char));
+      k += replacer->to_length[i] + 1;
+      
+      frontier = queue, next = fail;
+      frontier[0] = 0, fn = 1;
+      for (o = 0; o < len; o += w)
+	{
+	  w = right ? pattern_charlen_before(from[i], len - o) : pattern_charlen(from[i] + o, len - o);
+	  p = from[i] + (right ? len - o - w : o);
+	  memcpy(variants[0], p, w);
+	  m = 1;
+	  if (icase && (w > 1))
+	    m += case_variants(p, w, variants + 1, sizeof(variants) / sizeof(*variants) - 1);
+	  for (f = nn = 0; f < fn; f++)
+	    for (c = 0; c < m; c++)
+	      {
+		for (u = frontier[f], j = 0; j < w; j++, u = v)
+		  {
+		    b = (unsigned char)variants[c][right ? w - 1 - j : j];
+		    v = transitions[u * classes + replacer->class_of[b]];
+		    if (v == 0)
+		      {
+			v = transitions[u * classes + replacer->class_of[b]] = states++;
+			replacer->depth[v] = o + j + 1;
+			replacer->match[v] = SIZE_MAX;
+		      }
+		  }
+		next[nn++] = u;
+	      }
+	  frontier = next, next = (frontier == queue) ? fail : queue;
+	  fn = nn;
+	}
+      for (f = 0; f < fn; f++)
+	if ((frontier[f] != 0) && (replacer->match[frontier[f]] == SIZE_MAX))
+	  replacer->match[frontier[f]] = i;
+    }
+  
+  /* Turn the trie into an automaton, breadth first, so that the failure
+   * link and the transitions of every shallower state are complete. A
+   * state that does not end a substring itself, inherits the longest
+   * substring that ends in its failure link, which is a shorter suffix. */
+  fail[0] = 0;
+  queue[0] = 0;
+  for (head = 0, tail = 1; head < tail; head++)
+    {
+      u = queue[head];
+      for (c = 0; c < classes; c++)
+	{
+	  v = transitions[u * classes + c];
+	  if (v == 0)
+	    {
+	      transitions[u * classes + c] = transitions[fail[u] * classes + c];
+	      continue;
+	    }
+	  fail[v] = (u == 0) ? 0 : transitions[fail[u] * classes + c];
+	  if (replacer->match[v] == SIZE_MAX)
+	    replacer->match[v] = replacer->match[fail[v]];
+	  queue[tail++] = v;
+	}
+    }
+  
+  return 0;
+}
+
+
+/**
+ * Release all memory of a replacer.
+ * 
+ * @param  replacer  The replacer.
+ */
+void libstring_replacer_destroy(struct libstring_replacer* replacer)
+{
+  deallocate(replacer->transitions);
+  replacer->transitions = NULL;
+}
+
+
+/**
+ * Find the leftmost longest substring of a replacer in a string.
+ * With `LIBSTRING_REPLACE_FROM_RIGHT`, positions are counted
+ * from the end of the string, and the string is read backwards.
+ * 
+ * @param   replacer  The replacer.
+ * @param   string    The string to search.
+ * @param   n         The length of `string`.
+ * @param   from      The position to start searching at.
+ * @param   which     Output parameter for the index of the found substring.
+ * @return            The position of the found substring,
+ *                    `SIZE_MAX` if none was found.
+ */
+static size_t replacer_find(const struct libstring_replacer* replacer, const char* string,
+			    size_t n, size_t from, size_t* which)
+{
+  const unsigned char* s = (const unsigned char*)string;
+  const size_t* transitions = replacer->transitions;
+  size_t i, m, start, state = 0, best = SIZE_MAX, classes = replacer->classes;
+  int right = (replacer->flags & LIBSTRING_REPLACE_FROM_RIGHT) ? 1 : 0;
+  
+  for (i = from; i < n; i++)
+    {
+      state = transitions[state * classes + replacer->class_of[s[right ? n - 1 - i : i]]];
+      /* A match has been found, and every partial
+       * match starts after it, so it is the best. */
+      if ((best != SIZE_MAX) && (i + 1 - replacer->depth[state] > best))
+	break;
+      m = replacer->match[state];
+      if (m == SIZE_MAX)
+	continue;
+      /* Matches are found in order of their end, so a later match
+       * that starts at the same position is longer. */
+      start = i + 1 - replacer->from_length[m];
+      if (start <= best)
+	best = start, *which = m;
+    }
+  
+  return best;
+}
+
+
+/**
+ * Replace multiple substrings in a string of a given length
+ * in one pass, and store the result in a caller-provided buffer.
+ * 
+ * @param   buf       Output buffer, may be `NULL` if `size` is 0.
+ * @param   size      The allocation size of `buf`.
+ * @param   string    The string to manipulate.
+ * @param   n         The length of `string`.
+ * @param   replacer  The substrings and their replacements.
+ * @return            The length of the result, excluding the
+ *                    terminating NUL byte. The result was
+ *                    truncated if this is not less than `size`.
+ */
+static size_t replace_many_into(char* buf, size_t size, const char* string, size_t n,
+				const struct libstring_replacer* replacer)
+{
+  const size_t* from_length = replacer->from_length;
+  const size_t* to_length = replacer->to_length;
+  size_t i, p, m, off, len = 0;
+  const char* to;
+  
+  if (!(replacer->flags & LIBSTRING_REPLACE_FROM_RIGHT))
+    {
+      for (i = 0; (p = replacer_find(replacer, string, n, i, &m)) != SIZE_MAX; i = p + from_length[m])
+	{
+	  len = put(buf, size, len, string + i, p - i);
+	  len = put(buf, size, len, replacer->to_bytes + replacer->to_offset[m], to_length[m]);
+	}
+      len = put(buf, size, len, string + i, n - i);
+      return terminate(buf, size, len);
+    }
+  
+  /* Matches are found from the end, so measure first, then fill backwards.
+   * A match at `p` from the end covers [n - p - from_length[m], n - p). */
+  for (len = n, i = 0; (p = replacer_find(replacer, string, n, i, &m)) != SIZE_MAX; i = p + from_length[m])
+    len = len - from_length[m] + to_length[m];
+  if (size == 0)
+    return len;
+  for (off = len, i = 0; (p = replacer_find(replacer, string, n, i, &m)) != SIZE_MAX; i = p + from_length[m])
+    {
+      off -= p - i;
+      put(buf, size, off, string + n - p, p - i);
+      to = replacer->to_bytes + replacer->to_offset[m];
+      off -= to_length[m];
+      put(buf, size, off, to, to_length[m]);
+    }
+  put(buf, size, 0, string, n - i);
+  return terminate(buf, size, len);
+}
+
+
+/**
+ * Replace multiple substrings in a string in one pass.
+ * 
+ * The string is scanned from left to right, or from
+ * right to left with `LIBSTRING_REPLACE_FROM_RIGHT`,
+ * and at each position the longest substring is
+ * replaced. Replacements are not rescanned.
+ * 
+ * @param   string    The string to manipulate.
+ * @param   replacer  The substrings and their replacements.
+ * @return            `string` with the replacements substituted
+ *                    for the substrings. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_replace_many(const char* string, const struct libstring_replacer* replacer)
+{
+  size_t len = strlen(string), n;
+  STATS_ENTER(replace_many, len);
+  char* rc;
+  PROBE_ENTRY(replace_many, len, replacer->flags);
+  n = replace_many_into(NULL, 0, string, len, replacer);
+  rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    replace_many_into(rc, n + 1, string, len, replacer);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  PROBE_RETURN(replace_many, len, rc == NULL ? (size_t)-1 : n, replacer->flags);
+  return rc;
+}
+
+
+/**
+ * Replace multiple substrings in a string in one pass,
+ * and store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_replace_many`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf       Output buffer, may be `NULL` if `size` is 0.
+ * @param   size      The allocation size of `buf`.
+ * @param   string    The string to manipulate.
+ * @param   replacer  The substrings and their replacements.
+ * @return            The length of the result, excluding the
+ *                    terminating NUL byte. The result was
+ *                    truncated if this is not less than `size`.
+ */
+size_t libstring_replace_many_into(char* buf, size_t size, const char* string,
+				   const struct libstring_replacer* replacer)
+{
+  size_t len = strlen(string), rc;
+  STATS_ENTER(replace_many_into, len);
+  PROBE_ENTRY(replace_many_into, len, replacer->flags);
+  rc = replace_many_into(buf, size, string, len, replacer);
+  PROBE_RETURN(replace_many_into, len, rc, replacer->flags);
+  return STATS_INTO(rc, size);
+}
+
+
+/**
+ * Replace multiple substrings in a string of a given
+ * length in one pass, and store the result in a
+ * `struct libstring_str`.
+ * 
+ * This is the same as `libstring_replace_many`, except
+ * `string` has a given length, so it may contain NUL
+ * bytes, and the result is stored in `out`.
+ * 
+ * @param   out       Output string, its allocation is reused
+ *                    if the result fits in it. Must not
+ *                    overlap `string`.
+ * @param   string    The string to manipulate.
+ * @param   n         The length of `string`.
+ * @param   replacer  The substrings and their replacements.
+ * @return            0 on success, -1 on error, in which
+ *                    case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_replace_many_str(struct libstring_str* out, const char* string, size_t n,
+			       const struct libstring_replacer* replacer)
+{
+  STATS_ENTER(replace_many_str, n);
+  int r;
+  PROBE_ENTRY(replace_many_str, n, replacer->flags);
+  while ((r = str_result(out, replace_many_into(out->ptr, out->cap, string, n, replacer))) > 0);
+  STATS_OUTPUT(out->len);
+  PROBE_RETURN(replace_many_str, n, r == 0 ? out->len : (size_t)-1, replacer->flags);
+  return r;
+}
+
+
+/**
+ * `r = libstring_shellsafe(s)` is equivalent to
+ * `t = libstring_replace(s, "'", "'\''", 0);
+ *  if (t && (r = malloc(strlen(t) + 3)))
+ *    *r = '\'', strcpy(stpcpy(r + 1, t), "'");
+ *  saved_errno = errno, free(t), errno = saved_errno;
+ *  r;`.
+ * You guess what it does, and why.
+ * 
+ * @param   string  The string to manipulate.
+ * @return          The result. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_shellsafe(const char* string)
+{
+  STATS_ENTER(shellsafe, strlen(string));
+  size_t n = libstring_shellsafe_into(NULL, 0, string);
+  char* rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    libstring_shellsafe_into(rc, n + 1, string);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  return rc;
+}
+
+
+/**
+ * Quote a string of a given length for the shell,
+ * and store the result in a caller-provided buffer.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+static size_t shellsafe_into(char* buf, size_t size, const char* string, size_t n)
+{
+  const char* q;
+  size_t len = put(buf, size, 0, "'", 1);
+  
+  for (; (q = memchr(string, '\'', n)) != NULL; n -= (size_t)(q + 1 - string), string = q + 1)
+    {
+      len = put(buf, size, len, string, (size_t)(q - string));
+      len = put(buf, size, len, "'\\''", 4);
+    }
+  len = put(buf, size, len, string, n);
+  len = put(buf, size, len, "'", 1);
+  
+  return terminate(buf, size, len);
+}
+
+
+/**
+ * Quote a string for the shell, and store the
+ * result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_shellsafe`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+size_t libstring_shellsafe_into(char* buf, size_t size, const char* string)
+{
+  STATS_ENTER(shellsafe_into, strlen(string));
+  return STATS_INTO(shellsafe_into(buf, size, string, strlen(string)), size);
+}
+
+
+/**
+ * Quote a string of a given length for the shell,
+ * and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_shellsafe`, except
+ * `string` has a given length, so it may contain NUL
+ * bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_shellsafe_str(struct libstring_str* out, const char* string, size_t n)
+{
+  STATS_ENTER(shellsafe_str, n);
+  int r;
+  while ((r = str_result(out, shellsafe_into(out->ptr, out->cap, string, n))) > 0);
+  STATS_OUTPUT(out->len);
+  return r;
+}
+
+
+/* No character below U+0300 is a combining mark, so a block of UTF-8
+ * without any byte above 0xCB can be measured by its character count.
+ * When measuring display length, only printable ASCII can. */
+#define COMBINING_LEAD_MIN  0xCC
+
+
+/**
+ * Count the characters in a string, 8 bytes at a time.
+ * 
+ * @param   s    The string.
+ * @param   n    The length of `s`.
+ * @param   ip   The offset to start at, updated to the offset
+ *               counting stopped at: before the first block
+ *               with a byte outside [`min`, `max`], or before
+ *               the last partial block.
+ * @param   min  The lowest byte value to accept.
+ * @param   max  The highest byte value to accept.
+ * @return       The number of bytes, in the counted blocks,
+ *               that are not continuation bytes.
+ */
+static size_t count_chars_word(const unsigned char* s, size_t n, size_t* ip,
+				unsigned char min, unsigned char max)
+{
+  const uint64_t ones = UINT64_C(0x0101010101010101);
+  size_t i = *ip, j, count = 0;
+  uint64_t word, suspect;
+  
+  for (; n - i >= 8; i += 8)
+    {
+      memcpy(&word, s + i, 8);
+      /* Flag a superset of the bytes outside the range: bytes of
+       * the form 11______ if `max` is at least 0xBF, otherwise
+       * bytes above `max` or non-ASCII, and bytes below `min`. */
+      suspect = 0;
+      if (max < 0x80)
+	suspect = ((word + ones * (0x7F - max)) | word) & (ones << 7);
+      else if (max < 0xBF)
+	suspect = word & (ones << 7);
+      else if (max < 0xFF)
+	suspect = word & (word << 1) & (ones << 7);
+      if (min)
+	suspect |= (word - ones * min) & ~word & (ones << 7);
+      if (suspect)
+	{
+	  for (j = 0; (j < 8) && (min <= s[i + j]) && (s[i + j] <= max); j++);
+	  if (j < 8)
+	    break;
+	}
+      /* Count the bytes not of the form 10______. */
+      word = ((~word >> 7) | (word >> 6)) & ones;
+      count += (size_t)((word * ones) >> 56);
+    }
+  
+  *ip = i;
+  return count;
+}
+
+
+#if defined(HAVE_X86_SIMD)
+
+/**
+ * Count the characters in a string, 16 bytes at a time.
+ * 
+ * @param   s    The string.
+ * @param   n    The length of `s`.
+ * @param   ip   The offset to start at, updated to the offset
+ *               counting stopped at: before the first block
+ *               with a byte outside [`min`, `max`], or before
+ *               the last partial block.
+ * @param   min  The lowest byte value to accept.
+ * @param   max  The highest byte value to accept.
+ * @return       The number of bytes, in the counted blocks,
+ *               that are not continuation bytes.
+ */
+__attribute__((__target__("sse2")))
+static size_t count_chars_sse2(const unsigned char* s, size_t n, size_t* ip,
+				unsigned char min, unsigned char max)
+{
+  const __m128i last_continuation = _mm_set1_epi8((char)0xBF);
+  const __m128i low = _mm_set1_epi8((char)min);
+  const __m128i high = _mm_set1_epi8((char)max);
+  const __m128i zero = _mm_setzero_si128();
+  size_t i = *ip, count = 0;
+  __m128i v, outside;
+  
+  for (; n - i >= 16; i += 16)
+    {
+      v = _mm_loadu_si128((const __m128i*)(s + i));
+      outside = _mm_or_si128(_mm_subs_epu8(v, high), _mm_subs_epu8(low, v));
+      if (_mm_movemask_epi8(_mm_cmpeq_epi8(outside, zero)) != 0xFFFF)
+	break;
+      /* As signed bytes, continuation bytes are exactly those not above 0xBF. */
+      count += (size_t)__builtin_popcount((unsigned)_mm_movemask_epi8(_mm_cmpgt_epi8(v, last_continuation)));
+    }
+  
+  *ip = i;
+  return count;
+}
+
+
+/**
+ * Count the characters in a string, 32 bytes at a time.
+ * 
+ * @param   s    The string.
+ * @param   n    The length of `s`.
+ * @param   ip   The offset to start at, updated to the offset
+ *               counting stopped at: before the first block
+ *               with a byte outside [`min`, `max`], or before
+ *               the last partial block.
+ * @param   min  The lowest byte value to accept.
+ * @param   max  The highest byte value to accept.
+ * @return       The number of bytes, in the counted blocks,
+ *               that are not continuation bytes.
+ */
+__attribute__((__target__("avx2")))
+static size_t count_chars_avx2(const unsigned char* s, size_t n, size_t* ip,
+				unsigned char min, unsigned char max)
+{
+  const __m256i last_continuation = _mm256_set1_epi8((char)0xBF);
+  const __m256i low = _mm256_set1_epi8((char)min);
+  const __m256i high = _mm256_set1_epi8((char)max);
+  size_t i = *ip, count = 0;
+  __m256i v, outside;
+  
+  for (; n - i >= 32; i += 32)
+    {
+      v = _mm256_loadu_si256((const __m256i*)(s + i));
+      outside = _mm256_or_si256(_mm256_subs_epu8(v, high), _mm256_subs_epu8(low, v));
+      if (!_mm256_testz_si256(outside, outside))
+	break;
+      count += (size_t)__builtin_popcount((unsigned)_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, last_continuation)));
+    }
+  
+  *ip = i;
+  return count;
+}
+
+#endif
+
+
+/**
+ * Count the characters in a string, as many bytes
+ * at a time as the processor supports.
+ * 
+ * @param   s    The string.
+ * @param   n    The length of `s`.
+ * @param   ip   The offset to start at, updated to the offset
+ *               counting stopped at: before the first block
+ *               with a byte outside [`min`, `max`], or before
+ *               the last partial block.
+ * @param   min  The lowest byte value to accept.
+ * @param   max  The highest byte value to accept.
+ * @return       The number of bytes, in the counted blocks,
+ *               that are not continuation bytes.
+ */
+static size_t count_chars(const unsigned char* s, size_t n, size_t* ip,
+			  unsigned char min, unsigned char max)
+{
+#if defined(HAVE_X86_SIMD)
+  if (__builtin_cpu_supports("avx2"))
+    return count_chars_avx2(s, n, ip, min, max);
+  if (__builtin_cpu_supports("sse2"))
+    return count_chars_sse2(s, n, ip, min, max);
+#endif
+  return count_chars_word(s, n, ip, min, max);
+}
+
+
+/**
+ * Measure the length of a string.
+ * 
+ * @param   string  The string to measure.
+ * @param   flags   Additional options.
+ * @return          The length of `string`.
+ */
+size_t libstring_length(const char* string, enum libstring_length flags)
+{
+  STATS_ENTER(length, strlen(string));
+  return libstring_length_n(string, strlen(string), flags);
+}
+
+
+/**
+ * Measure the length of a string of a given length.
+ * 
+ * This is the same as `libstring_length`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, which are counted as characters.
+ * 
+ * @param   string  The string to measure.
+ * @param   n       The length of `string`, in bytes.
+ * @param   flags   Additional options.
+ * @return          The length of `string`.
+ */
+size_t libstring_length_n(const char* string, size_t n, enum libstring_length flags)
+{
+  STATS_ENTER(length_n, n);
+  const unsigned char* s = (const unsigned char*)string;
+  size_t i = 0, end, k, len = 0;
+  unsigned char min = 0, max = 0xFF;
+  uint32_t cp, prev = 0;
+  
+  PROBE_ENTRY(length, n, flags);
+  if ((flags & LIBSTRING_LENGTH_DISPLAY_LENGTH))
+    min = 0x20, max = 0x7E;
+  else if ((flags & LIBSTRING_LENGTH_IGNORE_COMBINING))
+    max = COMBINING_LEAD_MIN - 1;
+  
+  while (i < n)
+    {
+      end = i;
+      len += count_chars(s, n, &i, min, max);
+      if (i != end)
+	prev = 0;
+      
+      /* Measure the block that could not be counted
+       * in bulk, or the tail, character by character. */
+      end = n - i < 32 ? n : i + 32;
+      while (i < end)
+	{
+	  if ((s[i] & 0xC0) == 0x80)
+	    {
+	      i++;
+	      continue;
+	    }
+	  cp = utf8_decode(string + i, n - i, &k);
+	  i += k;
+	  len += char_length(cp, prev, flags);
+	  prev = cp;
+	}
+    }
+  
+  PROBE_RETURN(length, n, len, flags);
+  return len;
+}
+
+#undef COMBINING_LEAD_MIN
+
+
+/**
+ * Get the number of leading ASCII bytes in a string.
+ * 
+ * @param   s  The string.
+ * @param   n  The length of `s`.
+ * @return     The number of bytes before the first
+ *             non-ASCII byte, `n` if there is none.
+ */
+static size_t ascii_prefix(const unsigned char* s, size_t n)
+{
+  size_t i = 0;
+#if defined(__SSE2__)
+  int mask;
+  for (; i + 16 <= n; i += 16)
+    if ((mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(s + i)))))
+      return i + (size_t)__builtin_ctz((unsigned)mask);
+#else
+  uint64_t word;
+  for (; i + 8 <= n; i += 8)
+    {
+      memcpy(&word, s + i, 8);
+      if (word & UINT64_C(0x8080808080808080))
+	break;
+    }
+#endif
+  while ((i < n) && (s[i] < 0x80))
+    i++;
+  return i;
+}
+
+
+/**
+ * Validate UTF-8, byte by byte, supporting all
+ * options for `libstring_utf8verify`.
+ * 
+ * @param   s      The string to validate.
+ * @param   n      The length of `s`.
+ * @param   flags  Additional options.
+ * @return         0 if the string is valid, -1 otherwise.
+ */
+static int utf8verify_scalar(const unsigned char* s, size_t n, enum libstring_utf8verify flags)
+{
+  static const uint64_t min_value[] = {0, 0, 0x80, 0x800, 0x10000, 0x200000,
+				       0x4000000, UINT64_C(0x80000000), UINT64_C(0x1000000000)};
+  size_t i = 0, j, len, max_len;
+  uint64_t cp, max_cp;
+  unsigned char c;
+  
+  if ((flags & LIBSTRING_UTF8VERIFY_8_BYTES))   flags |= LIBSTRING_UTF8VERIFY_32_BITS;
+  if ((flags & LIBSTRING_UTF8VERIFY_32_BITS))   flags |= LIBSTRING_UTF8VERIFY_31_BITS;
+  if ((flags & LIBSTRING_UTF8VERIFY_LAX))       flags |= LIBSTRING_UTF8VERIFY_MOD_UTF8;
+  
+  if ((flags & LIBSTRING_UTF8VERIFY_8_BYTES))
+    max_len = 8, max_cp = (UINT64_C(1) << 42) - 1;
+  else if ((flags & LIBSTRING_UTF8VERIFY_32_BITS))
+    max_len = 7, max_cp = UINT64_C(0xFFFFFFFF);
+  else if ((flags & LIBSTRING_UTF8VERIFY_31_BITS))
+    max_len = 6, max_cp = UINT64_C(0x7FFFFFFF);
+  else
+    max_len = 4, max_cp = UINT64_C(0x10FFFF);
+  
+  while (i < n)
+    {
+      c = s[i];
+      if (c < 0x80)
+	{
+	  i += ascii_prefix(s + i, n - i);
+	  continue;
+	}
+      if (c < 0xC0)
+	return -1;
+      for (len = 2; (len < 8) && (c & (0x80 >> len)); len++);
+      if ((len > max_len) || (len > n - i))
+	return -1;
+      
+      cp = c & (0x7F >> len);
+      for (j = 1; j < len; j++)
+	{
+	  if ((s[i + j] & 0xC0) != 0x80)
+	    return -1;
+	  cp = (cp << 6) | (s[i + j] & 0x3F);
+	}
+      
+      if (cp > max_cp)
+	return -1;
+      if (!(flags & LIBSTRING_UTF8VERIFY_LAX) && (cp < min_value[len]))
+	if (!(flags & LIBSTRING_UTF8VERIFY_MOD_UTF8) || (len != 2) || (cp != 0))
+	  return -1;
+      if (!(flags & LIBSTRING_UTF8VERIFY_31_BITS) && (0xD800 <= cp) && (cp <= 0xDFFF))
+	return -1;
+      i += len;
+    }
+  
+  return 0;
+}
+
+
+#if defined(HAVE_X86_SIMD)
+
+/* Classification of a byte pair for the lookup table validation, by the high
+ * nibble of the first byte, the low nibble of the first byte and the high
+ * nibble of the second byte. A pair is invalid if all three lookups agree on
+ * an error bit. The TWO_CONTS bit is instead expected exactly where a third
+ * or fourth byte of a sequence is. TWO_CONTS is a `char`, so that the
+ * entries it is in do not overflow the `char` arguments of the
+ * `_mm_setr_epi8` and `_mm256_setr_epi8` intrinsics. */
+# define TOO_SHORT       (1 << 0)
+# define TOO_LONG        (1 << 1)
+# define OVERLONG_3      (1 << 2)
+# define TOO_LARGE       (1 << 3)
+# define SURROGATE       (1 << 4)
+# define OVERLONG_2      (1 << 5)
+# define TOO_LARGE_1000  (1 << 6)
+# define OVERLONG_4      (1 << 6)
+# define TWO_CONTS       ((char)(1 << 7))
+# define CARRY           (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+# define BYTE_1_HIGH\
+  TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,\
+  TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,\
+  TOO_SHORT | OVERLONG_2,\
+  TOO_SHORT,\
+  TOO_SHORT | OVERLONG_3 | SURROGATE,\
+  TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+
+# define BYTE_1_LOW\
+  CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,\
+  CARRY | OVERLONG_2,\
+  CARRY,\
+  CARRY,\
+  CARRY | TOO_LARGE,\
+  CARRY | TOO_LARGE | TOO_LARGE_1000,\
+  CARRY | TOO_LARGE | TOO_LARGE_1000,\
+  CARRY | TOO_LARGE | TOO_LARGE_1000,\
+  CARRY | TOO_LARGE | TOO_LARGE_1000,\
+  CARRY | TOO_LARGE | TOO_LARGE_1000,\
+  CARRY | TOO_LARGE | TOO_LARGE_1000,\
+  CARRY | TOO_LARGE | TOO_LARGE_1000,\
+  CARRY | TOO_LARGE | TOO_LARGE_1000,\
+  CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,\
+  CARRY | TOO_LARGE | TOO_LARGE_1000,\
+  CARRY | TOO_LARGE | TOO_LARGE_1000
+
+# define BYTE_2_HIGH\
+  TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,\
+  TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,\
+  TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,\
+  TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,\
+  TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,\
+  TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+
+# define INCOMPLETE_TAIL  (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1)
+
+
+/**
+ * Validate standard UTF-8, 16 bytes at a time.
+ * 
+ * @param   s  The string to validate.
+ * @param   n  The length of `s`.
+ * @return     0 if the string is valid, -1 otherwise.
+ */
+__attribute__((__target__("ssse3")))
+static int utf8verify_ssse3(const unsigned char* s, size_t n)
+{
+  const __m128i byte_1_high = _mm_setr_epi8(BYTE_1_HIGH);
+  const __m128i byte_1_low  = _mm_setr_epi8(BYTE_1_LOW);
+  const __m128i byte_2_high = _mm_setr_epi8(BYTE_2_HIGH);
+  const __m128i nibble = _mm_set1_epi8(0x0F);
+  const __m128i max_value = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+					  -1, -1, -1, -1, -1, INCOMPLETE_TAIL);
+  __m128i prev = _mm_setzero_si128(), incomplete = prev, error = prev;
+  __m128i in, prev1, sc, must23;
+  unsigned char tail[16];
+  size_t i;
+  
+  for (i = 0; i < n; i += 16)
+    {
+      if (n - i >= 16)
+	in = _mm_loadu_si128((const __m128i*)(s + i));
+      else
+	{
+	  memset(tail, 0, sizeof(tail));
+	  memcpy(tail, s + i, n - i);
+	  in = _mm_loadu_si128((const __m128i*)tail);
+	}
+      
+      if (!_mm_movemask_epi8(in))
+	{
+	  error = _mm_or_si128(error, incomplete);
+	  incomplete = _mm_setzero_si128();
+	  prev = in;
+	  continue;
+	}
+      
+      prev1 = _mm_alignr_epi8(in, prev, 15);
+      sc = _mm_and_si128(_mm_and_si128(
+	     _mm_shuffle_epi8(byte_1_high, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+	     _mm_shuffle_epi8(byte_1_low, _mm_and_si128(prev1, nibble))),
+	     _mm_shuffle_epi8(byte_2_high, _mm_and_si128(_mm_srli_epi16(in, 4), nibble)));
+      must23 = _mm_or_si128(_mm_subs_epu8(_mm_alignr_epi8(in, prev, 14), _mm_set1_epi8(0xE0 - 0x80)),
+			    _mm_subs_epu8(_mm_alignr_epi8(in, prev, 13), _mm_set1_epi8(0xF0 - 0x80)));
+      must23 = _mm_and_si128(must23, _mm_set1_epi8((char)0x80));
+      error = _mm_or_si128(error, _mm_xor_si128(must23, sc));
+      
+      incomplete = _mm_subs_epu8(in, max_value);
+      prev = in;
+    }
+  
+  error = _mm_or_si128(error, incomplete);
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF ? 0 : -1;
+}
+
+
+/**
+ * Validate standard UTF-8, 32 bytes at a time.
+ * 
+ * @param   s  The string to validate.
+ * @param   n  The length of `s`.
+ * @return     0 if the string is valid, -1 otherwise.
+ */
+__attribute__((__target__("avx2")))
+static int utf8verify_avx2(const unsigned char* s, size_t n)
+{
+  const __m256i byte_1_high = _mm256_setr_epi8(BYTE_1_HIGH, BYTE_1_HIGH);
+  const __m256i byte_1_low  = _mm256_setr_epi8(BYTE_1_LOW, BYTE_1_LOW);
+  const __m256i byte_2_high = _mm256_setr_epi8(BYTE_2_HIGH, BYTE_2_HIGH);
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  const __m256i max_value = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+					     -1, -1, -1, -1, -1, -1, -1, -1,
+					     -1, -1, -1, -1, -1, -1, -1, -1,
+					     -1, -1, -1, -1, -1, INCOMPLETE_TAIL);
+  __m256i prev = _mm256_setzero_si256(), incomplete = prev, error = prev;
+  __m256i in, shifted, prev1, sc, must23;
+  unsigned char tail[32];
+  size_t i;
+  
+  for (i = 0; i < n; i += 32)
+    {
+      if (n - i >= 32)
+	in = _mm256_loadu_si256((const __m256i*)(s + i));
+      else
+	{
+	  memset(tail, 0, sizeof(tail));
+	  memcpy(tail, s + i, n - i);
+	  in = _mm256_loadu_si256((const __m256i*)tail);
+	}
+      
+      if (!_mm256_movemask_epi8(in))
+	{
+	  error = _mm256_or_si256(error, incomplete);
+	  incomplete = _mm256_setzero_si256();
+	  prev = in;
+	  continue;
+	}
+      
+      /* The high lane of `prev` and the low lane of `in`, for shifting across lanes. */
+      shifted = _mm256_permute2x128_si256(prev, in, 0x21);
+      prev1 = _mm256_alignr_epi8(in, shifted, 15);
+      sc = _mm256_and_si256(_mm256_and_si256(
+	     _mm256_shuffle_epi8(byte_1_high, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+	     _mm256_shuffle_epi8(byte_1_low, _mm256_and_si256(prev1, nibble))),
+	     _mm256_shuffle_epi8(byte_2_high, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble)));
+      must23 = _mm256_or_si256(_mm256_subs_epu8(_mm256_alignr_epi8(in, shifted, 14),
+						_mm256_set1_epi8(0xE0 - 0x80)),
+			       _mm256_subs_epu8(_mm256_alignr_epi8(in, shifted, 13),
+						_mm256_set1_epi8(0xF0 - 0x80)));
+      must23 = _mm256_and_si256(must23, _mm256_set1_epi8((char)0x80));
+      error = _mm256_or_si256(error, _mm256_xor_si256(must23, sc));
+      
+      incomplete = _mm256_subs_epu8(in, max_value);
+      prev = in;
+    }
+  
+  error = _mm256_or_si256(error, incomplete);
+  return _mm256_testz_si256(error, error) ? 0 : -1;
+}
+
+# undef TOO_SHORT
+# undef TOO_LONG
+# undef OVERLONG_3
+# undef TOO_LARGE
+# undef SURROGATE
+# undef OVERLONG_2
+# undef TOO_LARGE_1000
+# undef OVERLONG_4
+# undef TWO_CONTS
+# undef CARRY
+# undef BYTE_1_HIGH
+# undef BYTE_1_LOW
+# undef BYTE_2_HIGH
+# undef INCOMPLETE_TAIL
+
+#endif
+
+
+/**
+ * Validate UTF-8, with the fastest validator
+ * that supports the options.
+ * 
+ * @param   s      The string to validate.
+ * @param   n      The length of `s`.
+ * @param   flags  Additional options.
+ * @return         0 if the string is valid, -1 otherwise.
+ */
+static int utf8verify(const unsigned char* s, size_t n, enum libstring_utf8verify flags)
+{
+#if defined(HAVE_X86_SIMD)
+  /* The vectorised validators only accept standard UTF-8. Modified
+   * UTF-8 is standard UTF-8 with the addition of 0xC0 0x80, so fall
+   * back to byte by byte validation only if that is rejected. */
+  if (!(flags & ~LIBSTRING_UTF8VERIFY_MOD_UTF8))
+    {
+      if (__builtin_cpu_supports("avx2") ? !utf8verify_avx2(s, n) :
+	  __builtin_cpu_supports("ssse3") ? !utf8verify_ssse3(s, n) : 0)
+	return 0;
+      if (!flags && (__builtin_cpu_supports("avx2") || __builtin_cpu_supports("ssse3")))
+	return -1;
+    }
+#endif
+  
+  return utf8verify_scalar(s, n, flags);
+}
+
+
+/**
+ * Validate teh encoding of a string.
+ * 
+ * @param   string  The string to validate.
+ * @param   flags   Additional options.
+ * @return          0 if the string is valid, -1 otherwise.
+ */
+int libstring_utf8verify(const char* string, enum libstring_utf8verify flags)
+{
+  STATS_ENTER(utf8verify, strlen(string));
+  return libstring_utf8verify_n(string, strlen(string), flags);
+}
+
+
+/**
+ * Validate the encoding of a string of a given length.
+ * 
+ * This is the same as `libstring_utf8verify`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, which are valid characters.
+ * 
+ * @param   string  The string to validate.
+ * @param   n       The length of `string`.
+ * @param   flags   Additional options.
+ * @return          0 if the string is valid, -1 otherwise.
+ */
+int libstring_utf8verify_n(const char* string, size_t n, enum libstring_utf8verify flags)
+{
+  STATS_ENTER(utf8verify_n, n);
+  int r;
+  PROBE_ENTRY(utf8verify, n, flags);
+  r = utf8verify((const unsigned char*)string, n, flags);
+  PROBE_RETURN(utf8verify, n, r, flags);
+  return r;
+}
+
+
+/**
+ * Compare two `size_t`.
+ * 
+ * @param   a  Pointer to one of the `size_t`.
+ * @param   b  Pointer to the other `size_t`.
+ * @return     -1 if `*a` < `*b`, 0 if `*a` = `*b`, +1 if `*a` > `*b`.
+ */
+static int size_cmp(const void* a, const void* b)
+{
+  const size_t* i = a;
+  const size_t* j = b;
+  if (*i != *j)
+    return (*i < *j) ? -1 : +1;
+  return 0;
+}
+
+
+/**
+ * Check whether occurrences of a string can overlap.
+ * 
+ * @param   s            The string.
+ * @param   n            The length of `s`.
+ * @param   ignore_case  Whether to ignore the case of ASCII letters.
+ * @return               1 if a proper prefix of `s` is
+ *                       also a suffix of `s`, 0 otherwise.
+ */
+static int self_overlapping(const char* s, size_t n, int ignore_case)
+{
+  size_t k;
+  for (k = 1; k < n; k++)
+    if (ignore_case ? ascii_caseeq(s, s + n - k, k) : !memcmp(s, s + n - k, k))
+      return 1;
+  return 0;
+}
+
+
+/**
+ * Convert a field index given to `libstring_cut`
+ * to the order the fields are scanned in.
+ * 
+ * @param   index  The field index.
+ * @param   n      The number of fields if the fields are
+ *                 scanned from the opposite end from which
+ *                 they are indexed, `SIZE_MAX` otherwise.
+ * @return         The index in scan order, `SIZE_MAX`
+ *                 if there is no such field.
+ */
+static size_t cut_index(size_t index, size_t n)
+{
+  if (n == SIZE_MAX)
+    return index;
+  return index < n ? (n - 1 - index) : SIZE_MAX;
+}
+
+
+/**
+ * The fields selected by `libstring_cut`, and how to scan for them.
+ */
+struct cut_plan
+{
+  /**
+   * The selected fields' indices, in scan order,
+   * sorted and deduplicated.
+   */
+  size_t* want;
+  
+  /**
+   * The positions of the fields in `want`, unless the
+   * selection is complemented. Stored in the same
+   * allocation as `want`.
+   */
+  struct libstring_span* found;
+  
+  /**
+   * The number of elements in `want`, and in `found`
+   * unless the selection is complemented.
+   */
+  size_t wn;
+  
+  /**
+   * The number of fields if they are scanned from the
+   * opposite end from which they are indexed, `SIZE_MAX`
+   * otherwise. See `cut_index`.
+   */
+  size_t fn;
+  
+  /**
+   * Flags for `libstring_split_iter_init_p`.
+   */
+  enum libstring_split split_flags;
+  
+  /**
+   * Whether the fields are scanned from the right.
+   */
+  int scan_right;
+};
+
+
+/**
+ * Select the fields to cut, and unless the selection is
+ * complemented, find them. Release `plan->want` when done.
+ * 
+ * @param   plan       Output parameter for the selection.
+ * @param   string     The string to cut.
+ * @param   slen       The length of `string`.
+ * @param   delimiter  The delimiter.
+ * @param   fields     List of fields to select.
+ * @param   fields_n   The number of elements in `fields`.
+ * @param   flags      Flags for `libstring_cut`.
+ * @return             0 on success, -1 on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+static int cut_plan_init(struct cut_plan* plan, const char* string, size_t slen,
+			 const struct libstring_pattern* delimiter, const size_t* fields,
+			 size_t fields_n, enum libstring_cut flags)
+{
+  struct libstring_split_iter it;
+  const char* field;
+  size_t i, j, k, len;
+  
+  plan->fn = SIZE_MAX;
+  plan->scan_right = (flags & LIBSTRING_CUT_REVERSED) ? 1 : 0;
+  plan->split_flags = delimiter->ignore_case ? LIBSTRING_SPLIT_IGNORE_CASE : 0;
+  
+  /* Fields are scanned from the end they are indexed from, but if that is not
+   * the end matching starts from and delimiters can overlap, the fields would
+   * be different, so then count the fields and scan from the other end.
+   * Delimiters with case variants of non-ASCII characters are assumed to
+   * overlap, rather than comparing their variants with each other. */
+  if ((plan->scan_right != !!(flags & LIBSTRING_CUT_FROM_RIGHT)) &&
+      (delimiter->unicode || self_overlapping(delimiter->pattern, delimiter->length, delimiter->ignore_case)))
+    {
+      plan->scan_right ^= 1;
+      plan->fn = split(string, slen, delimiter,
+		       plan->split_flags | (plan->scan_right ? LIBSTRING_SPLIT_FROM_RIGHT : 0),
+		       NULL, 0, NULL, NULL);
+    }
+  plan->split_flags |= plan->scan_right ? LIBSTRING_SPLIT_FROM_RIGHT : 0;
+  
+  plan->want = allocate(fields_n * (sizeof(size_t) + sizeof(struct libstring_span)) + 1);
+  if (plan->want == NULL)
+    return -1;
+  plan->found = (struct libstring_span*)(plan->want + fields_n);
+  for (i = j = 0; i < fields_n; i++)
+    if ((k = cut_index(fields[i], plan->fn)) != SIZE_MAX)
+      plan->want[j++] = k;
+  qsort(plan->want, j, sizeof(size_t), size_cmp);
+  for (i = plan->wn = 0; i < j; i++)
+    if ((plan->wn == 0) || (plan->want[plan->wn - 1] != plan->want[i]))
+      plan->want[plan->wn++] = plan->want[i];
+  
+  if ((flags & LIBSTRING_CUT_COMPLEMENT))
+    return 0;
+  
+  /* Stop as soon as the last selected field has been found. */
+  libstring_split_iter_init_p(&it, string, delimiter, plan->split_flags);
+  for (k = j = 0; (j < plan->wn) && libstring_split_iter_next(&it, &field, &len); k++)
+    if (k == plan->want[j])
+      {
+	plan->found[j].offset = (size_t)(field - string);
+	plan->found[j].length = len;
+	j++;
+      }
+  plan->wn = j;
+  return 0;
+}
+
+
+/**
+ * Find the position of a selected field in a `struct cut_plan`.
+ * 
+ * @param   plan   The selection.
+ * @param   index  The field's index, as given to `libstring_cut`.
+ * @return         The field's position, `NULL` if the
+ *                 field was not selected or not found.
+ */
+static const struct libstring_span* cut_plan_find(const struct cut_plan* plan, size_t index)
+{
+  const size_t* w;
+  size_t k = cut_index(index, plan->fn);
+  if (k == SIZE_MAX)
+    return NULL;
+  w = bsearch(&k, plan->want, plan->wn, sizeof(size_t), size_cmp);
+  return w == NULL ? NULL : &plan->found[w - plan->want];
+}
+
+
+/**
+ * Check whether a field is excluded by a complemented
+ * selection, as the fields are scanned in order.
+ * 
+ * @param   plan   The selection.
+ * @param   j      The number of elements in `plan->want` that are
+ *                 known to be less than `k`, updated for `k`.
+ * @param   k      The field's index in scan order.
+ * @return         1 if the field is excluded, 0 otherwise.
+ */
+static int cut_plan_excludes(const struct cut_plan* plan, size_t* j, size_t k)
+{
+  while ((*j < plan->wn) && (plan->want[*j] < k))
+    ++*j;
+  return (*j < plan->wn) && (plan->want[*j] == k);
+}
+
+
+/**
+ * Split a string at each occurrence of a selected delimiter,
+ * but retain only select fields.
+ * 
+ * The list and all strings in it are stored in
+ * a single allocation, only the list shall be freed.
+ * 
+ * @param   string     The string to cut.
+ * @param   delimiter  The delimiter.
+ * @param   fields     List of fields to return.
+ * @param   fields_n   The number of elements in `fields`.
+ * @param   n          Output parameter for the number of
+ *                     returned fields. May be `NULL`.
+ * @param   flags      Additional options.
+ * @return             `NULL`-terminated list of the
+ *                     found fields. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char** libstring_cut(const char* string, const char* delimiter, const size_t* fields,
+		     size_t fields_n, size_t* n, enum libstring_cut flags)
+{
+  STATS_ENTER(cut, strlen(string));
+  struct libstring_pattern pat;
+  char** rc;
+  pattern_compile(&pat, delimiter, strlen(delimiter), (flags & LIBSTRING_CUT_IGNORE_CASE) ? 1 : 0);
+  rc = libstring_cut_p(string, &pat, fields, fields_n, n, flags);
+  STATS_OUTPUT(rc == NULL ? 0 : stats_bytes((const char* const*)rc, SIZE_MAX));
+  return rc;
+}
+
+
+/**
+ * Split a string at each occurrence of a prepared delimiter,
+ * but retain only select fields.
+ * 
+ * This is the same as `libstring_cut`, except the
+ * delimiter is prepared with `libstring_pattern_init`,
+ * which also selects whether case is ignored, so
+ * `LIBSTRING_CUT_IGNORE_CASE` is not used.
+ * 
+ * @param   string     The string to cut.
+ * @param   delimiter  The delimiter.
+ * @param   fields     List of fields to return.
+ * @param   fields_n   The number of elements in `fields`.
+ * @param   n          Output parameter for the number of
+ *                     returned fields. May be `NULL`.
+ * @param   flags      Additional options.
+ * @return             `NULL`-terminated list of the
+ *                     found fields. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char** libstring_cut_p(const char* string, const struct libstring_pattern* delimiter,
+		       const size_t* fields, size_t fields_n, size_t* n, enum libstring_cut flags)
+{
+  size_t slen = strlen(string);
+  STATS_ENTER(cut_p, slen);
+  struct cut_plan plan;
+  struct libstring_split_iter it;
+  const struct libstring_span* f;
+  size_t rn = 0, bytes = 0, i, j, k, len;
+  const char* field;
+  char** rc;
+  char* p;
+  int saved_errno;
+  
+  PROBE_ENTRY(cut, slen, flags);
+  if ((flags & LIBSTRING_CUT_COMPLEMENT))
+    flags |= LIBSTRING_CUT_ORDERED;
+  if (cut_plan_init(&plan, string, slen, delimiter, fields, fields_n, flags))
+    {
+      PROBE_RETURN(cut, slen, -1, flags);
+      return NULL;
+    }
+  
+  if ((flags & LIBSTRING_CUT_COMPLEMENT))
+    {
+      libstring_split_iter_init_p(&it, string, delimiter, plan.split_flags);
+      for (k = j = 0; libstring_split_iter_next(&it, &field, &len); k++)
+	if (!cut_plan_excludes(&plan, &j, k))
+	  rn++, bytes += len;
+    }
+  else if ((flags & LIBSTRING_CUT_ORDERED))
+    for (rn = plan.wn, j = 0; j < plan.wn; j++)
+      bytes += plan.found[j].length;
+  else
+    for (i = 0; i < fields_n; i++)
+      if ((f = cut_plan_find(&plan, fields[i])) != NULL)
+	rn++, bytes += f->length;
+  
+  rc = allocate((rn + 1) * sizeof(char*) + (bytes + rn) * sizeof(char));
+  if (rc == NULL)
+    goto fail;
+  p = (char*)(rc + rn + 1);
+  rc[rn] = NULL;
+  
+  /* Scanning from the right finds the fields in reverse order. */
+  if ((flags & LIBSTRING_CUT_COMPLEMENT))
+    {
+      if (plan.scan_right)
+	p += bytes + rn;
+      libstring_split_iter_init_p(&it, string, delimiter, plan.split_flags);
+      for (i = k = j = 0; libstring_split_iter_next(&it, &field, &len); k++)
+	{
+	  if (cut_plan_excludes(&plan, &j, k))
+	    continue;
+	  if (plan.scan_right)
+	    p -= len + 1;
+	  rc[plan.scan_right ? (rn - 1 - i++) : i++] = p;
+	  memcpy(p, field, len * sizeof(char));
+	  p[len] = '\0';
+	  if (!plan.scan_right)
+	    p += len + 1;
+	}
+    }
+  else if ((flags & LIBSTRING_CUT_ORDERED))
+    for (i = 0; i < plan.wn; i++)
+      {
+	f = &plan.found[plan.scan_right ? (plan.wn - 1 - i) : i];
+	rc[i] = p;
+	memcpy(p, string + f->offset, f->length * sizeof(char));
+	p += f->length;
+	*p++ = '\0';
+      }
+  else
+    for (i = j = 0; i < fields_n; i++)
+      if ((f = cut_plan_find(&plan, fields[i])) != NULL)
+	{
+	  rc[j++] = p;
+	  memcpy(p, string + f->offset, f->length * sizeof(char));
+	  p += f->length;
+	  *p++ = '\0';
+	}
+  
+  deallocate(plan.want);
+  if (n != NULL)
+    *n = rn;
+  STATS_OUTPUT(bytes);
+  PROBE_RETURN(cut, slen, rn, flags);
+  return rc;
+  
+ fail:
+  saved_errno = errno;
+  deallocate(plan.want);
+  errno = saved_errno;
+  PROBE_RETURN(cut, slen, -1, flags);
+  return NULL;
+}
+
+
+/**
+ * Split a string at each occurrence of a selected delimiter,
+ * but retain only select fields, without copying the fields,
+ * and store the positions of the fields in a caller-provided
+ * buffer.
+ * 
+ * This is the same as `libstring_cut`, except the fields
+ * are returned as positions in `string`, in the order
+ * `libstring_cut` would return them. Memory is still
+ * allocated for the selection, but not for the result.
+ * 
+ * @param   spans      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size       The number of elements `spans` can hold.
+ * @param   string     The string to cut.
+ * @param   delimiter  The delimiter.
+ * @param   fields     List of fields to return.
+ * @param   fields_n   The number of elements in `fields`.
+ * @param   flags      Additional options.
+ * @return             The number of fields. The result was
+ *                     truncated if this is greater than `size`.
+ *                     `SIZE_MAX` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+size_t libstring_cut_spans_into(struct libstring_span* spans, size_t size, const char* string,
+				const char* delimiter, const size_t* fields, size_t fields_n,
+				enum libstring_cut flags)
+{
+  STATS_ENTER(cut_spans_into, strlen(string));
+  struct libstring_pattern pat;
+  pattern_compile(&pat, delimiter, strlen(delimiter), (flags & LIBSTRING_CUT_IGNORE_CASE) ? 1 : 0);
+  return libstring_cut_spans_p_into(spans, size, string, &pat, fields, fields_n, flags);
+}
+
+
+/**
+ * Split a string at each occurrence of a prepared delimiter,
+ * but retain only select fields, without copying the fields,
+ * and store the positions of the fields in a caller-provided
+ * buffer.
+ * 
+ * This is the same as `libstring_cut_spans_into`, except
+ * the delimiter is prepared with `libstring_pattern_init`,
+ * which also selects whether case is ignored, so
+ * `LIBSTRING_CUT_IGNORE_CASE` is not used.
+ * 
+ * @param   spans      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size       The number of elements `spans` can hold.
+ * @param   string     The string to cut.
+ * @param   delimiter  The delimiter.
+ * @param   fields     List of fields to return.
+ * @param   fields_n   The number of elements in `fields`.
+ * @param   flags      Additional options.
+ * @return             The number of fields. The result was
+ *                     truncated if this is greater than `size`.
+ *                     `SIZE_MAX` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+size_t libstring_cut_spans_p_into(struct libstring_span* spans, size_t size, const char* string,
+				  const struct libstring_pattern* delimiter, const size_t* fields,
+				  size_t fields_n, enum libstring_cut flags)
+{
+  size_t slen = strlen(string);
+  STATS_ENTER(cut_spans_p_into, slen);
+  struct cut_plan plan;
+  struct libstring_split_iter it;
+  const struct libstring_span* f;
+  size_t rn = 0, at, i, j, k, len;
+  const char* field;
+  
+  if (cut_plan_init(&plan, string, slen, delimiter, fields, fields_n, flags))
+    return SIZE_MAX;
+  
+  /* Scanning from the right finds the fields in reverse order,
+   * so then they are counted before they are stored. */
+  if ((flags & LIBSTRING_CUT_COMPLEMENT))
+    {
+      if (plan.scan_right)
+	{
+	  libstring_split_iter_init_p(&it, string, delimiter, plan.split_flags);
+	  for (k = j = 0; libstring_split_iter_next(&it, &field, &len); k++)
+	    if (!cut_plan_excludes(&plan, &j, k))
+	      rn++;
+	}
+      libstring_split_iter_init_p(&it, string, delimiter, plan.split_flags);
+      for (i = k = j = 0; libstring_split_iter_next(&it, &field, &len); k++)
+	{
+	  if (cut_plan_excludes(&plan, &j, k))
+	    continue;
+	  at = plan.scan_right ? (rn - 1 - i) : i;
+	  if (at < size)
+	    {
+	      spans[at].offset = (size_t)(field - string);
+	      spans[at].length = len;
+	    }
+	  i++;
+	}
+      rn = i;
+    }
+  else if ((flags & LIBSTRING_CUT_ORDERED))
+    for (rn = plan.wn, i = 0; (i < plan.wn) && (i < size); i++)
+      spans[i] = plan.found[plan.scan_right ? (plan.wn - 1 - i) : i];
+  else
+    for (i = 0; i < fields_n; i++)
+      if ((f = cut_plan_find(&plan, fields[i])) != NULL)
+	{
+	  if (rn < size)
+	    spans[rn] = *f;
+	  rn++;
+	}
+  
+  deallocate(plan.want);
+  return rn;
+}
+
+
+/**
+ * Split a string at each occurrence of a selected delimiter,
+ * but retain only select fields.
+ * 
+ * @param   string     The string to cut.
+ * @param   delimiter  The delimiter.
+ * @param   fields...  List of fields to return.
+ *                     End with `SIZE_MAX`.
+ * @param   n          Output parameter for the number of
+ *                     returned fields. May be `NULL`.
+ * @param   flags      Additional options.
+ * @return             `NULL`-terminated list of the
+ *                     found fields. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char** libstring_vcut(const char* string, const char* delimiter, size_t fields,
+		      ... /*, SIZE_MAX, size_t* n, enum libstring_cut flags */)
+{
+  STATS_ENTER(vcut, strlen(string));
+  size_t n = 0, m = 8;
+  va_list args;
+  size_t* fs = NULL;
+  size_t f;
+  char** rc;
+  void* new;
+  size_t* p_n = NULL;
+  enum libstring_cut p_flags = 0;
+  int saved_errno = 0;
+  
+  fs = allocate(m * sizeof(size_t));
+  if (fs == NULL)
+    return NULL;
+  
+  va_start(args, fields);
+  if (fields != SIZE_MAX)
+    for (fs[n++] = fields; (f = va_arg(args, size_t)) != SIZE_MAX; fs[n++] = f)
+      if (n == m)
+	{
+	  new = reallocate(fs, m * sizeof(size_t), (m << 1) * sizeof(size_t));
+	  if (new == NULL)
+	    {
+	      saved_errno = errno;
+	      break;
+	    }
+	  fs = new;
+	  m <<= 1;
+	}
+  if (saved_errno == 0)
+    {
+      p_n = va_arg(args, size_t*);
+      p_flags = va_arg(args, enum libstring_cut);
+    }
+  va_end(args);
+  
+  if (saved_errno != 0)
+    goto fail;
+  rc = libstring_cut(string, delimiter, fs, n, p_n, p_flags);
+  if (rc == NULL)
+    {
+      saved_errno = errno;
+      goto fail;
+    }
+  deallocate(fs);
+  STATS_OUTPUT(stats_bytes((const char* const*)rc, SIZE_MAX));
+  return rc;
+  
+ fail:
+  deallocate(fs);
+  errno = saved_errno;
+  return NULL;
+}
+
+
+/**
+ * Retrieve a substring.
+ * 
+ * @param   string  The string.
+ * @param   start   The position in `string` of the
+ *                  beginning of the substring.
+ * @param   end     The position in `string` of the
+ *                  end of the substring.
+ * @param   flags   Additional options.
+ * @return          The selected substring of `string`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_substring(const char* string, size_t start, size_t end, enum libstring_substring flags)
+{
+  STATS_ENTER(substring, strlen(string));
+  size_t n = libstring_substring_into(NULL, 0, string, start, end, flags);
+  char* rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    libstring_substring_into(rc, n + 1, string, start, end, flags);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  return rc;
+}
+
+
+/**
+ * Retrieve a substring of a string of a given length,
+ * and store it in a caller-provided buffer.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string.
+ * @param   n       The length of `string`.
+ * @param   start   The position in `string` of the
+ *                  beginning of the substring.
+ * @param   end     The position in `string` of the
+ *                  end of the substring.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+static size_t substring_into(char* buf, size_t size, const char* string, size_t n,
+			     size_t start, size_t end, enum libstring_substring flags)
+{
+  size_t len, t;
+  
+  if ((flags & LIBSTRING_SUBSTRING_BYTES))
+    len = n;
+  else
+    for (len = t = 0; t < n; t++)
+      len += ((string[t] & 0xC0) != 0x80);
+  
+  if ((flags & LIBSTRING_SUBSTRING_LENGTH))
+    end = (end > SIZE_MAX - start) ? SIZE_MAX : (start + end);
+  start = start < len ? start : len;
+  end = end < len ? end : len;
+  start = start < end ? start : end;
+  
+  if ((flags & LIBSTRING_SUBSTRING_FROM_END))
+    t = start, start = len - end, end = len - t;
+  
+  if (!(flags & LIBSTRING_SUBSTRING_BYTES))
+    {
+      t = end - start;
+      start = utf8_offset(string, n, start);
+      end = start + utf8_offset(string + start, n - start, t);
+    }
+  
+  return terminate(buf, size, put(buf, size, 0, string + start, end - start));
+}
+
+
+/**
+ * Retrieve a substring, and store it in
+ * a caller-provided buffer.
+ * 
+ * This is the same as `libstring_substring`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string.
+ * @param   start   The position in `string` of the
+ *                  beginning of the substring.
+ * @param   end     The position in `string` of the
+ *                  end of the substring.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+size_t libstring_substring_into(char* buf, size_t size, const char* string, size_t start,
+				size_t end, enum libstring_substring flags)
+{
+  STATS_ENTER(substring_into, strlen(string));
+  return STATS_INTO(substring_into(buf, size, string, strlen(string), start, end, flags), size);
+}
+
+
+/**
+ * Retrieve a substring of a string of a given length,
+ * and store it in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_substring`, except
+ * `string` has a given length, so it may contain NUL
+ * bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string.
+ * @param   n       The length of `string`.
+ * @param   start   The position in `string` of the
+ *                  beginning of the substring.
+ * @param   end     The position in `string` of the
+ *                  end of the substring.
+ * @param   flags   Additional options.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_substring_str(struct libstring_str* out, const char* string, size_t n,
+			    size_t start, size_t end, enum libstring_substring flags)
+{
+  STATS_ENTER(substring_str, n);
+  int r;
+  while ((r = str_result(out, substring_into(out->ptr, out->cap, string, n, start, end, flags))) > 0);
+  STATS_OUTPUT(out->len);
+  return r;
+}
+
+
+/**
+ * Remove unnecessary whitespace in string.
+ * 
+ * Example:
+ *   s = libstring_trim("  hello   world!  ", NULL, 0);
+ *   # s is "hello   world!"
+ *   free(s);
+ * 
+ * @param   string   The string to manipulate.
+ * @param   symbols  Symbols to remove.
+ * @param   flags    Additional options.
+ * @return           Trimmed version of `string`.
+ *                   `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_trim(const char* string, const char* symbols, enum libstring_trim flags)
+{
+  STATS_ENTER(trim, strlen(string));
+  size_t n = libstring_trim_into(NULL, 0, string, symbols, flags);
+  char* rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    libstring_trim_into(rc, n + 1, string, symbols, flags);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  return rc;
+}
+
+
+/**
+ * Check whether a character is one of a set of symbols.
+ * 
+ * @param   c        The character.
+ * @param   n        The length of `c`, in bytes.
+ * @param   symbols  The symbols.
+ * @return           1 if `c` is in `symbols`, 0 otherwise.
+ */
+static int is_symbol(const char* c, size_t n, const char* symbols)
+{
+  size_t m;
+  /* The terminating NUL byte also ends the last symbol. */
+  for (; *symbols; symbols += m)
+    {
+      m = utf8_charlen(symbols, SIZE_MAX);
+      if ((m == n) && !memcmp(c, symbols, n))
+	return 1;
+    }
+  return 0;
+}
+
+
+/**
+ * Remove unnecessary whitespace in a string of a given
+ * length, and store the result in a caller-provided buffer.
+ * 
+ * @param   buf      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size     The allocation size of `buf`.
+ * @param   string   The string to manipulate.
+ * @param   n        The length of `string`.
+ * @param   symbols  Symbols to remove.
+ * @param   flags    Additional options.
+ * @return           The length of the result, excluding the
+ *                   terminating NUL byte. The result was
+ *                   truncated if this is not less than `size`.
+ */
+static size_t trim_into(char* buf, size_t size, const char* string, size_t n,
+			const char* symbols, enum libstring_trim flags)
+{
+  size_t start = 0, end = n, i, m, p, len = 0;
+  const char* prev = NULL;
+  
+  if (symbols == NULL)
+    symbols = " \t\n\v\f\r";
+  if (!(flags & (LIBSTRING_TRIM_LEFT | LIBSTRING_TRIM_RIGHT | LIBSTRING_TRIM_DUPLICATES)))
+    flags |= LIBSTRING_TRIM_LEFT | LIBSTRING_TRIM_RIGHT;
+  
+  if ((flags & LIBSTRING_TRIM_LEFT))
+    while ((start < end) && is_symbol(string + start, m = utf8_charlen(string + start, end - start), symbols))
+      start += m;
+  
+  if ((flags & LIBSTRING_TRIM_RIGHT))
+    while (end > start)
+      {
+	for (p = end - 1; (p > start) && ((string[p] & 0xC0) == 0x80); p--);
+	if (!is_symbol(string + p, end - p, symbols))
+	  break;
+	end = p;
+      }
+  
+  if (!(flags & LIBSTRING_TRIM_DUPLICATES))
+    return terminate(buf, size, put(buf, size, 0, string + start, end - start));
+  
+  for (i = start, p = 0; i < end; i += m)
+    {
+      m = utf8_charlen(string + i, end - i);
+      if ((m == p) && !memcmp(prev, string + i, m) && is_symbol(string + i, m, symbols))
+	continue;
+      len = put(buf, size, len, string + i, m);
+      prev = string + i, p = m;
+    }
+  
+  return terminate(buf, size, len);
+}
+
+
+/**
+ * Remove unnecessary whitespace in string, and store
+ * the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_trim`, except the
+ * result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size     The allocation size of `buf`.
+ * @param   string   The string to manipulate.
+ * @param   symbols  Symbols to remove.
+ * @param   flags    Additional options.
+ * @return           The length of the result, excluding the
+ *                   terminating NUL byte. The result was
+ *                   truncated if this is not less than `size`.
+ */
+size_t libstring_trim_into(char* buf, size_t size, const char* string,
+			   const char* symbols, enum libstring_trim flags)
+{
+  STATS_ENTER(trim_into, strlen(string));
+  return STATS_INTO(trim_into(buf, size, string, strlen(string), symbols, flags), size);
+}
+
+
+/**
+ * Remove unnecessary whitespace in a string of a given
+ * length, and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_trim`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out      Output string, its allocation is reused
+ *                   if the result fits in it. Must not
+ *                   overlap `string`.
+ * @param   string   The string to manipulate.
+ * @param   n        The length of `string`.
+ * @param   symbols  Symbols to remove.
+ * @param   flags    Additional options.
+ * @return           0 on success, -1 on error, in which
+ *                   case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_trim_str(struct libstring_str* out, const char* string, size_t n,
+		       const char* symbols, enum libstring_trim flags)
+{
+  STATS_ENTER(trim_str, n);
+  int r;
+  while ((r = str_result(out, trim_into(out->ptr, out->cap, string, n, symbols, flags))) > 0);
+  STATS_OUTPUT(out->len);
+  return r;
+}
+
+
+/**
+ * The options for `batch_trim`.
+ */
+struct batch_trim_ctx
+{
+  /**
+   * Symbols to remove.
+   */
+  const char* symbols;
+  
+  /**
+   * Additional options.
+   */
+  enum libstring_trim flags;
+};
+
+
+/**
+ * `trim_into` as a `batch_transform_t`.
+ */
+static size_t batch_trim(char* buf, size_t size, const char* string, size_t n, const void* ctx)
+{
+  const struct batch_trim_ctx* t = ctx;
+  return trim_into(buf, size, string, n, t->symbols, t->flags);
+}
+
+
+/**
+ * Remove unnecessary whitespace in each string in an array.
+ * 
+ * This is the same as `libstring_trim`, applied to each string
+ * in an array, except the results are packed into one
+ * allocation, with their offsets in another.
+ * 
+ * @param   out      Output parameter for the results.
+ * @param   strings  The strings to manipulate.
+ * @param   n        The number of strings in `strings`.
+ * @param   symbols  Symbols to remove.
+ * @param   flags    Additional options.
+ * @return           0 on success, -1 on error, in
+ *                   which case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_trim_batch(struct libstring_batch* out, const char* const* strings, size_t n,
+			 const char* symbols, enum libstring_trim flags)
+{
+  STATS_ENTER(trim_batch, stats_bytes(strings, n));
+  struct batch_trim_ctx ctx;
+  int r;
+  ctx.symbols = symbols;
+  ctx.flags = flags;
+  r = batch(out, strings, n, batch_trim, &ctx);
+  STATS_OUTPUT(r == 0 ? out->offsets[n] - n : 0);
+  return r;
+}
+
+
+/**
+ * The state needed to find extended grapheme cluster
+ * boundaries, as specified in UAX #29, one character
+ * at a time.
+ */
+struct grapheme_state
+{
+  /**
+   * The `UNICODE_GRAPHEME_*` value of the previous character.
+   */
+  unsigned char prev;
+  
+  /**
+   * 1 if the previous characters are an extended pictographic
+   * character followed by zero or more extending characters,
+   * 2 if they are that followed by a zero width joiner,
+   * 0 otherwise.
+   */
+  unsigned char pictographic;
+  
+  /**
+   * 1 if the previous characters are an Indic conjunct
+   * consonant followed by zero or more extending characters
+   * or linkers, 2 if there is a linker among them, 0 otherwise.
+   */
+  unsigned char conjunct;
+  
+  /**
+   * Whether the previous characters are an odd
+   * number of regional indicator symbols.
+   */
+  unsigned char odd_regional;
+};
+
+
+/**
+ * Check whether there is an extended grapheme cluster
+ * boundary before a character, and update the state
+ * to include that character.
+ * 
+ * @param   state  The state. At the start of the text, `prev` shall
+ *                 be `UNICODE_GRAPHEME_CONTROL` and the rest 0.
+ * @param   props  The grapheme cluster properties of the character,
+ *                 `UNICODE_GRAPHEME_CONTROL` for a byte that is not
+ *                 part of a valid character, so that it is a
+ *                 cluster of its own.
+ * @return         Whether there is a boundary before the character.
+ */
+static int grapheme_break(struct grapheme_state* state, unsigned char props)
+{
+  unsigned char prev = state->prev, cur = props & UNICODE_GRAPHEME_BREAK;
+  unsigned char incb = props & UNICODE_INCB;
+  int boundary = 1;
+  
+  if ((prev == UNICODE_GRAPHEME_CR) && (cur == UNICODE_GRAPHEME_LF))
+    boundary = 0;
+  else if ((prev == UNICODE_GRAPHEME_CR) || (prev == UNICODE_GRAPHEME_LF) || (prev == UNICODE_GRAPHEME_CONTROL))
+    boundary = 1;
+  else if ((cur == UNICODE_GRAPHEME_CR) || (cur == UNICODE_GRAPHEME_LF) || (cur == UNICODE_GRAPHEME_CONTROL))
+    boundary = 1;
+  else if ((cur == UNICODE_GRAPHEME_EXTEND) || (cur == UNICODE_GRAPHEME_ZWJ) ||
+	   (cur == UNICODE_GRAPHEME_SPACING_MARK) || (prev == UNICODE_GRAPHEME_PREPEND))
+    boundary = 0;
+  else if ((incb == UNICODE_INCB_CONSONANT) && (state->conjunct == 2))
+    boundary = 0;
+  else if ((prev == UNICODE_GRAPHEME_ZWJ) && (props & UNICODE_EXTENDED_PICTOGRAPHIC) && (state->pictographic == 2))
+    boundary = 0;
+  else if ((prev == UNICODE_GRAPHEME_REGIONAL_INDICATOR) && (cur == UNICODE_GRAPHEME_REGIONAL_INDICATOR))
+    boundary = !state->odd_regional;
+  else
+    switch (prev)
+      {
+      case UNICODE_GRAPHEME_L:
+	boundary = (cur != UNICODE_GRAPHEME_L) && (cur != UNICODE_GRAPHEME_V) &&
+		   (cur != UNICODE_GRAPHEME_LV) && (cur != UNICODE_GRAPHEME_LVT);
+	break;
+      case UNICODE_GRAPHEME_LV:
+      case UNICODE_GRAPHEME_V:
+	boundary = (cur != UNICODE_GRAPHEME_V) && (cur != UNICODE_GRAPHEME_T);
+	break;
+      case UNICODE_GRAPHEME_LVT:
+      case UNICODE_GRAPHEME_T:
+	boundary = (cur != UNICODE_GRAPHEME_T);
+	break;
+      default:
+	break;
+      }
+  
+  if ((props & UNICODE_EXTENDED_PICTOGRAPHIC))
+    state->pictographic = 1;
+  else if ((state->pictographic == 1) && (cur == UNICODE_GRAPHEME_EXTEND))
+    state->pictographic = 1;
+  else if ((state->pictographic == 1) && (cur == UNICODE_GRAPHEME_ZWJ))
+    state->pictographic = 2;
+  else
+    state->pictographic = 0;
+  
+  if (incb == UNICODE_INCB_CONSONANT)
+    state->conjunct = 1;
+  else if (state->conjunct && (incb == UNICODE_INCB_LINKER))
+    state->conjunct = 2;
+  else if (incb != UNICODE_INCB_EXTEND)
+    state->conjunct = 0;
+  
+  state->odd_regional = (cur == UNICODE_GRAPHEME_REGIONAL_INDICATOR) && !state->odd_regional;
+  state->prev = cur;
+  return boundary;
+}
+
+
+/**
+ * Get the length of the character at a position in a string,
+ * and check whether it starts a new unit, as `libstring_reverse`
+ * and `libstring_anagram` move characters, or extended grapheme
+ * clusters, as units.
+ * 
+ * @param   state     The grapheme cluster state, only used if `clusters` is set.
+ * @param   clusters  Whether the units are extended grapheme clusters
+ *                    rather than characters.
+ * @param   s         The character.
+ * @param   avail     The number of bytes left in the string.
+ * @param   n         Output parameter for the number of
+ *                    bytes in the character.
+ * @return            Whether the character starts a new unit.
+ */
+static int unit_start(struct grapheme_state* state, int clusters, const char* s, size_t avail, size_t* n)
+{
+  uint32_t cp;
+  
+  if (!clusters)
+    return *n = utf8_charlen(s, avail), 1;
+  
+  /* A byte that is not part of a valid character is a cluster of its own. */
+  cp = utf8_decode(s, avail, n);
+  if (((unsigned char)*s >= 0x80) && ((*n == 1) || (*n != utf8_width((unsigned char)*s))))
+    return grapheme_break(state, UNICODE_GRAPHEME_CONTROL);
+  return grapheme_break(state, unicode_grapheme_of(cp));
+}
+
+
+/**
+ * Copy bytes in reverse order, one word at a time.
+ * 
+ * @param   dest  The output, must not overlap `src`.
+ * @param   src   The bytes to copy.
+ * @param   n     The number of bytes to copy.
+ */
+static void reverse_bytes_word(char* dest, const char* src, size_t n)
+{
+  size_t i;
+  uint64_t word;
+  for (i = 0; n - i >= 8; i += 8)
+    {
+      memcpy(&word, src + i, 8);
+      word = __builtin_bswap64(word);
+      memcpy(dest + n - 8 - i, &word, 8);
+    }
+  for (; i < n; i++)
+    dest[n - 1 - i] = src[i];
+}
+
+
+#if defined(HAVE_X86_SIMD)
+
+/**
+ * Copy bytes in reverse order, 16 bytes at a time.
+ * 
+ * @param   dest  The output, must not overlap `src`.
+ * @param   src   The bytes to copy.
+ * @param   n     The number of bytes to copy.
+ */
+__attribute__((__target__("ssse3")))
+static void reverse_bytes_ssse3(char* dest, const char* src, size_t n)
+{
+  const __m128i order = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  size_t i;
+  __m128i v;
+  
+  for (i = 0; n - i >= 16; i += 16)
+    {
+      v = _mm_loadu_si128((const __m128i*)(src + i));
+      _mm_storeu_si128((__m128i*)(dest + n - 16 - i), _mm_shuffle_epi8(v, order));
+    }
+  reverse_bytes_word(dest, src + i, n - i);
+}
+
+
+/**
+ * Copy bytes in reverse order, 32 bytes at a time.
+ * 
+ * @param   dest  The output, must not overlap `src`.
+ * @param   src   The bytes to copy.
+ * @param   n     The number of bytes to copy.
+ */
+__attribute__((__target__("avx2")))
+static void reverse_bytes_avx2(char* dest, const char* src, size_t n)
+{
+  const __m256i order = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+					 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+  size_t i;
+  __m256i v;
+  
+  for (i = 0; n - i >= 32; i += 32)
+    {
+      /* The shuffle only reverses each 16-byte lane, so the lanes are swapped afterwards. */
+      v = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i)), order);
+      _mm256_storeu_si256((__m256i*)(dest + n - 32 - i), _mm256_permute4x64_epi64(v, 0x4E));
+    }
+  reverse_bytes_word(dest, src + i, n - i);
+}
+
+#endif
+
+
+/**
+ * Copy bytes in reverse order, as many bytes
+ * at a time as the processor supports.
+ * 
+ * @param   dest  The output, must not overlap `src`.
+ * @param   src   The bytes to copy.
+ * @param   n     The number of bytes to copy.
+ */
+static void reverse_bytes(char* dest, const char* src, size_t n)
+{
+#if defined(HAVE_X86_SIMD)
+  if (__builtin_cpu_supports("avx2"))
+    reverse_bytes_avx2(dest, src, n);
+  else if (__builtin_cpu_supports("ssse3"))
+    reverse_bytes_ssse3(dest, src, n);
+  else
+#endif
+    reverse_bytes_word(dest, src, n);
+}
+
+
+/**
+ * The number of ASCII bytes in a row needed before they
+ * are reversed as a block instead of one at a time.
+ */
+#define REVERSE_MIN_BLOCK  16
+
+
+/**
+ * Write a character, or cluster, to its position
+ * in the output of `reverse_into`, truncated so
+ * that nothing is written at or after `lim`.
+ * 
+ * @param  buf  The output buffer.
+ * @param  lim  The number of bytes that may be written to `buf`.
+ * @param  at   The position of the cluster in the output.
+ * @param  s    The cluster.
+ * @param  n    The length of the cluster.
+ */
+static void reverse_put(char* buf, size_t lim, size_t at, const char* s, size_t n)
+{
+  if (at < lim)
+    memcpy(buf + at, s, (n < lim - at ? n : lim - at) * sizeof(char));
+}
+
+
+/**
+ * Reverse the order of the characters in a string of
+ * a given length, and store the result in a caller-provided
+ * buffer. The result has the same length as the string, so
+ * each character, or cluster, is written directly to its
+ * final position as soon as its end is found.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to reverse.
+ * @param   n       The length of `string`.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+static size_t reverse_into(char* buf, size_t size, const char* string, size_t n,
+			   enum libstring_reverse flags)
+{
+  const unsigned char* s = (const unsigned char*)string;
+  const unsigned char* cr;
+  int clusters = (flags & LIBSTRING_REVERSE_KEEP_COMBINING) ? 1 : 0;
+  struct grapheme_state state = {UNICODE_GRAPHEME_CONTROL, 0, 0, 0};
+  size_t lim = (size == 0 ? 0 : n < size ? n : size - 1);
+  size_t i = 0, start = 0, k, end, m;
+  
+  if (lim == 0)
+    return terminate(buf, size, n);
+  
+  while (i < n)
+    {
+      if (unit_start(&state, clusters, string + i, n - i, &k))
+	{
+	  reverse_put(buf, lim, n - i, string + start, i - start);
+	  start = i;
+	}
+      i += k;
+      
+      /* In a run of ASCII bytes, each byte is a cluster of its own, except
+       * CR LF, and except that the last byte of the run can be extended
+       * by the character after it, so it is left for the next iteration. */
+      if ((start + 1 != i) || (s[start] >= 0x80) || (i == n) || (s[i] >= 0x80))
+	continue;
+      end = start + ascii_prefix(s + start, n - start);
+      if (clusters)
+	end -= ((end - start >= 2) && (s[end - 2] == '\r') && (s[end - 1] == '\n')) ? 2 : 1;
+      if (end - start < REVERSE_MIN_BLOCK)
+	continue;
+      if (n - end < lim)
+	{
+	  m = end - start < lim - (n - end) ? end - start : lim - (n - end);
+	  reverse_bytes(buf + n - end, string + end - m, m);
+	}
+      if (clusters)
+	for (cr = s + start; (cr = memchr(cr, '\r', (size_t)(s + end - cr))) && (cr + 1 < s + end); cr++)
+	  if (cr[1] == '\n')
+	    {
+	      k = (size_t)(cr - s);
+	      if (n - 2 - k < lim)  buf[n - 2 - k] = '\r';
+	      if (n - 1 - k < lim)  buf[n - 1 - k] = '\n';
+	    }
+      state.prev = unicode_grapheme_of(s[end - 1]) & UNICODE_GRAPHEME_BREAK;
+      state.pictographic = state.conjunct = state.odd_regional = 0;
+      start = i = end;
+    }
+  reverse_put(buf, lim, 0, string + start, n - start);
+  
+  return terminate(buf, size, n);
+}
+
+
+/**
+ * Reverse the order of the characters in a string.
+ * 
+ * The bytes of each UTF-8 character are kept in order.
+ * 
+ * Example:
+ *   s = libstring_reverse("hello world!", 0);
+ *   # s is "!dlrow olleh"
+ *   free(s);
+ * 
+ * @param   string  The string to reverse.
+ * @param   flags   Additional options.
+ * @return          String reversed. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_reverse(const char* string, enum libstring_reverse flags)
+{
+  size_t n = strlen(string);
+  STATS_ENTER(reverse, n);
+  char* rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    reverse_into(rc, n + 1, string, n, flags);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  return rc;
+}
+
+
+/**
+ * Reverse the order of the characters in a string,
+ * and store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_reverse`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to reverse.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+size_t libstring_reverse_into(char* buf, size_t size, const char* string,
+			      enum libstring_reverse flags)
+{
+  size_t n = strlen(string);
+  STATS_ENTER(reverse_into, n);
+  return STATS_INTO(reverse_into(buf, size, string, n, flags), size);
+}
+
+
+/**
+ * Reverse the order of the characters in a string of a
+ * given length, and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_reverse`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to reverse.
+ * @param   n       The length of `string`.
+ * @param   flags   Additional options.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_reverse_str(struct libstring_str* out, const char* string, size_t n,
+			  enum libstring_reverse flags)
+{
+  STATS_ENTER(reverse_str, n);
+  int r;
+  while ((r = str_result(out, reverse_into(out->ptr, out->cap, string, n, flags))) > 0);
+  STATS_OUTPUT(out->len);
+  return r;
+}
+
+
+/**
+ * The increment of the state of the pseudorandom number
+ * generator used by `libstring_anagram`, for each number.
+ */
+#define RANDOM_INCREMENT  UINT64_C(0x9E3779B97F4A7C15)
+
+
+/**
+ * The state of the pseudorandom number generator used
+ * by `libstring_anagram` when the caller does not keep one.
+ */
+static THREAD_LOCAL unsigned long long int random_state = 0;
+
+/**
+ * Whether `random_state` has been seeded.
+ */
+static THREAD_LOCAL int random_seeded = 0;
+
+
+/**
+ * Get the next number from a pseudorandom number generator.
+ * 
+ * This is SplitMix64: the state is a counter, and the
+ * number is a mix of its bits, so the state advances
+ * by the same amount for each number.
+ * 
+ * @param   state  The state, will be updated.
+ * @return         A pseudorandom number.
+ */
+static uint64_t random_next(uint64_t* state)
+{
+  uint64_t z = (*state += RANDOM_INCREMENT);
+  z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+  z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+  return z ^ (z >> 31);
+}
+
+
+/**
+ * Get a pseudorandom number below a bound.
+ * 
+ * The number is the high half of the product of a
+ * pseudorandom number and the bound, which avoids a
+ * division; the bias is at most `bound` in 2^64.
+ * 
+ * @param   state  The state of the generator, will be updated.
+ * @param   bound  The number of possible values, must not be 0.
+ * @return         A pseudorandom number in [0, `bound`).
+ */
+static size_t random_below(uint64_t* state, size_t bound)
+{
+  uint64_t r = random_next(state);
+#if defined(__SIZEOF_INT128__)
+  return (size_t)(__extension__ ((unsigned __int128)r * bound) >> 64);
+#else
+  uint64_t b = (uint64_t)bound, r_lo = r & 0xFFFFFFFFUL, b_lo = b & 0xFFFFFFFFUL;
+  uint64_t lo_lo = r_lo * b_lo, hi_lo = (r >> 32) * b_lo, lo_hi = r_lo * (b >> 32);
+  uint64_t mid = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFUL) + (lo_hi & 0xFFFFFFFFUL);
+  return (size_t)((r >> 32) * (b >> 32) + (hi_lo >> 32) + (lo_hi >> 32) + (mid >> 32));
+#endif
+}
+
+
+/**
+ * Shuffle the order of the characters in a string of
+ * a given length, and store the result in a caller-provided
+ * buffer. The units are shuffled with Fisher–Yates from the
+ * front, and the shuffle stops once the buffer is full. If
+ * every unit is one byte and the result does not fit, the
+ * bytes that fit are instead selected with reservoir
+ * sampling and then shuffled, so nothing is allocated.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  Anagram of the returned string.
+ * @param   n       The length of `string`.
+ * @param   state   The state of the pseudorandom number
+ *                  generator, see `libstring_anagram`.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ *                  `SIZE_MAX` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+static size_t anagram_into(char* buf, size_t size, const char* string, size_t n,
+			   unsigned long long int* state, enum libstring_anagram flags)
+{
+  const unsigned char* s = (const unsigned char*)string;
+  const unsigned char* cr;
+  int clusters = (flags & LIBSTRING_ANAGRAM_KEEP_COMBINING) ? 1 : 0;
+  const struct grapheme_state start = {UNICODE_GRAPHEME_CONTROL, 0, 0, 0};
+  struct grapheme_state gstate = start;
+  struct libstring_span* units;
+  struct libstring_span unit;
+  size_t lim = (size == 0 ? 0 : n < size ? n : size - 1);
+  size_t i, j, k, m = 0, pos;
+  uint64_t seed, x;
+  int bytes;
+  char c;
+  
+  if (size == 0)
+    return n;
+  
+  if (state == NULL)
+    {
+      if (!random_seeded)
+	{
+	  random_state = (unsigned long long int)time(NULL) ^ (unsigned long long int)(uintptr_t)&random_state;
+	  random_seeded = 1;
+	}
+      state = &random_state;
+    }
+  x = seed = (uint64_t)*state;
+  
+  /* If every unit is one byte, the bytes are shuffled in place. If they do
+   * not all fit, each byte replaces a random one of those kept so far with
+   * probability `lim` over the number of bytes seen, which keeps a uniform
+   * random selection of `lim` bytes, which are then shuffled. */
+  bytes = (ascii_prefix(s, n) == n);
+  for (cr = s; bytes && clusters && (cr = memchr(cr, '\r', (size_t)(s + n - cr))) && (cr + 1 < s + n); cr++)
+    bytes = (cr[1] != '\n');
+  if (bytes)
+    {
+      memcpy(buf, string, lim * sizeof(char));
+      for (i = lim; i < n; i++)
+	if ((j = random_below(&x, i + 1)) < lim)
+	  buf[j] = string[i];
+      for (i = 0; i + 1 < lim; i++)
+	{
+	  j = i + random_below(&x, lim - i);
+	  c = buf[i], buf[i] = buf[j], buf[j] = c;
+	}
+      goto done;
+    }
+  
+  /* Count the units before allocating their positions. */
+  for (i = 0; i < n; i += k)
+    m += (size_t)unit_start(&gstate, clusters, string + i, n - i, &k);
+  units = allocate(m * sizeof(struct libstring_span));
+  if (units == NULL)
+    return SIZE_MAX;
+  gstate = start;
+  for (i = m = 0; i < n; i += k)
+    {
+      if (unit_start(&gstate, clusters, string + i, n - i, &k))
+	units[m++].offset = i;
+      units[m - 1].length = i + k - units[m - 1].offset;
+    }
+  
+  for (i = pos = 0; pos < lim; i++)
+    {
+      if (i + 1 < m)
+	{
+	  j = i + random_below(&x, m - i);
+	  unit = units[i], units[i] = units[j], units[j] = unit;
+	}
+      k = units[i].length < lim - pos ? units[i].length : lim - pos;
+      memcpy(buf + pos, string + units[i].offset, k * sizeof(char));
+      pos += k;
+    }
+  
+  deallocate(units);
+  
+ done:
+  /* The state is advanced past every number this call could have used,
+   * whether or not the result was truncated, so the next call does not
+   * depend on `size`. */
+  *state = (unsigned long long int)(seed + (uint64_t)n * RANDOM_INCREMENT);
+  return terminate(buf, size, n);
+}
+
+
+/**
+ * Shuffle the order of the characters in a string.
+ * 
+ * The characters are shuffled with a pseudorandom number
+ * generator whose state is kept by the caller, so the same
+ * seed always gives the same anagram, and threads do not
+ * share a generator.
+ * 
+ * Example:
+ *   unsigned long long int seed = 1;
+ *   s = libstring_anagram("hello world!", &seed, 0);
+ *   # s is "wl!hodleol r", whenever seed was 1.
+ *   free(s);
+ *   s = libstring_anagram("hello world!", &seed, 0);
+ *   # s is " weoldh!rllo", whenever seed was 1 before the first call.
+ *   free(s);
+ *   s = libstring_anagram("hello world!", NULL, 0);
+ *   # s is "hell row old!", or something else.
+ *   free(s);
+ * 
+ * @param   string  Anagram of the returned string.
+ * @param   state   The state of the pseudorandom number generator,
+ *                  any value can be used as a seed. It is updated
+ *                  so that the next call gives another anagram.
+ *                  `NULL` to use a generator private to the thread,
+ *                  which is seeded when it is first used.
+ * @param   flags   Additional options.
+ * @return          An anagram of `string`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_anagram(const char* string, unsigned long long int* state, enum libstring_anagram flags)
+{
+  size_t n = strlen(string);
+  STATS_ENTER(anagram, n);
+  char* rc = allocate((n + 1) * sizeof(char));
+  if ((rc != NULL) && (anagram_into(rc, n + 1, string, n, state, flags) == SIZE_MAX))
+    {
+      deallocate(rc);
+      rc = NULL;
+    }
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  return rc;
+}
+
+
+/**
+ * Shuffle the order of the characters in a string,
+ * and store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_anagram`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit. A
+ * truncated result is the beginning of an anagram of
+ * `string`, but if each character, or cluster, is one
+ * byte long, not necessarily of the anagram that a large
+ * enough buffer would have got. `state` is not updated
+ * if `size` is 0.
+ * 
+ * If each character, or cluster, is one byte long, the
+ * string is shuffled in place in `buf`, otherwise memory
+ * is allocated for the positions of the characters.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  Anagram of the returned string.
+ * @param   state   The state of the pseudorandom number
+ *                  generator, see `libstring_anagram`.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ *                  `SIZE_MAX` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+size_t libstring_anagram_into(char* buf, size_t size, const char* string,
+			      unsigned long long int* state, enum libstring_anagram flags)
+{
+  size_t n = strlen(string);
+  STATS_ENTER(anagram_into, n);
+  return STATS_INTO(anagram_into(buf, size, string, n, state, flags), size);
+}
+
+
+/**
+ * Shuffle the order of the characters in a string of a
+ * given length, and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_anagram`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  Anagram of the returned string.
+ * @param   n       The length of `string`.
+ * @param   state   The state of the pseudorandom number
+ *                  generator, see `libstring_anagram`.
+ * @param   flags   Additional options.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_anagram_str(struct libstring_str* out, const char* string, size_t n,
+			  unsigned long long int* state, enum libstring_anagram flags)
+{
+  STATS_ENTER(anagram_str, n);
+  int r;
+  /* The length is known, so the string is shuffled only once,
+   * and the same seed gives the same anagram as the other forms. */
+  while ((r = str_result(out, n)) > 0);
+  if ((r == 0) && (anagram_into(out->ptr, out->cap, string, n, state, flags) == SIZE_MAX))
+    {
+      deallocate(out->ptr);
+      out->ptr = NULL;
+      out->len = out->cap = 0;
+      r = -1;
+    }
+  STATS_OUTPUT(out->len);
+  return r;
+}
+
+
+/**
+ * Change the case of letters to the opposite case, for
+ * `change_case`, in addition to the `UNICODE_CASE_LOWER`,
+ * `UNICODE_CASE_UPPER` and `UNICODE_CASE_TITLE` mappings.
+ */
+#define CASE_SWAP  (-1)
+
+
+/**
+ * Get the bytes, in a word, that are ASCII
+ * characters within a range.
+ * 
+ * @param   w      The word.
+ * @param   first  The first byte value in the range.
+ * @param   last   The last byte value in the range,
+ *                 must be an ASCII character.
+ * @return         The word with the high bit set in
+ *                 the bytes in the range, and all
+ *                 other bits cleared.
+ */
+static inline uint64_t ascii_in_range_word(uint64_t w, unsigned char first, unsigned char last)
+{
+  const uint64_t ones = UINT64_C(0x0101010101010101), high = ones * 0x80;
+  uint64_t x = w & ~high;
+  /* Neither sum can carry into the next byte. */
+  return (x + ones * (0x80 - first)) & ~(x + ones * (0x7F - last)) & ~w & high;
+}
+
+
+/**
+ * Change the case of ASCII letters, 8 bytes at a time.
+ * 
+ * @param   d      Output buffer, may be `s`.
+ * @param   s      The text.
+ * @param   n      The length of `s`.
+ * @param   fold   Bits to set in each byte before
+ *                 checking whether it is in the range.
+ * @param   first  The first letter to change, all letters
+ *                 from it to 'z' or 'Z' are changed.
+ * @return         The number of bytes processed, the
+ *                 rest are left for the caller.
+ */
+static size_t ascii_change_case_word(char* d, const char* s, size_t n,
+				     unsigned char fold, unsigned char first)
+{
+  const uint64_t ones = UINT64_C(0x0101010101010101);
+  uint64_t w;
+  size_t i;
+  
+  for (i = 0; n - i >= 8; i += 8)
+    {
+      memcpy(&w, s + i, 8);
+      w ^= ascii_in_range_word(w | ones * fold, first, first + 25) >> 2;
+      memcpy(d + i, &w, 8);
+    }
+  
+  return i;
+}
+
+
+/**
+ * ROT13 ASCII letters, 8 bytes at a time.
+ * 
+ * @param   d  Output buffer, may be `s`.
+ * @param   s  The text.
+ * @param   n  The length of `s`.
+ * @return     The number of bytes processed, the
+ *             rest are left for the caller.
+ */
+static size_t rot13_word(char* d, const char* s, size_t n)
+{
+  const uint64_t ones = UINT64_C(0x0101010101010101);
+  uint64_t w, first_half, second_half;
+  size_t i;
+  
+  for (i = 0; n - i >= 8; i += 8)
+    {
+      memcpy(&w, s + i, 8);
+      first_half  = ascii_in_range_word(w | ones * 0x20, 'a', 'm');
+      second_half = ascii_in_range_word(w | ones * 0x20, 'n', 'z');
+      w += (first_half >> 7) * 13;
+      w -= (second_half >> 7) * 13;
+      memcpy(d + i, &w, 8);
+    }
+  
+  return i;
+}
+
+
+#if defined(HAVE_X86_SIMD)
+
+/**
+ * Change the case of ASCII letters, 16 bytes at a time.
+ * 
+ * @param   d      Output buffer, may be `s`.
+ * @param   s      The text.
+ * @param   n      The length of `s`.
+ * @param   fold   Bits to set in each byte before
+ *                 checking whether it is in the range.
+ * @param   first  The first letter to change, all letters
+ *                 from it to 'z' or 'Z' are changed.
+ * @return         The number of bytes processed, the
+ *                 rest are left for the caller.
+ */
+__attribute__((__target__("sse2")))
+static size_t ascii_change_case_sse2(char* d, const char* s, size_t n,
+				     unsigned char fold, unsigned char first)
+{
+  /* Shifting `first` to -128 puts the letters below -102. */
+  const __m128i bits = _mm_set1_epi8((char)fold);
+  const __m128i shift = _mm_set1_epi8((char)(0x80 - first));
+  const __m128i limit = _mm_set1_epi8((char)(-128 + 26));
+  const __m128i flip = _mm_set1_epi8(0x20);
+  size_t i;
+  __m128i v, letters;
+  
+  for (i = 0; n - i >= 16; i += 16)
+    {
+      v = _mm_loadu_si128((const __m128i*)(s + i));
+      letters = _mm_cmpgt_epi8(limit, _mm_add_epi8(_mm_or_si128(v, bits), shift));
+      _mm_storeu_si128((__m128i*)(d + i), _mm_xor_si128(v, _mm_and_si128(letters, flip)));
+    }
+  
+  return i;
+}
+
+
+/**
+ * Change the case of ASCII letters, 32 bytes at a time.
+ * 
+ * @param   d      Output buffer, may be `s`.
+ * @param   s      The text.
+ * @param   n      The length of `s`.
+ * @param   fold   Bits to set in each byte before
+ *                 checking whether it is in the range.
+ * @param   first  The first letter to change, all letters
+ *                 from it to 'z' or 'Z' are changed.
+ * @return         The number of bytes processed, the
+ *                 rest are left for the caller.
+ */
+__attribute__((__target__("avx2")))
+static size_t ascii_change_case_avx2(char* d, const char* s, size_t n,
+				     unsigned char fold, unsigned char first)
+{
+  const __m256i bits = _mm256_set1_epi8((char)fold);
+  const __m256i shift = _mm256_set1_epi8((char)(0x80 - first));
+  const __m256i limit = _mm256_set1_epi8((char)(-128 + 26));
+  const __m256i flip = _mm256_set1_epi8(0x20);
+  size_t i;
+  __m256i v, letters;
+  
+  for (i = 0; n - i >= 32; i += 32)
+    {
+      v = _mm256_loadu_si256((const __m256i*)(s + i));
+      letters = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(_mm256_or_si256(v, bits), shift));
+      _mm256_storeu_si256((__m256i*)(d + i), _mm256_xor_si256(v, _mm256_and_si256(letters, flip)));
+    }
+  
+  return i;
+}
+
+
+/**
+ * ROT13 ASCII letters, 16 bytes at a time.
+ * 
+ * @param   d  Output buffer, may be `s`.
+ * @param   s  The text.
+ * @param   n  The length of `s`.
+ * @return     The number of bytes processed, the
+ *             rest are left for the caller.
+ */
+__attribute__((__target__("sse2")))
+static size_t rot13_sse2(char* d, const char* s, size_t n)
+{
+  const __m128i fold = _mm_set1_epi8(0x20);
+  const __m128i shift_first = _mm_set1_epi8((char)(0x80 - 'a'));
+  const __m128i shift_second = _mm_set1_epi8((char)(0x80 - 'n'));
+  const __m128i limit = _mm_set1_epi8((char)(-128 + 13));
+  const __m128i thirteen = _mm_set1_epi8(13);
+  size_t i;
+  __m128i v, l, first_half, second_half;
+  
+  for (i = 0; n - i >= 16; i += 16)
+    {
+      v = _mm_loadu_si128((const __m128i*)(s + i));
+      l = _mm_or_si128(v, fold);
+      first_half  = _mm_cmpgt_epi8(limit, _mm_add_epi8(l, shift_first));
+      second_half = _mm_cmpgt_epi8(limit, _mm_add_epi8(l, shift_second));
+      v = _mm_add_epi8(v, _mm_and_si128(first_half, thirteen));
+      v = _mm_sub_epi8(v, _mm_and_si128(second_half, thirteen));
+      _mm_storeu_si128((__m128i*)(d + i), v);
+    }
+  
+  return i;
+}
+
+
+/**
+ * ROT13 ASCII letters, 32 bytes at a time.
+ * 
+ * @param   d  Output buffer, may be `s`.
+ * @param   s  The text.
+ * @param   n  The length of `s`.
+ * @return     The number of bytes processed, the
+ *             rest are left for the caller.
+ */
+__attribute__((__target__("avx2")))
+static size_t rot13_avx2(char* d, const char* s, size_t n)
+{
+  const __m256i fold = _mm256_set1_epi8(0x20);
+  const __m256i shift_first = _mm256_set1_epi8((char)(0x80 - 'a'));
+  const __m256i shift_second = _mm256_set1_epi8((char)(0x80 - 'n'));
+  const __m256i limit = _mm256_set1_epi8((char)(-128 + 13));
+  const __m256i thirteen = _mm256_set1_epi8(13);
+  size_t i;
+  __m256i v, l, first_half, second_half;
+  
+  for (i = 0; n - i >= 32; i += 32)
+    {
+      v = _mm256_loadu_si256((const __m256i*)(s + i));
+      l = _mm256_or_si256(v, fold);
+      first_half  = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(l, shift_first));
+      second_half = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(l, shift_second));
+      v = _mm256_add_epi8(v, _mm256_and_si256(first_half, thirteen));
+      v = _mm256_sub_epi8(v, _mm256_and_si256(second_half, thirteen));
+      _mm256_storeu_si256((__m256i*)(d + i), v);
+    }
+  
+  return i;
+}
+
+#endif
+
+
+/**
+ * Change the case of ASCII letters.
+ * 
+ * This does not depend on the locale,
+ * other bytes are copied as they are.
+ * 
+ * @param  d       Output buffer, may be `s`.
+ * @param  s       The text.
+ * @param  n       The length of `s`.
+ * @param  change  How to change the case, see `change_case`.
+ */
+static void ascii_change_case(char* d, const char* s, size_t n, int change)
+{
+  unsigned char fold = (change == CASE_SWAP) ? 0x20 : 0;
+  unsigned char first = (change == UNICODE_CASE_LOWER) ? 'A' : 'a';
+  unsigned char c;
+  size_t i;
+  
+#if defined(HAVE_X86_SIMD)
+  if (__builtin_cpu_supports("avx2"))
+    i = ascii_change_case_avx2(d, s, n, fold, first);
+  else if (__builtin_cpu_supports("sse2"))
+    i = ascii_change_case_sse2(d, s, n, fold, first);
+  else
+#endif
+    i = ascii_change_case_word(d, s, n, fold, first);
+  
+  for (; i < n; i++)
+    {
+      c = (unsigned char)s[i];
+      d[i] = (char)((unsigned char)((c | fold) - first) < 26 ? (c ^ 0x20) : c);
+    }
+}
+
+
+/**
+ * ROT13 ASCII letters.
+ * 
+ * This does not depend on the locale,
+ * other bytes are copied as they are.
+ * 
+ * @param  d  Output buffer, may be `s`.
+ * @param  s  The text.
+ * @param  n  The length of `s`.
+ */
+static void rot13(char* d, const char* s, size_t n)
+{
+  unsigned char c;
+  size_t i;
+  
+#if defined(HAVE_X86_SIMD)
+  if (__builtin_cpu_supports("avx2"))
+    i = rot13_avx2(d, s, n);
+  else if (__builtin_cpu_supports("sse2"))
+    i = rot13_sse2(d, s, n);
+  else
+#endif
+    i = rot13_word(d, s, n);
+  
+  for (; i < n; i++)
+    {
+      c = (unsigned char)s[i];
+      if ((unsigned char)((c | 0x20) - 'a') < 13)
+	c += 13;
+      else if ((unsigned char)((c | 0x20) - 'n') < 13)
+	c -= 13;
+      d[i] = (char)c;
+    }
+}
+
+
+/**
+ * Change the case of the character at a position in a string.
+ * 
+ * Bytes that do not begin a complete UTF-8
+ * character are left as they are.
+ * 
+ * @param   s       The character.
+ * @param   avail   The number of bytes left in the string.
+ * @param   change  How to change the case, see `change_case`.
+ * @param   out     Output buffer for the changed character,
+ *                  must have room for 12 bytes.
+ * @param   n       Output parameter for the number of
+ *                  bytes in the character.
+ * @return          The number of bytes stored in `out`.
+ */
+static size_t change_case_char(const char* s, size_t avail, int change, char* out, size_t* n)
+{
+  const int32_t* record;
+  const uint32_t* map;
+  size_t w = utf8_width((unsigned char)*s), lo, hi, mid, i, len;
+  uint32_t cp;
+  
+  *n = 1;
+  if ((w == 1) || (w > 4) || (utf8_charlen(s, avail) != w))
+    {
+      ascii_change_case(out, s, 1, change);
+      return 1;
+    }
+  
+  /* Overlong characters are not changed either. */
+  cp = utf8_decode(s, w, n);
+  if ((cp >= 0x110000) || (utf8_encode(cp, out) != w))
+    return memcpy(out, s, w), w;
+  
+  record = unicode_case_of(cp);
+  if (change == CASE_SWAP)
+    change = record[UNICODE_CASE_LOWER] ? UNICODE_CASE_LOWER : UNICODE_CASE_UPPER;
+  if (!record[UNICODE_CASE_SPECIAL])
+    return utf8_encode(cp + (uint32_t)record[change], out);
+  
+  /* Mappings to more than one character are looked up separately. */
+  lo = 0, hi = sizeof(unicode_special_casing_keys) / sizeof(*unicode_special_casing_keys);
+  while (unicode_special_casing_keys[mid = lo + (hi - lo) / 2] != cp)
+    if (unicode_special_casing_keys[mid] < cp)
+      lo = mid + 1;
+    else
+      hi = mid;
+  map = unicode_special_casing[mid][change - UNICODE_CASE_LOWER];
+  for (i = len = 0; (i < 3) && map[i]; i++)
+    len += utf8_encode(map[i], out + len);
+  return len;
+}
+
+
+/**
+ * Change the case of the characters in a string.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string.
+ * @param   n       The length of `string`.
+ * @param   change  How to change the case: `UNICODE_CASE_LOWER`,
+ *                  `UNICODE_CASE_UPPER`, `UNICODE_CASE_TITLE`
+ *                  or `CASE_SWAP`.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+static size_t change_case(char* buf, size_t size, const char* string, size_t n, int change)
+{
+  char out[12];
+  size_t i = 0, k, m, len = 0;
+  
+  while (i < n)
+    {
+      /* ASCII is changed without looking at the tables. */
+      k = ascii_prefix((const unsigned char*)string + i, n - i);
+      if (k > 0)
+	{
+	  if (len + 1 < size)
+	    {
+	      m = k < size - 1 - len ? k : size - 1 - len;
+	      ascii_change_case(buf + len, string + i, m, change);
+	    }
+	  len += k, i += k;
+	  continue;
+	}
+      m = change_case_char(string + i, n - i, change, out, &k);
+      len = put(buf, size, len, out, m);
+      i += k;
+    }
+  
+  return terminate(buf, size, len);
+}
+
+
+/**
+ * Change the case of the characters in a string,
+ * modifying it in place.
+ * 
+ * @param   string  The string.
+ * @param   n       The length of `string`.
+ * @param   change  How to change the case, see `change_case`.
+ * @return          0 on success, -1 on error.
+ * 
+ * @throws  ERANGE  A character would be replaced by
+ *                  one of another length. `string`
+ *                  is left unmodified.
+ */
+static int change_case_inplace(char* string, size_t n, int change)
+{
+  char out[12];
+  size_t i, k;
+  
+  /* Check everything first, so nothing is changed on error. */
+  for (i = 0; i < n; i += k)
+    if (!(string[i] & 0x80))
+      k = ascii_prefix((const unsigned char*)string + i, n - i);
+    else if (change_case_char(string + i, n - i, change, out, &k) != k)
+      return errno = ERANGE, -1;
+  
+  for (i = 0; i < n; i += k)
+    if (!(string[i] & 0x80))
+      {
+	k = ascii_prefix((const unsigned char*)string + i, n - i);
+	ascii_change_case(string + i, string + i, k, change);
+      }
+    else
+      {
+	change_case_char(string + i, n - i, change, out, &k);
+	memcpy(string + i, out, k * sizeof(char));
+      }
+  return 0;
+}
+
+
+/**
+ * Replace uppercase letters with lowercase letters.
+ * 
+ * Letters are changed with the full Unicode case
+ * mappings, so a letter can become longer or shorter,
+ * or become several letters. Mappings that depend on
+ * the language or on the surrounding letters, such
+ * as the final form of sigma, are not used.
+ * 
+ * Example:
+ *   s = libstring_lcase("Hello World!");
+ *   # s is "hello world!"
+ *   free(s);
+ * 
+ * @param   string  The string to manipulate.
+ * @return          Lowercase version of `string`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_lcase(const char* string)
+{
+  size_t len = strlen(string), n;
+  STATS_ENTER(lcase, len);
+  char* rc;
+  PROBE_ENTRY(lcase, len, 0);
+  n = change_case(NULL, 0, string, len, UNICODE_CASE_LOWER);
+  rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    change_case(rc, n + 1, string, len, UNICODE_CASE_LOWER);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  PROBE_RETURN(lcase, len, rc == NULL ? (size_t)-1 : n, 0);
+  return rc;
+}
+
+
+/**
+ * Replace uppercase letters with lowercase letters,
+ * and store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_lcase`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+size_t libstring_lcase_into(char* buf, size_t size, const char* string)
+{
+  size_t len = strlen(string), rc;
+  STATS_ENTER(lcase_into, len);
+  PROBE_ENTRY(lcase_into, len, 0);
+  rc = change_case(buf, size, string, len, UNICODE_CASE_LOWER);
+  PROBE_RETURN(lcase_into, len, rc, 0);
+  return STATS_INTO(rc, size);
+}
+
+
+/**
+ * Replace uppercase letters with lowercase letters,
+ * modifying the string in place.
+ * 
+ * Example:
+ *   char s[] = "Hello World!";
+ *   libstring_lcase_inplace(s, NULL);
+ *   # s is "hello world!"
+ * 
+ * @param   string  The string to manipulate.
+ * @param   n       Either a pointer to the length of
+ *                  `string`, or `NULL` if `string`
+ *                  is NUL-terminated.
+ * @return          0 on success, -1 on error.
+ * 
+ * @throws  ERANGE  A character would be replaced by one
+ *                  of another length. `string` is left
+ *                  unmodified.
+ */
+int libstring_lcase_inplace(char* string, const size_t* n)
+{
+  size_t m = (n == NULL ? strlen(string) : *n);
+  STATS_ENTER(lcase_inplace, m);
+  int r;
+  PROBE_ENTRY(lcase_inplace, m, 0);
+  r = change_case_inplace(string, m, UNICODE_CASE_LOWER);
+  STATS_OUTPUT(r == 0 ? m : 0);
+  PROBE_RETURN(lcase_inplace, m, r == 0 ? m : (size_t)-1, 0);
+  return r;
+}
+
+
+/**
+ * Replace uppercase letters with lowercase letters in
+ * a string of a given length, and store the result
+ * in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_lcase`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_lcase_str(struct libstring_str* out, const char* string, size_t n)
+{
+  STATS_ENTER(lcase_str, n);
+  int r;
+  PROBE_ENTRY(lcase_str, n, 0);
+  while ((r = str_result(out, change_case(out->ptr, out->cap, string, n, UNICODE_CASE_LOWER))) > 0);
+  STATS_OUTPUT(out->len);
+  PROBE_RETURN(lcase_str, n, r == 0 ? out->len : (size_t)-1, 0);
+  return r;
+}
+
+
+/**
+ * `change_case` to lowercase as a `batch_transform_t`.
+ */
+static size_t batch_lcase(char* buf, size_t size, const char* string, size_t n, const void* ctx)
+{
+  (void) ctx;
+  return change_case(buf, size, string, n, UNICODE_CASE_LOWER);
+}
+
+
+/**
+ * Replace uppercase letters with lowercase letters
+ * in each string in an array.
+ * 
+ * This is the same as `libstring_lcase`, applied to each string
+ * in an array, except the results are packed into one
+ * allocation, with their offsets in another.
+ * 
+ * @param   out      Output parameter for the results.
+ * @param   strings  The strings to manipulate.
+ * @param   n        The number of strings in `strings`.
+ * @return           0 on success, -1 on error, in
+ *                   which case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_lcase_batch(struct libstring_batch* out, const char* const* strings, size_t n)
+{
+  STATS_ENTER(lcase_batch, stats_bytes(strings, n));
+  int r = batch(out, strings, n, batch_lcase, NULL);
+  STATS_OUTPUT(r == 0 ? out->offsets[n] - n : 0);
+  return r;
+}
+
+
+/**
+ * Replace lowercase letters with uppercase letters.
+ * 
+ * This is done in the same way as `libstring_lcase`
+ * does the opposite, so for example "ß" becomes "SS".
+ * 
+ * Example:
+ *   s = libstring_ucase("Hello World!");
+ *   # s is "HELLO WORLD!"
+ *   free(s);
+ * 
+ * @param   string  The string to manipulate.
+ * @return          Uppercase version of `string`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_ucase(const char* string)
+{
+  size_t len = strlen(string), n;
+  STATS_ENTER(ucase, len);
+  char* rc;
+  PROBE_ENTRY(ucase, len, 0);
+  n = change_case(NULL, 0, string, len, UNICODE_CASE_UPPER);
+  rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    change_case(rc, n + 1, string, len, UNICODE_CASE_UPPER);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  PROBE_RETURN(ucase, len, rc == NULL ? (size_t)-1 : n, 0);
+  return rc;
+}
+
+
+/**
+ * Replace lowercase letters with uppercase letters,
+ * and store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_ucase`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+size_t libstring_ucase_into(char* buf, size_t size, const char* string)
+{
+  size_t len = strlen(string), rc;
+  STATS_ENTER(ucase_into, len);
+  PROBE_ENTRY(ucase_into, len, 0);
+  rc = change_case(buf, size, string, len, UNICODE_CASE_UPPER);
+  PROBE_RETURN(ucase_into, len, rc, 0);
+  return STATS_INTO(rc, size);
+}
+
+
+/**
+ * Replace lowercase letters with uppercase letters,
+ * modifying the string in place.
+ * 
+ * Example:
+ *   char s[] = "Hello World!";
+ *   libstring_ucase_inplace(s, NULL);
+ *   # s is "HELLO WORLD!"
+ * 
+ * @param   string  The string to manipulate.
+ * @param   n       Either a pointer to the length of
+ *                  `string`, or `NULL` if `string`
+ *                  is NUL-terminated.
+ * @return          0 on success, -1 on error.
+ * 
+ * @throws  ERANGE  A character would be replaced by one
+ *                  of another length. `string` is left
+ *                  unmodified.
+ */
+int libstring_ucase_inplace(char* string, const size_t* n)
+{
+  size_t m = (n == NULL ? strlen(string) : *n);
+  STATS_ENTER(ucase_inplace, m);
+  int r;
+  PROBE_ENTRY(ucase_inplace, m, 0);
+  r = change_case_inplace(string, m, UNICODE_CASE_UPPER);
+  STATS_OUTPUT(r == 0 ? m : 0);
+  PROBE_RETURN(ucase_inplace, m, r == 0 ? m : (size_t)-1, 0);
+  return r;
+}
+
+
+/**
+ * Replace lowercase letters with uppercase letters in
+ * a string of a given length, and store the result
+ * in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_ucase`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_ucase_str(struct libstring_str* out, const char* string, size_t n)
+{
+  STATS_ENTER(ucase_str, n);
+  int r;
+  PROBE_ENTRY(ucase_str, n, 0);
+  while ((r = str_result(out, change_case(out->ptr, out->cap, string, n, UNICODE_CASE_UPPER))) > 0);
+  STATS_OUTPUT(out->len);
+  PROBE_RETURN(ucase_str, n, r == 0 ? out->len : (size_t)-1, 0);
+  return r;
+}
+
+
+/**
+ * `change_case` to uppercase as a `batch_transform_t`.
+ */
+static size_t batch_ucase(char* buf, size_t size, const char* string, size_t n, const void* ctx)
+{
+  (void) ctx;
+  return change_case(buf, size, string, n, UNICODE_CASE_UPPER);
+}
+
+
+/**
+ * Replace lowercase letters with uppercase letters
+ * in each string in an array.
+ * 
+ * This is the same as `libstring_ucase`, applied to each string
+ * in an array, except the results are packed into one
+ * allocation, with their offsets in another.
+ * 
+ * @param   out      Output parameter for the results.
+ * @param   strings  The strings to manipulate.
+ * @param   n        The number of strings in `strings`.
+ * @return           0 on success, -1 on error, in
+ *                   which case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_ucase_batch(struct libstring_batch* out, const char* const* strings, size_t n)
+{
+  STATS_ENTER(ucase_batch, stats_bytes(strings, n));
+  int r = batch(out, strings, n, batch_ucase, NULL);
+  STATS_OUTPUT(r == 0 ? out->offsets[n] - n : 0);
+  return r;
+}
+
+
+/**
+ * Capitalise a string of a given length, and
+ * store the result in a caller-provided buffer.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+static size_t capitalise_into(char* buf, size_t size, const char* string, size_t n)
+{
+  char out[12];
+  size_t k = 0, len = 0;
+  if (n > 0)
+    len = put(buf, size, 0, out, change_case_char(string, n, UNICODE_CASE_TITLE, out, &k));
+  return terminate(buf, size, put(buf, size, len, string + k, n - k));
+}
+
+
+/**
+ * Replace the first letter with its title case
+ * variant, which is its upper case variant unless
+ * it is a ligature like "ǆ", which becomes "ǅ".
+ * 
+ * Example:
+ *   s = libstring_capitalise("hello world!");
+ *   # s is "Hello world!"
+ *   free(s);
+ * 
+ * @param   string  The string to manipulate.
+ * @return          Capitalised version of `string`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_capitalise(const char* string)
+{
+  size_t len = strlen(string), n;
+  STATS_ENTER(capitalise, len);
+  char* rc;
+  PROBE_ENTRY(capitalise, len, 0);
+  n = capitalise_into(NULL, 0, string, len);
+  rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    capitalise_into(rc, n + 1, string, len);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  PROBE_RETURN(capitalise, len, rc == NULL ? (size_t)-1 : n, 0);
+  return rc;
+}
+
+
+/**
+ * Capitalise a string, and store the result
+ * in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_capitalise`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+size_t libstring_capitalise_into(char* buf, size_t size, const char* string)
+{
+  size_t len = strlen(string), rc;
+  STATS_ENTER(capitalise_into, len);
+  PROBE_ENTRY(capitalise_into, len, 0);
+  rc = capitalise_into(buf, size, string, len);
+  PROBE_RETURN(capitalise_into, len, rc, 0);
+  return STATS_INTO(rc, size);
+}
+
+
+/**
+ * Capitalise a string, modifying it in place.
+ * 
+ * Example:
+ *   char s[] = "hello world!";
+ *   libstring_capitalise_inplace(s, NULL);
+ *   # s is "Hello world!"
+ * 
+ * @param   string  The string to manipulate.
+ * @param   n       Either a pointer to the length of
+ *                  `string`, or `NULL` if `string`
+ *                  is NUL-terminated.
+ * @return          0 on success, -1 on error.
+ * 
+ * @throws  ERANGE  A character would be replaced by one
+ *                  of another length. `string` is left
+ *                  unmodified.
+ */
+int libstring_capitalise_inplace(char* string, const size_t* n)
+{
+  char out[12];
+  size_t m = (n == NULL ? strlen(string) : *n), k;
+  STATS_ENTER(capitalise_inplace, m);
+  PROBE_ENTRY(capitalise_inplace, m, 0);
+  if (m > 0)
+    {
+      if (change_case_char(string, m, UNICODE_CASE_TITLE, out, &k) != k)
+	{
+	  PROBE_RETURN(capitalise_inplace, m, -1, 0);
+	  return errno = ERANGE, -1;
+	}
+      memcpy(string, out, k * sizeof(char));
+    }
+  STATS_OUTPUT(m);
+  PROBE_RETURN(capitalise_inplace, m, m, 0);
+  return 0;
+}
+
+
+/**
+ * Capitalise a string of a given length, and
+ * store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_capitalise`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_capitalise_str(struct libstring_str* out, const char* string, size_t n)
+{
+  STATS_ENTER(capitalise_str, n);
+  int r;
+  PROBE_ENTRY(capitalise_str, n, 0);
+  while ((r = str_result(out, capitalise_into(out->ptr, out->cap, string, n))) > 0);
+  STATS_OUTPUT(out->len);
+  PROBE_RETURN(capitalise_str, n, r == 0 ? out->len : (size_t)-1, 0);
+  return r;
+}
+
+
+/**
+ * Replace lowercase letters with uppercase letters,
+ * and uppercase letters with lowercase letters.
+ * 
+ * Letters that have a lower case variant are changed
+ * to it, and other letters are changed to their upper
+ * case variant, in the same way as `libstring_lcase`
+ * and `libstring_ucase`.
+ * 
+ * Example:
+ *   s = libstring_swapcase("Hello World!");
+ *   # s is "hELLO wORLD!"
+ *   free(s);
+ * 
+ * @param   string  The string to manipulate.
+ * @return          `string` with swapped cased for
+ *                  all letters. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_swapcase(const char* string)
+{
+  size_t len = strlen(string), n;
+  STATS_ENTER(swapcase, len);
+  char* rc;
+  PROBE_ENTRY(swapcase, len, 0);
+  n = change_case(NULL, 0, string, len, CASE_SWAP);
+  rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    change_case(rc, n + 1, string, len, CASE_SWAP);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  PROBE_RETURN(swapcase, len, rc == NULL ? (size_t)-1 : n, 0);
+  return rc;
+}
+
+
+/**
+ * Swap the case of all letters in a string, and
+ * store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_swapcase`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+size_t libstring_swapcase_into(char* buf, size_t size, const char* string)
+{
+  size_t len = strlen(string), rc;
+  STATS_ENTER(swapcase_into, len);
+  PROBE_ENTRY(swapcase_into, len, 0);
+  rc = change_case(buf, size, string, len, CASE_SWAP);
+  PROBE_RETURN(swapcase_into, len, rc, 0);
+  return STATS_INTO(rc, size);
+}
+
+
+/**
+ * Swap the case of all letters in a string,
+ * modifying it in place.
+ * 
+ * Example:
+ *   char s[] = "Hello World!";
+ *   libstring_swapcase_inplace(s, NULL);
+ *   # s is "hELLO wORLD!"
+ * 
+ * @param   string  The string to manipulate.
+ * @param   n       Either a pointer to the length of
+ *                  `string`, or `NULL` if `string`
+ *                  is NUL-terminated.
+ * @return          0 on success, -1 on error.
+ * 
+ * @throws  ERANGE  A character would be replaced by one
+ *                  of another length. `string` is left
+ *                  unmodified.
+ */
+int libstring_swapcase_inplace(char* string, const size_t* n)
+{
+  size_t m = (n == NULL ? strlen(string) : *n);
+  STATS_ENTER(swapcase_inplace, m);
+  int r;
+  PROBE_ENTRY(swapcase_inplace, m, 0);
+  r = change_case_inplace(string, m, CASE_SWAP);
+  STATS_OUTPUT(r == 0 ? m : 0);
+  PROBE_RETURN(swapcase_inplace, m, r == 0 ? m : (size_t)-1, 0);
+  return r;
+}
+
+
 /**
- * Concatenate strings.
+ * Replace lowercase letters with uppercase letters,
+ * and uppercase letters with lowercase letters, in
+ * a string of a given length, and store the result
+ * in a `struct libstring_str`.
  * 
- * Example:
- *   const char* strings[] = {"alpha", "bet", "s", NULL};
- *   s = libstring_cat(strings, NULL);
- *   # s is "alphabets"
- *   free(s);
+ * This is the same as `libstring_swapcase`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
  * 
- * Example:
- *   const char* strings[] = {"alpha", "bet", "s"};
- *   size_t n = 3;
- *   s = libstring_cat(strings, &n);
- *   # s is "alphabets"
- *   free(s);
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
  * 
- * @param   strings  List of strings to concatenate, must
- *                   not be `NULL` or contain `NULL`:s.
- * @param   n        Either a pointer the number of strings
- *                   stored in `strings`, or `NULL` if
- *                   `strings` is `NULL`-terminated.
- * @return           A string with all strings in `strings`
- *                   concatenated in order, without any
- *                   delimiter. `NULL` on error.
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_swapcase_str(struct libstring_str* out, const char* string, size_t n)
+{
+  STATS_ENTER(swapcase_str, n);
+  int r;
+  PROBE_ENTRY(swapcase_str, n, 0);
+  while ((r = str_result(out, change_case(out->ptr, out->cap, string, n, CASE_SWAP))) > 0);
+  STATS_OUTPUT(out->len);
+  PROBE_RETURN(swapcase_str, n, r == 0 ? out->len : (size_t)-1, 0);
+  return r;
+}
+
+#undef CASE_SWAP
+
+
+/**
+ * Replace tabs with spaces.
+ * 
+ * @param   string  The string to manipulate.
+ * @param   flags   Additional options.
+ * @return          `string` with 8 spaces substituted
+ *                  tabs for tab space. `NULL` on error.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char* libstring_cat(const char* const* strings, const size_t* n)
+char* libstring_expand(const char* string, enum libstring_expand flags)
 {
-  size_t i, m = (n == NULL ? SIZE_MAX : *n);
-  size_t len = 0;
-  char* rc;
-  char* p;
-  
-  for (i = 0; (i < m) && (strings[i] != NULL); i++)
-    len += strlen(strings[i]);
-  m = i;
+  STATS_ENTER(expand, strlen(string));
+  size_t n = libstring_expand_into(NULL, 0, string, flags);
+  char* rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    libstring_expand_into(rc, n + 1, string, flags);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  return rc;
+}
+
+
+/**
+ * Replace tabs with spaces in a string of a given length,
+ * and store the result in a caller-provided buffer.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+static size_t expand_into(char* buf, size_t size, const char* string, size_t n,
+			  enum libstring_expand flags)
+{
+  enum libstring_length lflags = (enum libstring_length)
+    (flags & (LIBSTRING_EXPAND_IGNORE_COMBINING | LIBSTRING_EXPAND_DISPLAY_LENGTH));
+  const char* end = string + n;
+  size_t len = 0, col = 0, i, k, m;
+  uint32_t cp, prev = 0;
+  int initial = 1;
   
-  p = rc = malloc((len + 1) * sizeof(char));
-  if (rc == NULL)
-    return NULL;
+  if ((flags & LIBSTRING_EXPAND_INITIAL_ONLY))
+    flags |= LIBSTRING_EXPAND_IGNORE_BACKSPACE;
   
-  for (i = 0; i < m; i++)
-    p = stpcpy(p, strings[i]);
+  for (; string != end; string += m)
+    {
+      if (*string == '\n')
+	{
+	  col = 0, prev = 0, initial = 1, m = 1;
+	}
+      else if ((*string == '\t') && (initial || !(flags & LIBSTRING_EXPAND_INITIAL_ONLY)))
+	{
+	  k = 8 - col % 8;
+	  len = put(buf, size, len, "        ", k);
+	  col += k, prev = 0, m = 1;
+	  continue;
+	}
+      else if ((*string == '\b') && !(flags & LIBSTRING_EXPAND_IGNORE_BACKSPACE))
+	{
+	  col -= (col > 0), m = 1;
+	}
+      else
+	{
+	  /* Measure up to the next character that is not simply counted. */
+	  for (m = 1; (string + m != end) && (string[m] != '\t') && (string[m] != '\n') && (string[m] != '\b'); m++);
+	  for (i = 0; i < m; i += k)
+	    {
+	      if (string[i] != ' ')
+		initial = 0;
+	      if ((string[i] & 0xC0) == 0x80)
+		{
+		  k = 1;
+		  continue;
+		}
+	      cp = utf8_decode(string + i, m - i, &k);
+	      col += char_length(cp, prev, lflags);
+	      prev = cp;
+	    }
+	}
+      len = put(buf, size, len, string, m);
+    }
   
-  return rc;
+  return terminate(buf, size, len);
 }
 
 
 /**
- * Concatenate strings.
+ * Replace tabs with spaces, and store the result
+ * in a caller-provided buffer.
  * 
- * Example:
- *   s = libstring_vcat("alpha", "bet", "s", NULL);
- *   # s is "alphabets"
- *   free(s);
+ * This is the same as `libstring_expand`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
  * 
- * @param   strings...  List of strings to concatenate, end
- *                      with a `NULL`.
- * @return              A string with all strings in `strings`
- *                      concatenated in order, without any
- *                      delimiter. `NULL` on error.
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+size_t libstring_expand_into(char* buf, size_t size, const char* string,
+			     enum libstring_expand flags)
+{
+  STATS_ENTER(expand_into, strlen(string));
+  return STATS_INTO(expand_into(buf, size, string, strlen(string), flags), size);
+}
+
+
+/**
+ * Replace tabs with spaces in a string of a given length,
+ * and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_expand`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @param   flags   Additional options.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char* libstring_vcat(const char* strings, ... /*, (char*)0 */)
+int libstring_expand_str(struct libstring_str* out, const char* string, size_t n, enum libstring_expand flags)
 {
-  size_t n = 0, m = 8;
-  va_list args;
-  const char** strs = NULL;
-  const char* str;
-  char* rc;
-  void* new;
-  int saved_errno = 0;
-  
-  if (strings == NULL)
-    return libstring_double_rot13("");
-  
-  str = malloc(m * sizeof(char*));
-  if (str == NULL)
-    return NULL;
-  
-  va_start(args, strings);
-  for (strs[n++] = strings; (str = va_arg(args, const char*)); strs[n++] = str)
-    if (n == m)
-      {
-	new = realloc(strs, (m <<= 1) * sizeof(char*));
-	if (new == NULL)
-	  {
-	    saved_errno = errno;
-	    break;
-	  }
-	strs = new;
-      }
-  va_end(args);
+  STATS_ENTER(expand_str, n);
+  int r;
+  while ((r = str_result(out, expand_into(out->ptr, out->cap, string, n, flags))) > 0);
+  STATS_OUTPUT(out->len);
+  return r;
+}
+
+
+/**
+ * Replace initial spaces of groups of 8 with tabs.
+ * 
+ * @param   string  The string to manipulate.
+ * @return          `string` with initial spaces of
+ *                  groups of 8, replaced with tab
+ *                  spaces. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_unexpand(const char* string)
+{
+  STATS_ENTER(unexpand, strlen(string));
+  size_t n = libstring_unexpand_into(NULL, 0, string);
+  char* rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    libstring_unexpand_into(rc, n + 1, string);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  return rc;
+}
+
+
+/**
+ * Replace initial spaces of groups of 8 with tabs in a string
+ * of a given length, and store the result in a caller-provided
+ * buffer.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+static size_t unexpand_into(char* buf, size_t size, const char* string, size_t n)
+{
+  const char* end = string + n;
+  const char* q;
+  size_t len = 0, col;
   
-  if (saved_errno == 0)
-    goto fail;
-  rc = libstring_cat(strs, &n);
-  if (rc == NULL)
+  while (string != end)
     {
-      saved_errno = errno;
-      goto fail;
+      for (col = 0; (string != end) && ((*string == ' ') || (*string == '\t')); string++)
+	col = (*string == ' ') ? col + 1 : (col + 8) & ~(size_t)7;
+      for (; col >= 8; col -= 8)
+	len = put(buf, size, len, "\t", 1);
+      len = put(buf, size, len, "        ", col);
+      
+      q = memchr(string, '\n', (size_t)(end - string));
+      n = (q == NULL) ? (size_t)(end - string) : (size_t)(q + 1 - string);
+      len = put(buf, size, len, string, n);
+      string += n;
     }
-  free(strs);
-  return rc;
   
- fail:
-  free(strs);
-  errno = saved_errno;
-  return NULL;
+  return terminate(buf, size, len);
 }
 
 
 /**
- * Concatenate strings and insert a delimiter between the strings.
+ * Replace initial spaces of groups of 8 with tabs,
+ * and store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_unexpand`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+size_t libstring_unexpand_into(char* buf, size_t size, const char* string)
+{
+  STATS_ENTER(unexpand_into, strlen(string));
+  return STATS_INTO(unexpand_into(buf, size, string, strlen(string)), size);
+}
+
+
+/**
+ * Replace initial spaces of groups of 8 with tabs in a string
+ * of a given length, and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_unexpand`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_unexpand_str(struct libstring_str* out, const char* string, size_t n)
+{
+  STATS_ENTER(unexpand_str, n);
+  int r;
+  while ((r = str_result(out, unexpand_into(out->ptr, out->cap, string, n))) > 0);
+  STATS_OUTPUT(out->len);
+  return r;
+}
+
+
+/**
+ * ROT13: Offensive joke and spoiler masker.
  * 
  * Example:
- *   const char* strings[] = {"alpha", "bet", "s", NULL};
- *   s = libstring_join(strings, NULL, "--");
- *   # s is "alpha--bet--s"
- *   free(s);
+ *   s = libstring_rot13("An offensive joke");
+ *   # s is "Na bssrafvir wbxr"
+ *   z = libstring_rot13(s);
+ *   # z is "An offensive joke"
+ *   free(s), free(z);
+ * 
+ * @param   string  The string to manipulate.
+ * @return          `string` with all ASCII letters
+ *                  substituted for the corresponding
+ *                  letter in the alphabet whose position
+ *                  is offset from that letter by 13.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+char* libstring_rot13(const char* string)
+{
+  STATS_ENTER(rot13, strlen(string));
+  size_t n = libstring_rot13_into(NULL, 0, string);
+  char* rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    libstring_rot13_into(rc, n + 1, string);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
+  return rc;
+}
+
+
+/**
+ * ROT13 a string of a given length, and store
+ * the result in a caller-provided buffer.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+static size_t rot13_into(char* buf, size_t size, const char* string, size_t n)
+{
+  if (size > 0)
+    rot13(buf, string, n < size ? n : size - 1);
+  return terminate(buf, size, n);
+}
+
+
+/**
+ * ROT13 a string, and store the result
+ * in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_rot13`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+size_t libstring_rot13_into(char* buf, size_t size, const char* string)
+{
+  STATS_ENTER(rot13_into, strlen(string));
+  return STATS_INTO(rot13_into(buf, size, string, strlen(string)), size);
+}
+
+
+/**
+ * ROT13 a string, modifying it in place.
  * 
  * Example:
- *   const char* strings[] = {"alpha", "bet", "s"};
- *   size_t n = 3;
- *   s = libstring_join(strings, &n, "--");
- *   # s is "alpha--bet--s"
- *   free(s);
+ *   char s[] = "An offensive joke";
+ *   libstring_rot13_inplace(s, NULL);
+ *   # s is "Na bssrafvir wbxr"
  * 
- * @param   strings    List of strings to join, must
- *                     not be `NULL` or contain `NULL`:s.
- * @param   n          Either a pointer the number of strings
- *                     stored in `strings`, or `NULL` if
- *                     `strings` is `NULL`-terminated.
- * @param   delimiter  A string to insert between all strings.
- * @return             A string with all strings in `strings`
- *                     concatenated in order, with the
- *                     delimiter `delimiter`. `NULL` on error.
+ * ROT13 never changes the length of the string,
+ * so unlike `libstring_lcase_inplace`, this
+ * function cannot fail.
+ * 
+ * @param   string  The string to manipulate.
+ * @param   n       Either a pointer to the length of
+ *                  `string`, or `NULL` if `string`
+ *                  is NUL-terminated.
+ * @return          0.
+ */
+int libstring_rot13_inplace(char* string, const size_t* n)
+{
+  size_t m = (n == NULL ? strlen(string) : *n);
+  STATS_ENTER(rot13_inplace, m);
+  rot13(string, string, m);
+  STATS_OUTPUT(m);
+  return 0;
+}
+
+
+/**
+ * ROT13 a string of a given length, and store
+ * the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_rot13`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_rot13_str(struct libstring_str* out, const char* string, size_t n)
+{
+  STATS_ENTER(rot13_str, n);
+  int r;
+  while ((r = str_result(out, rot13_into(out->ptr, out->cap, string, n))) > 0);
+  STATS_OUTPUT(out->len);
+  return r;
+}
+
+
+/**
+ * `rot13_into` as a `batch_transform_t`.
+ */
+static size_t batch_rot13(char* buf, size_t size, const char* string, size_t n, const void* ctx)
+{
+  (void) ctx;
+  return rot13_into(buf, size, string, n);
+}
+
+
+/**
+ * ROT13 each string in an array.
+ * 
+ * This is the same as `libstring_rot13`, applied to each string
+ * in an array, except the results are packed into one
+ * allocation, with their offsets in another.
+ * 
+ * @param   out      Output parameter for the results.
+ * @param   strings  The strings to manipulate.
+ * @param   n        The number of strings in `strings`.
+ * @return           0 on success, -1 on error, in
+ *                   which case `out` is left empty.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char* libstring_join(const char* const* strings, const size_t* n, const char* delimiter)
+int libstring_rot13_batch(struct libstring_batch* out, const char* const* strings, size_t n)
 {
-  size_t i, m = (n == NULL ? SIZE_MAX : *n);
-  size_t len = 0;
-  char* rc;
-  char* p;
-  
-  for (i = 0; (i < m) && (strings[i] != NULL); i++)
-    len += strlen(strings[i]);
-  m = i;
-  
-  len += (m > 0 ? (m - 1) * strlen(delimiter) : 0);
-  
-  p = rc = malloc((len + 1) * sizeof(char));
-  if (rc == NULL)
-    return NULL;
-  
-  for (i = 0; i < m; i++)
-    {
-      if (i > 0)
-	p = stpcpy(p, delimiter);
-      p = stpcpy(p, strings[i]);
-    }
-  
-  return rc;
+  STATS_ENTER(rot13_batch, stats_bytes(strings, n));
+  int r = batch(out, strings, n, batch_rot13, NULL);
+  STATS_OUTPUT(r == 0 ? out->offsets[n] - n : 0);
+  return r;
 }
 
 
 /**
- * Concatenate strings and insert a delimiter between the strings.
+ * Double ROT13: terrorist-grade encryption.
  * 
  * Example:
- *   s = libstring_vjoin("alpha", "bet", "s", NULL, "--");
- *   # s is "alpha--bet--s"
+ *   s = libstring_rot13("Secret message");
+ *   # s is "Secret message"
  *   free(s);
  * 
- * @param   strings...  List of strings to concatenate, end
- *                      with a `NULL`.
- * @param   delimiter   A string to insert between all strings.
- * @return              A string with all strings in `strings`
- *                      concatenated in order, with the
- *                      delimiter `delimiter`. `NULL` on error.
+ * @param   string  The string to copy.
+ * @return          A copy of `string`. `NULL` on error.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char* libstring_vjoin(const char* strings, ... /*, (char*)0, const char* delimiter */)
+char* libstring_double_rot13(const char* string)
 {
-  size_t n = 0, m = 8;
-  va_list args;
-  const char** strs = NULL;
-  const char* str;
-  char* rc;
-  void* new;
-  int saved_errno = 0;
-  
-  if (strings == NULL)
-    return libstring_double_rot13("");
-  
-  str = malloc(m * sizeof(char*));
-  if (str == NULL)
-    return NULL;
-  
-  va_start(args, strings);
-  for (strs[n++] = strings; (str = va_arg(args, const char*)); strs[n++] = str)
-    if (n == m)
-      {
-	new = realloc(strs, (m <<= 1) * sizeof(char*));
-	if (new == NULL)
-	  {
-	    saved_errno = errno;
-	    break;
-	  }
-	strs = new;
-      }
-  if (saved_errno == 0)
-    str = va_arg(args, const char*);
-  va_end(args);
-  
-  if (saved_errno == 0)
-    goto fail;
-  rc = libstring_join(strs, &n, str);
-  if (rc == NULL)
-    {
-      saved_errno = errno;
-      goto fail;
-    }
-  free(strs);
+  STATS_ENTER(double_rot13, strlen(string));
+  size_t n = libstring_double_rot13_into(NULL, 0, string);
+  char* rc = allocate((n + 1) * sizeof(char));
+  if (rc != NULL)
+    libstring_double_rot13_into(rc, n + 1, string);
+  STATS_OUTPUT(rc == NULL ? 0 : n);
   return rc;
-  
- fail:
-  free(strs);
-  errno = saved_errno;
-  return NULL;
 }
 
 
 /**
- * Split a string at each occurrence of a selected delimiter.
+ * Copy a string into a caller-provided buffer.
  * 
- * @param   string     String to split.
- * @param   delimiter  The delimiter.
- * @param   n          Output parameter for the number of
- *                     strings in the returned list. May be `NULL`.
- * @param   flags      Additional options.
- * @return             `NULL`-terminated list of the substrings in
- *                     `string` which had `delimiter` between them.
- *                     `NULL` on error.
+ * This is the same as `libstring_double_rot13`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
  */
-char** libstring_split(const char* string, const char* delimiter, size_t* n, enum libstring_split flags) /* TODO */
+size_t libstring_double_rot13_into(char* buf, size_t size, const char* string)
 {
+  STATS_ENTER(double_rot13_into, strlen(string));
+  return STATS_INTO(terminate(buf, size, put(buf, size, 0, string, strlen(string))), size);
 }
 
 
 /**
- * Replace a substrings in a string.
+ * Copy a string of a given length
+ * into a `struct libstring_str`.
  * 
+ * This is the same as `libstring_double_rot13`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
  * @param   string  The string to manipulate.
- * @param   from    Substring to replace.
- * @param   to      String to substitute for `from`.
- * @param   flags   Additional options.
- * @return          `string` with `to` substituted for `from`.
- *                  `NULL` on error.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char* libstring_replace(const char* string, const char* from, const char* to, enum libstring_replace flags) /* TODO */
+int libstring_double_rot13_str(struct libstring_str* out, const char* string, size_t n)
 {
+  STATS_ENTER(double_rot13_str, n);
+  int r;
+  while ((r = str_result(out, terminate(out->ptr, out->cap, put(out->ptr, out->cap, 0, string, n)))) > 0);
+  STATS_OUTPUT(out->len);
+  return r;
 }
 
 
+
 /**
- * `r = libstring_shellsafe(s)` is equivalent to
- * `t = libstring_replace(s, "'", "'\''", 0);
- *  if (t && (r = malloc(strlen(t) + 3)))
- *    *r = '\'', strcpy(stpcpy(r + 1, t), "'");
- *  saved_errno = errno, free(t), errno = saved_errno;
- *  r;`.
- * You guess what it does, and why.
+ * Select the allocator used for all memory allocated
+ * by the library in the calling thread.
  * 
- * @param   string  The string to manipulate.
- * @return          The result. `NULL` on error.
+ * To use an allocator for a single call, select it
+ * before the call and restore the returned allocator
+ * after the call.
+ * 
+ * @param   allocator  The allocator, `NULL` for `malloc`, `realloc`
+ *                     and `free`. It must remain valid until it is
+ *                     replaced.
+ * @return             The previously selected allocator, `NULL`
+ *                     if it was `malloc`, `realloc` and `free`.
+ */
+const struct libstring_allocator* libstring_set_allocator(const struct libstring_allocator* new)
+{
+  const struct libstring_allocator* old = allocator;
+  allocator = new;
+  return old;
+}
+
+
+/**
+ * Deallocate memory returned by the library, using
+ * the allocator selected in the calling thread.
+ * 
+ * `free` can be used instead of this function if
+ * no allocator has been selected.
+ * 
+ * @param  ptr  The memory to deallocate, may be `NULL`.
+ */
+void libstring_free(void* ptr)
+{
+  deallocate(ptr);
+}
+
+
+/**
+ * Make room for a string of a given length
+ * in a `struct libstring_str`, keeping its
+ * contents.
+ * 
+ * @param   str  The string.
+ * @param   len  The length, excluding the terminating
+ *               NUL byte, to make room for.
+ * @return       0 on success, -1 on error, in which
+ *               case `str` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char* libstring_shellsafe(const char* string)
+int libstring_str_reserve(struct libstring_str* str, size_t len)
 {
-  char* t = NULL;
-  char* r = NULL;
-  int saved_errno;
-  
-  t = libstring_replace(strings, "'", "'\''", 0);
-  if (t == NULL)
-    goto fail;
-  
-  r = malloc(strlen(t) + 3);
-  if (r == NULL)
-    goto fail;
-  
-  *r = '\'';
-  strcpy(stpcpy(r + 1, t), "'");
-  
-  free(t);
-  return r;
-  
- fail:
-  saved_errno = errno;
-  free(t);
-  free(r);
-  errno = saved_errno;
-  return NULL;
+  STATS_ENTER(str_reserve, 0);
+  return str_grow(&str->ptr, &str->cap, str->len, len);
 }
 
 
 /**
- * Measure the length of a string.
+ * Deallocate a `struct libstring_str`, and leave
+ * it empty so that it can be used again.
  * 
- * @param   string  The string to measure.
- * @param   flags   Additional options.
- * @return          The length of `string`.
+ * @param  str  The string.
  */
-size_t libstring_length(const char* string, enum libstring_length flags) /* TODO */
+void libstring_str_destroy(struct libstring_str* str)
 {
+  deallocate(str->ptr);
+  str->ptr = NULL;
+  str->len = str->cap = 0;
 }
 
 
 /**
- * Validate teh encoding of a string.
+ * Initialise a string builder, with an empty string.
  * 
- * @param   string  The string to validate.
- * @param   flags   Additional options.
- * @return          0 if the string is valid, -1 otherwise.
+ * Nothing is allocated until something is appended.
+ * 
+ * @param  builder  The builder.
  */
-int libstring_utf8verify(const char* string, enum libstring_utf8verify flags) /* TODO */
+void libstring_builder_initialise(struct libstring_builder* builder)
 {
+  builder->ptr = NULL;
+  builder->len = builder->cap = 0;
 }
 
 
 /**
- * Compare two `size_t`.
+ * Make room for more bytes in a string builder.
  * 
- * @param   a  Pointer to one of the `size_t`.
- * @param   b  Pointer to the other `size_t`.
- * @return     -1 if `*a` < `*b`, 0 if `*a` = `*b`, +1 if `*a` > `*b`.
+ * @param   builder  The builder.
+ * @param   n        The number of bytes to make room
+ *                   for, after the current string.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
  */
-static int size_cmp(const void* a, const void* b)
+int libstring_builder_reserve(struct libstring_builder* builder, size_t n)
 {
-  const size_t* i = a;
-  const size_t* j = b;
-  if (*i != *j)
-    return (*i < *j) ? -1 : +1;
-  return 0;
+  STATS_ENTER(builder_reserve, 0);
+  if (n > SIZE_MAX - builder->len)
+    return errno = ENOMEM, -1;
+  return str_grow(&builder->ptr, &builder->cap, builder->len, builder->len + n);
 }
 
 
 /**
- * Split a string at each occurrence of a selected delimiter,
- * but retain only select fields.
+ * Append a string to a string builder.
  * 
- * @param   string     The string to cut.
- * @param   delimiter  The delimiter.
- * @param   fields     List of fields to return.
- * @param   fields_n   The number of elements in `fields`.
- * @param   n          Output parameter for the number of
- *                     returned fields. May be `NULL`.
- * @param   flags      Additional options.
- * @return             `NULL`-terminated list of the
- *                     found fields. `NULL` on error.
+ * @param   builder  The builder.
+ * @param   string   The string to append, must not be
+ *                   stored in the builder.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char** libstring_cut(const char* string, const char* delimiter, const size_t* fields,
-		     size_t fields_n, size_t* n, enum libstring_cut flags)
+int libstring_builder_append(struct libstring_builder* builder, const char* string)
 {
-  enum libstring_split split_flags = 0;
-  char** fs = NULL;
-  char** fs_ = NULL;
-  size_t fn = 0, fn_ = 0, i, j, f, last = SIZE_MAX;
-  size_t* fields_ = NULL;
-  int saved_errno;
-  void* new;
-  
-  split_flags |= (flags & LIBSTRING_CUT_FROM_RIGHT)  ? LIBSTRING_SPLIT_FROM_RIGHT  : 0;
-  split_flags |= (flags & LIBSTRING_CUT_IGNORE_CASE) ? LIBSTRING_SPLIT_IGNORE_CASE : 0;
-  
-  if ((flags & LIBSTRING_CUT_COMPLEMENT))
-    flags |= LIBSTRING_CUT_ORDERED;
-  
-  if ((flags & (LIBSTRING_CUT_ORDERED | LIBSTRING_CUT_REVERSED)))
-    {
-      fields = fields_ = malloc((fields_n + 1) * sizeof(size_t));
-      if (fields_ == NULL)
-	goto fail;
-      memcpy(fields_, fields, fields_n * sizeof(size_t));
-      if ((flags & LIBSTRING_CUT_ORDERED))
-	qsort(fields_, fields_n, sizeof(size_t), size_cmp);
-      for (i = j = 0; i < fields_n; i++)
-	if (fields_[i] != last)
-	  {
-	    last = fields_[i];
-	    fields_[j++] = fields_[i];
-	  }
-      fields_n = i;
-      fields_[i] = SIZE_MAX;
-    }
-  
-  fs = libstring_split(string, delimiter, &fn, split_flags);
-  if (fs == NULL)
-    goto fail;
-  
-  if ((flags & LIBSTRING_CUT_REVERSED))
-    {
-      for (i = 0; i < fields_n; i++)
-	fields_[i] = fn - 1 - fields_[i];
-      if ((flags & LIBSTRING_CUT_ORDERED))
-	for (i = 0, j = fields_n - 1; i < j; i++, j--)
-	  last = fields_[i], fields_[i] = fields_[j], fields_[j] = last;
-    }
-  
-  if ((flags & LIBSTRING_CUT_ORDERED))
-    {
-      for (i = j = f = 0; i < fn; i++)
-	{
-	  while ((f < fields_n) && (fields[f] < i))
-	    f++;
-	  if ((flags & LIBSTRING_CUT_COMPLEMENT) ? (fields[f] != i) : (fields[f] == i))
-	    fs[j++] = fs[i], f++;
-	  else
-	    free(fs[i]);
-	}
-      fn = j;
-      fs[fn] = NULL;
-      free(fields_);
-      if (n != NULL)
-	*n = fn;
-      new = realloc(fs, (fn + 1) * sizeof(*fs));
-      if (new != NULL)
-	fs = new;
-      return fs;
-    }
-  
-  fs_ = malloc((fields_n + 1) * sizeof(char*));
-  if (fs_ == NULL)
-    goto fail;
-  for (fn_ = 0; fn_ < fields_n; fn_++)
-    fs_[fn_] = fs[fields[fn_]];
-  free(fields_);
-  while (fn--)
-    free(fs[fn]);
-  free(fs);
-  fs_[fields_n] = NULL;
-  return fs_;
-  
- fail:
-  saved_errno = errno;
-  free(fields_);
-  if (fs != NULL)
-    while (fn--)
-      free(fs[fn]);
-  free(fs);
-  if (fs_ != NULL)
-    while (fn_--)
-      free(fs_[fn_]);
-  free(fs_);
-  errno = saved_errno;
-  return NULL;
+  size_t n = strlen(string);
+  STATS_ENTER(builder_append, n);
+  int r = libstring_builder_append_n(builder, string, n);
+  STATS_OUTPUT(r == 0 ? n : 0);
+  return r;
 }
 
 
 /**
- * Split a string at each occurrence of a selected delimiter,
- * but retain only select fields.
+ * Append a string of a given length to a string builder.
  * 
- * @param   string     The string to cut.
- * @param   delimiter  The delimiter.
- * @param   fields...  List of fields to return.
- *                     End with `SIZE_MAX`.
- * @param   n          Output parameter for the number of
- *                     returned fields. May be `NULL`.
- * @param   flags      Additional options.
- * @return             `NULL`-terminated list of the
- *                     found fields. `NULL` on error.
+ * @param   builder  The builder.
+ * @param   string   The string to append, must not be stored
+ *                   in the builder. May contain NUL bytes.
+ * @param   n        The length of `string`.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char** libstring_vcut(const char* string, const char* delimiter, size_t fields,
-		      ... /*, SIZE_MAX, size_t* n, enum libstring_cut flags */)
+int libstring_builder_append_n(struct libstring_builder* builder, const char* string, size_t n)
 {
-  size_t n = 0, m = 8;
-  va_list args;
-  size_t* fs = NULL;
-  size_t f;
-  char** rc;
-  void* new;
-  size_t* p_n;
-  enum libstring_cut p_flags;
-  int saved_errno = 0;
-  
-  fs = malloc(m * sizeof(size_t));
-  if (fs == NULL)
-    return NULL;
-  
-  va_start(args, fields);
-  if (fields != SIZE_MAX)
-    for (fs[n++] = fields; (f = va_arg(args, size_t)) != SIZE_MAX; fs[n++] = f)
-      if (n == m)
-	{
-	  new = realloc(strs, (m <<= 1) * sizeof(size_t));
-	  if (new == NULL)
-	    {
-	      saved_errno = errno;
-	      break;
-	    }
-	  strs = new;
-	}
-  if (saved_errno == 0)
-    {
-      p_n = va_arg(args, size_t*);
-      p_flags = va_arg(args, enum libstring_cut);
-    }
-  va_end(args);
-  
-  if (saved_errno == 0)
-    goto fail;
-  rc = libstring_cut(string, delimiter, fs, p_n, p_flags);
-  if (rc == NULL)
-    {
-      saved_errno = errno;
-      goto fail;
-    }
-  free(fs);
-  return rc;
-  
- fail:
-  free(fs);
-  errno = saved_errno;
-  return NULL;
+  STATS_ENTER(builder_append_n, n);
+  if (libstring_builder_reserve(builder, n))
+    return -1;
+  memcpy(builder->ptr + builder->len, string, n * sizeof(char));
+  builder->len += n;
+  builder->ptr[builder->len] = '\0';
+  STATS_OUTPUT(n);
+  return 0;
+}
+
+
+/**
+ * Append a byte, repeated any number
+ * of times, to a string builder.
+ * 
+ * Example:
+ *   libstring_builder_append_char(&b, ' ', 8 - col % 8);
+ * 
+ * @param   builder  The builder.
+ * @param   c        The byte to append.
+ * @param   count    The number of times to append `c`.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+int libstring_builder_append_char(struct libstring_builder* builder, char c, size_t count)
+{
+  STATS_ENTER(builder_append_char, 0);
+  if (libstring_builder_reserve(builder, count))
+    return -1;
+  memset(builder->ptr + builder->len, c, count * sizeof(char));
+  builder->len += count;
+  builder->ptr[builder->len] = '\0';
+  STATS_OUTPUT(count);
+  return 0;
 }
 
 
 /**
- * Retrieve a substring.
+ * Append an unsigned integer, in decimal,
+ * to a string builder.
  * 
- * @param   string  The string.
- * @param   start   The position in `string` of the
- *                  beginning of the substring.
- * @param   end     The position in `string` of the
- *                  end of the substring.
- * @param   flags   Additional options.
- * @return          The selected substring of `string`.
- *                  `NULL` on error.
+ * @param   builder  The builder.
+ * @param   value    The integer to append.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char* libstring_substring(const char* string, size_t start, size_t end, enum libstring_substring flags) /* TODO */
+int libstring_builder_append_uint(struct libstring_builder* builder, unsigned long long int value)
 {
+  STATS_ENTER(builder_append_uint, 0);
+  char buf[3 * sizeof(value)];
+  char* p = buf + sizeof(buf);
+  int r;
+  do
+    *--p = (char)('0' + value % 10);
+  while (value /= 10);
+  r = libstring_builder_append_n(builder, p, (size_t)(buf + sizeof(buf) - p));
+  STATS_OUTPUT(r == 0 ? (size_t)(buf + sizeof(buf) - p) : 0);
+  return r;
 }
 
 
 /**
- * Remove unnecessary whitespace in string.
- * 
- * Example:
- *   s = libstring_trim("  hello   world!  ", NULL, 0);
- *   # s is "hello   world!"
- *   free(s);
+ * Append a signed integer, in decimal,
+ * to a string builder.
  * 
- * @param   string   The string to manipulate.
- * @param   symbols  Symbols to remove.
- * @param   flags    Additional options.
- * @return           Trimmed version of `string`.
- *                   `NULL` on error.
+ * @param   builder  The builder.
+ * @param   value    The integer to append.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char* libstring_trim(const char* string, const char* symbols, enum libstring_trim flags) /* TODO */
+int libstring_builder_append_int(struct libstring_builder* builder, long long int value)
 {
+  STATS_ENTER(builder_append_int, 0);
+  char buf[1 + 3 * sizeof(value)];
+  char* p = buf + sizeof(buf);
+  int r;
+  unsigned long long int u = value < 0 ? -(unsigned long long int)value : (unsigned long long int)value;
+  do
+    *--p = (char)('0' + u % 10);
+  while (u /= 10);
+  if (value < 0)
+    *--p = '-';
+  r = libstring_builder_append_n(builder, p, (size_t)(buf + sizeof(buf) - p));
+  STATS_OUTPUT(r == 0 ? (size_t)(buf + sizeof(buf) - p) : 0);
+  return r;
 }
 
 
 /**
- * Reverse the order of the characters in a string.
+ * Append formatted text, in the same way as
+ * `printf` formats it, to a string builder.
  * 
  * Example:
- *   s = libstring_reverse("hello world!", 0);
- *   # s is "!dlrow olleh"
- *   free(s);
+ *   libstring_builder_append_format(&b, "%s=%.2f\n", key, value);
  * 
- * @param   string  The string to reverse.
- * @param   flags   Additional options.
- * @return          String reversed. `NULL` on error.
+ * @param   builder  The builder.
+ * @param   format   The format string.
+ * @param   ...      The values to format.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * @throws  ENOMEM     The process cannot enough memory.
+ * @throws  EOVERFLOW  The text is longer than `INT_MAX`.
  */
-char* libstring_reverse(const char* string, enum libstring_reverse flags) /* TODO */
+int libstring_builder_append_format(struct libstring_builder* builder, const char* format, ...)
 {
+  STATS_ENTER(builder_append_format, 0);
+  va_list args;
+  size_t room = builder->cap - builder->len;
+  int n;
+  
+  va_start(args, format);
+  n = vsnprintf(room ? builder->ptr + builder->len : NULL, room, format, args);
+  va_end(args);
+  
+  if ((n >= 0) && ((size_t)n >= room))
+    {
+      if (libstring_builder_reserve(builder, (size_t)n))
+	n = -1;
+      else
+	{
+	  va_start(args, format);
+	  vsnprintf(builder->ptr + builder->len, builder->cap - builder->len, format, args);
+	  va_end(args);
+	}
+    }
+  
+  if (n < 0)
+    {
+      if (builder->cap > 0)
+	builder->ptr[builder->len] = '\0';
+      return -1;
+    }
+  builder->len += (size_t)n;
+  STATS_OUTPUT((size_t)n);
+  return 0;
 }
 
 
 /**
- * Shuffle the order of the characters in a string.
- * 
- * You should have called `srand` before calling
- * this function.
+ * Append strings, with a delimiter between
+ * them, to a string builder.
  * 
- * Example:
- *   s = libstring_anagram("hello world!");
- *   # s is "oh!owerld ll", or something else.
- *   free(s);
- *   s = libstring_anagram("hello world!");
- *   # s is "olw! lordlhe", or something else.
- *   free(s);
- *   s = libstring_anagram("hello world!");
- *   # s is "hell row old!", or something else.
- *   free(s);
+ * This appends the same string as
+ * `libstring_join` returns.
  * 
- * @param   string  Anagram of the returned string.
- * @return          An anagram of `string`.
- *                  `NULL` on error.
+ * @param   builder    The builder.
+ * @param   strings    List of strings to join, must
+ *                     not be `NULL` or contain `NULL`:s.
+ * @param   n          Either a pointer the number of strings
+ *                     stored in `strings`, or `NULL` if
+ *                     `strings` is `NULL`-terminated.
+ * @param   delimiter  A string to insert between all strings.
+ * @return             0 on success, -1 on error, in which
+ *                     case `builder` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char* libstring_anagram(const char* string) /* TODO */
+int libstring_builder_append_join(struct libstring_builder* builder, const char* const* strings,
+				  const size_t* n, const char* delimiter)
 {
+  STATS_ENTER(builder_append_join, stats_bytes(strings, n == NULL ? SIZE_MAX : *n));
+  size_t i, m = (n == NULL ? SIZE_MAX : *n);
+  size_t len = builder->len, dlen = strlen(delimiter);
+  
+  for (i = 0; (i < m) && (strings[i] != NULL); i++)
+    if (((i > 0) && libstring_builder_append_n(builder, delimiter, dlen)) ||
+	libstring_builder_append_n(builder, strings[i], strlen(strings[i])))
+      {
+	builder->len = len;
+	if (builder->cap > 0)
+	  builder->ptr[len] = '\0';
+	return -1;
+      }
+  
+  STATS_OUTPUT(builder->len - len);
+  return 0;
 }
 
 
 /**
- * Replace lowercase letters with uppercase letters.
+ * Append the result of an `_into` function, that has
+ * been stored at the end of a string builder.
+ * 
+ * If the result did not fit, room is made for it, and
+ * the `_into` function must be called again.
  * 
  * Example:
- *   s = libstring_lcase("Hello World!");
- *   # s is "hello world!"
- *   free(s);
+ *   do
+ *     n = libstring_lcase_into(b.ptr + b.len, b.cap - b.len, s);
+ *   while ((r = libstring_builder_commit(&b, n)) > 0);
  * 
- * @param   string  The string to manipulate.
- * @return          Lowercase version of `string`.
- *                  `NULL` on error.
+ * @param   builder  The builder.
+ * @param   n        The return value of the `_into` function,
+ *                   called with `builder->ptr + builder->len`
+ *                   as the buffer and `builder->cap - builder->len`
+ *                   as its size.
+ * @return           0 if the result was appended, 1 if the `_into`
+ *                   function must be called again, -1 on error, in
+ *                   which case `builder` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char* libstring_lcase(const char* string)
+int libstring_builder_commit(struct libstring_builder* builder, size_t n)
 {
-  size_t n = strlen(strings);
-  char* rc = malloc((n + 1) * sizeof(char));
-  char c;
-  if (rc = NULL)
-    return NULL;
-  memcpy(rc, strings, (n + 1) * sizeof(char));
-  while (n--)
-    if (islower(rc[n]))
-      rc[n] ^= 'A' ^ 'a';
-  return rc;
+  STATS_ENTER(builder_commit, 0);
+  if (n < builder->cap - builder->len)
+    {
+      STATS_OUTPUT(n);
+      return builder->len += n, 0;
+    }
+  if (libstring_builder_reserve(builder, n))
+    {
+      if (builder->cap > 0)
+	builder->ptr[builder->len] = '\0';
+      return -1;
+    }
+  return 1;
 }
 
 
 /**
- * Replace uppercase letters with lowercase letters.
+ * Take the string from a string builder, without copying it.
  * 
- * Example:
- *   s = libstring_ucase("Hello World!");
- *   # s is "HELLO WORLD!"
- *   free(s);
+ * The builder is left empty, and can be used again.
  * 
- * @param   string  The string to manipulate.
- * @return          Uppercase version of `string`.
- *                  `NULL` on error.
+ * @param   builder  The builder.
+ * @return           The string, which shall be deallocated
+ *                   with `libstring_free`. `NULL` on error.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char* libstring_ucase(const char* string)
+char* libstring_builder_finalise(struct libstring_builder* builder)
 {
-  size_t n = strlen(strings);
-  char* rc = malloc((n + 1) * sizeof(char));
-  char c;
-  if (rc = NULL)
+  STATS_ENTER(builder_finalise, 0);
+  char* rc;
+  if ((builder->ptr == NULL) && libstring_builder_reserve(builder, 0))
     return NULL;
-  memcpy(rc, strings, (n + 1) * sizeof(char));
-  while (n--)
-    if (isupper(rc[n]))
-      rc[n] ^= 'A' ^ 'a';
+  rc = builder->ptr;
+  libstring_builder_initialise(builder);
   return rc;
 }
 
 
 /**
- * Replace the first letter with its lovercase
- * variant if it is in upper case.
+ * Deallocate the string in a string builder, and
+ * leave it empty so that it can be used again.
  * 
- * Example:
- *   s = libstring_capitalise("hello world!");
- *   # s is "Hello world!"
- *   free(s);
+ * @param  builder  The builder.
+ */
+void libstring_builder_destroy(struct libstring_builder* builder)
+{
+  deallocate(builder->ptr);
+  libstring_builder_initialise(builder);
+}
+
+
+/**
+ * Deallocate the results of a batch transform.
  * 
- * @param   string  The string to manipulate.
- * @return          Capitalised version of `string`.
- *                  `NULL` on error.
+ * @param  batch  The results.
+ */
+void libstring_batch_destroy(struct libstring_batch* batch)
+{
+  deallocate(batch->data);
+  deallocate(batch->offsets);
+  batch->data = NULL;
+  batch->offsets = NULL;
+  batch->n = 0;
+}
+
+
+
+/**
+ * Header of a chunk in a memory arena.
+ */
+struct arena_chunk
+{
+  /**
+   * The previously created chunk.
+   */
+  struct arena_chunk* next;
+  
+  /**
+   * The size of the chunk, excluding the header.
+   */
+  size_t size;
+};
+
+
+/**
+ * Union whose size is the alignment
+ * of allocations in a memory arena.
+ */
+union arena_align
+{
+  long double a;
+  long long int b;
+  void* c;
+  void (*d)(void);
+};
+
+
+/**
+ * The alignment of allocations in a memory arena.
+ */
+#define ARENA_ALIGN  (sizeof(union arena_align))
+
+/**
+ * Round up a size to a multiple of `ARENA_ALIGN`.
+ */
+#define ARENA_ROUND(n)  (((n) + (ARENA_ALIGN - 1)) & ~(ARENA_ALIGN - 1))
+
+/**
+ * The size of a chunk header, with padding.
+ */
+#define ARENA_HEADER_SIZE  ARENA_ROUND(sizeof(struct arena_chunk))
+
+/**
+ * The default chunk size for memory arenas.
+ */
+#define ARENA_DEFAULT_CHUNK_SIZE  ((size_t)64 << 10)
+
+
+/**
+ * Allocate memory in a memory arena.
+ * 
+ * @param   size  The number of bytes to allocate.
+ * @param   data  The arena.
+ * @return        The allocated memory, `NULL` on error.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char* libstring_capitalise(const char* string)
+static void* arena_allocate(size_t size, void* data)
 {
-  size_t n = strlen(strings);
-  char* rc = malloc((n + 1) * sizeof(char));
-  char c;
-  if (rc = NULL)
+  struct libstring_arena* arena = data;
+  struct arena_chunk* head = arena->chunks;
+  struct arena_chunk* chunk;
+  size_t chunk_size;
+  char* rc;
+  
+  if (size > SIZE_MAX - ARENA_HEADER_SIZE - ARENA_ALIGN)
+    return errno = ENOMEM, NULL;
+  size = ARENA_ROUND(size ? size : 1);
+  
+  if ((size_t)(arena->end - arena->top) >= size)
+    {
+      rc = arena->top;
+      arena->top += size;
+      return rc;
+    }
+  
+  chunk_size = size > arena->chunk_size ? size : arena->chunk_size;
+  chunk = malloc(ARENA_HEADER_SIZE + chunk_size);
+  if (chunk == NULL)
     return NULL;
-  memcpy(rc, strings, (n + 1) * sizeof(char));
-  if (islower(*rc))
-    *rc ^= 'A' ^ 'a';
+  chunk->size = chunk_size;
+  rc = (char*)chunk + ARENA_HEADER_SIZE;
+  
+  /* Large allocations get their own chunk, so the current chunk is not wasted. */
+  if ((head != NULL) && (size > arena->chunk_size / 2))
+    {
+      chunk->next = head->next;
+      head->next = chunk;
+      return rc;
+    }
+  
+  chunk->next = head;
+  arena->chunks = chunk;
+  arena->top = rc + size;
+  arena->end = rc + chunk_size;
   return rc;
 }
 
 
 /**
- * Replace lowercase letters with uppercase letters,
- * and uppercase letters with lowercase letters.
- * 
- * Example:
- *   s = libstring_swapcase("Hello World!");
- *   # s is "hELLO wORLD!"
- *   free(s);
+ * Change the size of an allocation in a memory arena.
  * 
- * @param   string  The string to manipulate.
- * @return          `string` with swapped cased for
- *                  all letters. `NULL` on error.
+ * @param   ptr       The allocation.
+ * @param   old_size  The size `ptr` was allocated with.
+ * @param   size      The new size of the allocation.
+ * @param   data      The arena.
+ * @return            The new allocation, `NULL` on error.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-char* libstring_swapcase(const char* string)
+static void* arena_reallocate(void* ptr, size_t old_size, size_t size, void* data)
 {
-  size_t n = strlen(strings);
-  char* rc = malloc((n + 1) * sizeof(char));
-  char c;
-  if (rc = NULL)
-    return NULL;
-  memcpy(rc, strings, (n + 1) * sizeof(char));
-  while (n--)
-    if (isalpha(rc[n]))
-      rc[n] ^= 'A' ^ 'a';
+  struct libstring_arena* arena = data;
+  char* rc;
+  
+  if (ptr == NULL)
+    return arena_allocate(size, data);
+  old_size = ARENA_ROUND(old_size ? old_size : 1);
+  
+  if ((char*)ptr + old_size == arena->top)
+    {
+      if (size <= old_size + (size_t)(arena->end - arena->top))
+	{
+	  arena->top = (char*)ptr + ARENA_ROUND(size ? size : 1);
+	  return ptr;
+	}
+    }
+  else if (size <= old_size)
+    return ptr;
+  
+  rc = arena_allocate(size, data);
+  if (rc != NULL)
+    memcpy(rc, ptr, old_size < size ? old_size : size);
   return rc;
 }
 
 
 /**
- * Replace tabs with spaces.
- * 
- * @param   string  The string to manipulate.
- * @param   flags   Additional options.
- * @return          `string` with 8 spaces substituted
- *                  tabs for tab space. `NULL` on error.
+ * Deallocate memory in a memory arena, which
+ * does nothing until the arena is reset.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * @param  ptr   The allocation, may be `NULL`.
+ * @param  data  The arena.
  */
-char* libstring_expand(const char* string, enum libstring_expand flags) /* TODO */
+static void arena_deallocate(void* ptr, void* data)
 {
+  (void) ptr;
+  (void) data;
 }
 
 
 /**
- * Replace initial spaces of groups of 8 with tabs.
+ * Initialise a memory arena.
  * 
- * @param   string  The string to manipulate.
- * @return          `string` with initial spaces of
- *                  groups of 8, replaced with tab
- *                  spaces. `NULL` on error.
+ * No memory is allocated until the arena is used.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * @param  arena       The arena.
+ * @param  chunk_size  The number of bytes to allocate at a
+ *                     time, 0 for the default value.
  */
-char* libstring_unexpand(const char* string) /* TODO */
+void libstring_arena_initialise(struct libstring_arena* arena, size_t chunk_size)
 {
+  arena->allocator.allocate = arena_allocate;
+  arena->allocator.reallocate = arena_reallocate;
+  arena->allocator.deallocate = arena_deallocate;
+  arena->allocator.data = arena;
+  arena->chunks = NULL;
+  arena->top = arena->end = NULL;
+  if (chunk_size == 0)
+    chunk_size = ARENA_DEFAULT_CHUNK_SIZE;
+  if (chunk_size > SIZE_MAX - ARENA_HEADER_SIZE - ARENA_ALIGN)
+    chunk_size = SIZE_MAX - ARENA_HEADER_SIZE - ARENA_ALIGN;
+  arena->chunk_size = ARENA_ROUND(chunk_size);
 }
 
 
 /**
- * ROT13: Offensive joke and spoiler masker.
+ * Deallocate everything that has been allocated in
+ * a memory arena, but keep the memory of the most
+ * recently used chunk for reuse.
  * 
- * Example:
- *   s = libstring_rot13("An offensive joke");
- *   # s is "Na bssrafvir wbxr"
- *   z = libstring_rot13(s);
- *   # z is "An offensive joke"
- *   free(s), free(z);
+ * @param  arena  The arena.
+ */
+void libstring_arena_reset(struct libstring_arena* arena)
+{
+  struct arena_chunk* head = arena->chunks;
+  struct arena_chunk* chunk;
+  
+  if (head == NULL)
+    return;
+  
+  while ((chunk = head->next) != NULL)
+    {
+      head->next = chunk->next;
+      free(chunk);
+    }
+  
+  arena->top = (char*)head + ARENA_HEADER_SIZE;
+  arena->end = arena->top + head->size;
+}
+
+
+/**
+ * Release all memory of a memory arena.
  * 
- * @param   string  The string to manipulate.
- * @return          `string` with all ASCII letters
- *                  substituted for the corresponding
- *                  letter in the alphabet whose position
- *                  is offset from that letter by 13.
- *                  `NULL` on error.
+ * The arena can be used again without
+ * being reinitialised.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * @param  arena  The arena.
  */
-char* libstring_rot13(const char* string)
+void libstring_arena_destroy(struct libstring_arena* arena)
 {
-  size_t n = strlen(strings);
-  char* rc = malloc((n + 1) * sizeof(char));
-  char c;
-  if (rc = NULL)
-    return NULL;
-  memcpy(rc, strings, (n + 1) * sizeof(char));
-  while (n--)
-    if (isalpha(rc[n]))
-      {
-	c = rc[n] & 0x1F;
-	c = ((c + 12) % 26) + 1;
-	c |= rc[n] & ~0x1F;
-	rc[n] = c;
-      }
-  return rc;
+  struct arena_chunk* chunk;
+  
+  while ((chunk = arena->chunks) != NULL)
+    {
+      arena->chunks = chunk->next;
+      free(chunk);
+    }
+  
+  arena->top = arena->end = NULL;
 }
 
 
 /**
- * Double ROT13: terrorist-grade encryption.
- * 
- * Example:
- *   s = libstring_rot13("Secret message");
- *   # s is "Secret message"
- *   free(s);
+ * Get the performance counters of the functions.
  * 
- * @param   string  The string to copy.
- * @return          A copy of `string`. `NULL` on error.
+ * The counters are only kept if the library was built
+ * with `LIBSTRING_STATS` defined. They cover all threads,
+ * including those that have exited, and count from the
+ * last call to `libstring_stats_reset`. A call that one
+ * function makes to another is not counted, and its
+ * allocations are counted for the calling function.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * @param   buf  Output buffer, may be `NULL` if `n` is 0.
+ * @param   n    The number of elements in `buf`.
+ * @return       The number of counted functions, 0 if
+ *               the library was built without
+ *               `LIBSTRING_STATS`. Only the first
+ *               `n` are stored in `buf`.
  */
-char* libstring_double_rot13(const char* string)
+size_t libstring_stats_snapshot(struct libstring_stats* buf, size_t n)
 {
-  size_t n = strlen(strings);
-  char* rc = malloc((n + 1) * sizeof(char));
-  if (rc != NULL)
-    memcpy(rc, strings, (n + 1) * sizeof(char));
-  return rc;
+#ifdef LIBSTRING_STATS
+  struct stats_block* block;
+  size_t i;
+  
+  if (n > STATS_FUNCTIONS)
+    n = STATS_FUNCTIONS;
+  for (i = 0; i < n; i++)
+    {
+      memset(buf + i, 0, sizeof(*buf));
+      buf[i].function = stats_names[i];
+    }
+  
+  pthread_mutex_lock(&stats_mutex);
+  for (block = stats_blocks; block != NULL; block = block->next)
+    for (i = 0; i < n; i++)
+      {
+	buf[i].calls               += stats_count(block, i, COUNTER_CALLS);
+	buf[i].input_bytes         += stats_count(block, i, COUNTER_INPUT_BYTES);
+	buf[i].output_bytes        += stats_count(block, i, COUNTER_OUTPUT_BYTES);
+	buf[i].allocations         += stats_count(block, i, COUNTER_ALLOCATIONS);
+	buf[i].allocation_failures += stats_count(block, i, COUNTER_ALLOCATION_FAILURES);
+      }
+  pthread_mutex_unlock(&stats_mutex);
+  
+  return STATS_FUNCTIONS;
+#else
+  (void) buf;
+  (void) n;
+  return 0;
+#endif
 }
 
+
+/**
+ * Start counting from zero again in the counters
+ * returned by `libstring_stats_snapshot`.
+ * 
+ * Calls that are made at the same time by other
+ * threads may be counted either before or after
+ * the reset.
+ */
+void libstring_stats_reset(void)
+{
+#ifdef LIBSTRING_STATS
+  struct stats_block* block;
+  size_t i, j;
+  
+  pthread_mutex_lock(&stats_mutex);
+  for (block = stats_blocks; block != NULL; block = block->next)
+    for (i = 0; i < STATS_FUNCTIONS; i++)
+      for (j = 0; j < STATS_COUNTERS; j++)
+	block->base[i][j] = __atomic_load_n(&block->counts[i][j], __ATOMIC_RELAXED);
+  pthread_mutex_unlock(&stats_mutex);
+#endif
+}
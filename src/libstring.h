@@ -26,10 +26,19 @@
 # define LIBSTRING_GCC_ONLY(...)  __VA_ARGS__
 # define LIBSTRING_COMMON         __malloc__, __warn_unused_result__, __nonnull__
 # define LIBSTRING_LEAF           __leaf__, LIBSTRING_COMMON
+# define LIBSTRING_INTO           __leaf__, __nonnull__
 #else
 # define LIBSTRING_GCC_ONLY(...)  /* ignore */
 #endif
 
+/**
+ * Expands to an array of the arguments, as strings,
+ * and a pointer to the number of arguments.
+ */
+#define LIBSTRING_ARGS(...)\
+  (const char* const[]){__VA_ARGS__},\
+  &(const size_t){sizeof((const char* const[]){__VA_ARGS__}) / sizeof(const char*)}
+
 
 
 /**
@@ -44,12 +53,44 @@ enum libstring_split
   LIBSTRING_SPLIT_FROM_RIGHT = 1,
   
   /**
-   * Ignore case when matching.
+   * Ignore case when matching, in the same
+   * way as `LIBSTRING_PATTERN_IGNORE_CASE`.
    */
   LIBSTRING_SPLIT_IGNORE_CASE = 2,
 };
 
 
+/**
+ * Return values for `libstring_split_iter_next`.
+ */
+enum libstring_split_iter_status
+{
+  /**
+   * There are no more fields.
+   */
+  LIBSTRING_SPLIT_ITER_END = 0,
+  
+  /**
+   * A field, or the last part of
+   * a field, was returned.
+   */
+  LIBSTRING_SPLIT_ITER_FIELD = 1,
+  
+  /**
+   * A part of a field was returned,
+   * the field continues in the next
+   * return.
+   */
+  LIBSTRING_SPLIT_ITER_PARTIAL = 2,
+  
+  /**
+   * Nothing was returned, the next
+   * chunk of the input must be fed.
+   */
+  LIBSTRING_SPLIT_ITER_MORE = 3,
+};
+
+
 /**
  * Flags for `libstring_replace`.
  */
@@ -62,7 +103,8 @@ enum libstring_replace
   LIBSTRING_REPLACE_FROM_RIGHT = 1,
   
   /**
-   * Ignore case when matching.
+   * Ignore case when matching, in the same
+   * way as `LIBSTRING_PATTERN_IGNORE_CASE`.
    */
   LIBSTRING_REPLACE_IGNORE_CASE = 2,
 };
@@ -149,7 +191,8 @@ enum libstring_cut
   LIBSTRING_CUT_FROM_RIGHT = 1,
   
   /**
-   * Ignore case when matching.
+   * Ignore case when matching, in the same
+   * way as `LIBSTRING_PATTERN_IGNORE_CASE`.
    */
   LIBSTRING_CUT_IGNORE_CASE = 2,
   
@@ -177,6 +220,23 @@ enum libstring_cut
 };
 
 
+/**
+ * Flags for `libstring_pattern_init`.
+ */
+enum libstring_pattern_init
+{
+  /**
+   * Ignore case when matching.
+   * 
+   * Characters match if they have the same simple case
+   * folding, but only case variants encoded with as many
+   * bytes as the character in the substring match. So,
+   * for example, "k" matches "K" but not the Kelvin sign.
+   */
+  LIBSTRING_PATTERN_IGNORE_CASE = 1,
+};
+
+
 /**
  * Flags for `libstring_substring`.
  */
@@ -238,11 +298,34 @@ enum libstring_reverse
   /**
    * Treat combining diacritical marks
    * as part of the letters it is on.
+   * 
+   * This reverses the order of the extended
+   * grapheme clusters, as specified in UAX #29,
+   * so emoji sequences, flags and CR LF are
+   * also kept intact.
    */
   LIBSTRING_REVERSE_KEEP_COMBINING = 1,
 };
 
 
+/**
+ * Flags for `libstring_anagram`.
+ */
+enum libstring_anagram
+{
+  /**
+   * Treat combining diacritical marks
+   * as part of the letters it is on.
+   * 
+   * This shuffles the extended grapheme
+   * clusters, as specified in UAX #29,
+   * so emoji sequences, flags and CR LF
+   * are also kept intact.
+   */
+  LIBSTRING_ANAGRAM_KEEP_COMBINING = 1,
+};
+
+
 enum libstring_expand
 {
   /**
@@ -280,515 +363,3197 @@ enum libstring_expand
 
 
 /**
- * Concatenate strings.
- * 
- * Example:
- *   const char* strings[] = {"alpha", "bet", "s", NULL};
- *   s = libstring_cat(strings, NULL);
- *   # s is "alphabets"
- *   free(s);
- * 
- * Example:
- *   const char* strings[] = {"alpha", "bet", "s"};
- *   size_t n = 3;
- *   s = libstring_cat(strings, &n);
- *   # s is "alphabets"
- *   free(s);
- * 
- * @param   strings  List of strings to concatenate, must
- *                   not be `NULL` or contain `NULL`:s.
- * @param   n        Either a pointer the number of strings
- *                   stored in `strings`, or `NULL` if
- *                   `strings` is `NULL`-terminated.
- * @return           A string with all strings in `strings`
- *                   concatenated in order, without any
- *                   delimiter. `NULL` on error.
+ * A substring to search for, prepared
+ * by `libstring_pattern_init` so that it
+ * can be used for any number of searches.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * All members are private.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1))))
-char* libstring_cat(const char* const*, const size_t*);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strmulcat  libstring_cat
-#endif
+struct libstring_pattern
+{
+  /**
+   * The substring.
+   */
+  const char* pattern;
+  
+  /**
+   * The length of `pattern`.
+   */
+  size_t length;
+  
+  /**
+   * Whether to ignore case when matching.
+   */
+  int ignore_case;
+  
+  /**
+   * Whether case is ignored and the substring has a
+   * non-ASCII character with other case variants.
+   */
+  int unicode;
+  
+  /**
+   * The bits that differ between the case variants
+   * of the first byte of the substring.
+   */
+  unsigned char first_fold;
+  
+  /**
+   * The bits that differ between the case variants
+   * of the last byte of the substring.
+   */
+  unsigned char last_fold;
+  
+  /**
+   * How far a search from left to right can
+   * advance, by the last byte in the text
+   * the substring was compared against.
+   */
+  unsigned char skip[256];
+  
+  /**
+   * How far a search from right to left can
+   * go back, by the first byte in the text
+   * the substring was compared against.
+   */
+  unsigned char skip_right[256];
+};
 
 
 /**
- * Concatenate strings.
- * 
- * Example:
- *   s = libstring_vcat("alpha", "bet", "s", NULL);
- *   # s is "alphabets"
- *   free(s);
- * 
- * @param   strings...  List of strings to concatenate, end
- *                      with a `NULL`.
- * @return              A string with all strings in `strings`
- *                      concatenated in order, without any
- *                      delimiter. `NULL` on error.
- * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * The position and length of a substring.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_COMMON, __sentinel__(0))))
-char* libstring_vcat(const char*, ... /*, (char*)0 */);
-#ifdef LIBSTRING_SHORT_NAMES
-# define vstrmulcat  libstring_vcat
-#endif
+struct libstring_span
+{
+  /**
+   * The position of the substring,
+   * in bytes.
+   */
+  size_t offset;
+  
+  /**
+   * The length of the substring,
+   * in bytes.
+   */
+  size_t length;
+};
 
 
 /**
- * Concatenate strings and insert a delimiter between the strings.
- * 
- * Example:
- *   const char* strings[] = {"alpha", "bet", "s", NULL};
- *   s = libstring_join(strings, NULL, "--");
- *   # s is "alpha--bet--s"
- *   free(s);
+ * Iterator over the fields of a string split at
+ * each occurrence of a selected delimiter.
  * 
- * Example:
- *   const char* strings[] = {"alpha", "bet", "s"};
- *   size_t n = 3;
- *   s = libstring_join(strings, &n, "--");
- *   # s is "alpha--bet--s"
- *   free(s);
- * 
- * @param   strings    List of strings to join, must
- *                     not be `NULL` or contain `NULL`:s.
- * @param   n          Either a pointer the number of strings
- *                     stored in `strings`, or `NULL` if
- *                     `strings` is `NULL`-terminated.
- * @param   delimiter  A string to insert between all strings.
- * @return             A string with all strings in `strings`
- *                     concatenated in order, with the
- *                     delimiter `delimiter`. `NULL` on error.
+ * The memory use is independent of the length
+ * of the input and of the fields, and the input
+ * can be fed in chunks.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * All members are private.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1, 3))))
-char* libstring_join(const char* const*, const size_t*, const char*);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strjoin  libstring_join
-#endif
+struct libstring_split_iter
+{
+  /**
+   * The delimiter.
+   */
+  const char* delimiter;
+  
+  /**
+   * The length of `delimiter`.
+   */
+  size_t delimiter_length;
+  
+  /**
+   * Additional options.
+   */
+  enum libstring_split flags;
+  
+  /**
+   * The delimiter, prepared for searching.
+   */
+  struct libstring_pattern pattern;
+  
+  /**
+   * The current chunk of the input.
+   */
+  const char* chunk;
+  
+  /**
+   * The length of `chunk`.
+   */
+  size_t chunk_length;
+  
+  /**
+   * The beginning, or with `LIBSTRING_SPLIT_FROM_RIGHT`
+   * the end, of the unread part of `chunk`.
+   */
+  size_t position;
+  
+  /**
+   * Whether `chunk` is the last chunk.
+   */
+  int last;
+  
+  /**
+   * Whether all fields have been returned.
+   */
+  int done;
+  
+  /**
+   * Held back input that may be a part
+   * of a delimiter that straddles two chunks.
+   */
+  char* carry;
+  
+  /**
+   * The length of `carry`.
+   */
+  size_t carry_length;
+  
+  /**
+   * Storage for `carry`.
+   */
+  char* carry_buffer;
+};
 
 
 /**
- * Concatenate strings and insert a delimiter between the strings.
- * 
- * Example:
- *   s = libstring_vjoin("alpha", "bet", "s", NULL, "--");
- *   # s is "alpha--bet--s"
- *   free(s);
- * 
- * @param   strings...  List of strings to concatenate, end
- *                      with a `NULL`.
- * @param   delimiter   A string to insert between all strings.
- * @return              A string with all strings in `strings`
- *                      concatenated in order, with the
- *                      delimiter `delimiter`. `NULL` on error.
+ * A set of substrings to replace, and their
+ * replacements, compiled into an automaton
+ * that finds all of them in one pass.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * All members are private.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_COMMON, __sentinel__(1))))
-char* libstring_vjoin(const char*, ... /*, (char*)0, const char* */);
-#ifdef LIBSTRING_SHORT_NAMES
-# define vstrjoin  libstring_vjoin
-#endif
+struct libstring_replacer
+{
+  /**
+   * Additional options.
+   */
+  enum libstring_replace flags;
+  
+  /**
+   * The number of substrings.
+   */
+  size_t n;
+  
+  /**
+   * The number of byte classes.
+   */
+  size_t classes;
+  
+  /**
+   * The class of each byte value. Bytes that
+   * do not occur in any substring are in class 0.
+   */
+  unsigned char class_of[256];
+  
+  /**
+   * The state the automaton enters, by
+   * state and class of the next byte.
+   */
+  size_t* transitions;
+  
+  /**
+   * The number of bytes matched
+   * in each state.
+   */
+  size_t* depth;
+  
+  /**
+   * The index of the longest substring that
+   * ends in each state, `SIZE_MAX` if none.
+   */
+  size_t* match;
+  
+  /**
+   * The length of each substring.
+   */
+  size_t* from_length;
+  
+  /**
+   * The length of each replacement.
+   */
+  size_t* to_length;
+  
+  /**
+   * The position of each replacement
+   * in `to_bytes`.
+   */
+  size_t* to_offset;
+  
+  /**
+   * The replacements.
+   */
+  char* to_bytes;
+};
 
 
 /**
- * Split a string at each occurrence of a selected delimiter.
+ * Memory allocator used for all memory
+ * allocated by the library.
  * 
- * @param   string     String to split.
- * @param   delimiter  The delimiter.
- * @param   n          Output parameter for the number of
- *                     strings in the returned list. May be `NULL`.
- * @param   flags      Additional options.
- * @return             `NULL`-terminated list of the substrings in
- *                     `string` which had `delimiter` between them.
- *                     `NULL` on error.
- * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * The functions shall set `errno` and
+ * return `NULL` on failure, just like
+ * `malloc` and `realloc` does.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1, 2))))
-char** libstring_split(const char*, const char*, size_t*, enum libstring_split);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strsplit  libstring_split
-#endif
-
+struct libstring_allocator
+{
+  /**
+   * Allocate memory.
+   * 
+   * @param   size  The number of bytes to allocate.
+   * @param   data  `.data` of this structure.
+   * @return        The allocated memory, `NULL` on error.
+   */
+  void* (*allocate)(size_t, void*);
+  
+  /**
+   * Change the size of an allocation.
+   * 
+   * @param   ptr       The allocation.
+   * @param   old_size  The size `ptr` was allocated with.
+   * @param   size      The new size of the allocation.
+   * @param   data      `.data` of this structure.
+   * @return            The new allocation, `NULL` on error,
+   *                    in which case `ptr` is still valid.
+   */
+  void* (*reallocate)(void*, size_t, size_t, void*);
+  
+  /**
+   * Deallocate memory.
+   * 
+   * @param  ptr   The allocation, may be `NULL`.
+   * @param  data  `.data` of this structure.
+   */
+  void (*deallocate)(void*, void*);
+  
+  /**
+   * User-defined data passed
+   * to the functions.
+   */
+  void* data;
+};
+
+
+/**
+ * Bump-pointer memory arena.
+ * 
+ * Use `libstring_arena_initialise` to initialise it,
+ * and `&arena.allocator` to use it as an allocator.
+ * Deallocating memory in the arena does nothing,
+ * use `libstring_arena_reset` to deallocate everything
+ * at once. Do not use an arena in multiple threads
+ * at the same time.
+ * 
+ * All members are private, except `allocator`.
+ */
+struct libstring_arena
+{
+  /**
+   * Allocator that allocates in the arena.
+   */
+  struct libstring_allocator allocator;
+  
+  /**
+   * The most recently created chunk.
+   */
+  void* chunks;
+  
+  /**
+   * The first unused byte in the current chunk.
+   */
+  char* top;
+  
+  /**
+   * The end of the current chunk.
+   */
+  char* end;
+  
+  /**
+   * The size of new chunks, excluding
+   * their headers.
+   */
+  size_t chunk_size;
+};
+
+
+/**
+ * A string that carries its length
+ * and the size of its allocation.
+ * 
+ * Zero-initialise it before it is first used, and
+ * release it with `libstring_str_destroy`. The `_str`
+ * functions store their results in it, and reuse its
+ * allocation when the result fits, so a string can
+ * be passed through any number of calls without
+ * measuring it again. `ptr` is allocated with the
+ * allocator selected in the calling thread.
+ */
+struct libstring_str
+{
+  /**
+   * The string. It may contain NUL bytes, and
+   * it is NUL-terminated unless `cap` is 0.
+   */
+  char* ptr;
+  
+  /**
+   * The length of the string, excluding
+   * the terminating NUL byte.
+   */
+  size_t len;
+  
+  /**
+   * The allocation size of `ptr`.
+   */
+  size_t cap;
+};
+
+
+/**
+ * Growable string, for building a string from pieces.
+ * 
+ * Initialise it with `libstring_builder_initialise`,
+ * and either take the string with `libstring_builder_finalise`
+ * or release it with `libstring_builder_destroy`. The
+ * allocation grows geometrically, so appending takes
+ * amortised constant time per byte. It is made with the
+ * allocator selected in the calling thread.
+ * 
+ * The members may be read but not modified. The result of
+ * an `_into` function can be appended by storing it at
+ * `ptr + len`, with the size `cap - len`, and passing its
+ * length to `libstring_builder_commit`.
+ */
+struct libstring_builder
+{
+  /**
+   * The string built so far, NUL-terminated
+   * unless `cap` is 0.
+   */
+  char* ptr;
+  
+  /**
+   * The length of the string, excluding
+   * the terminating NUL byte.
+   */
+  size_t len;
+  
+  /**
+   * The allocation size of `ptr`.
+   */
+  size_t cap;
+};
+
+
+/**
+ * The results of a batch transform, such as
+ * `libstring_lcase_batch`, packed into one allocation.
+ * 
+ * Result `i` starts at `data + offsets[i]`, is NUL-terminated,
+ * and is `offsets[i + 1] - offsets[i] - 1` bytes long.
+ * Release it with `libstring_batch_destroy`. It is made with
+ * the allocator selected in the calling thread.
+ */
+struct libstring_batch
+{
+  /**
+   * The results, one after another.
+   */
+  char* data;
+  
+  /**
+   * The offsets of the results in `data`, followed
+   * by the total size of `data`. `n + 1` entries.
+   */
+  size_t* offsets;
+  
+  /**
+   * The number of results.
+   */
+  size_t n;
+};
+
+
+/**
+ * Performance counters of a function,
+ * see `libstring_stats_snapshot`.
+ */
+struct libstring_stats
+{
+  /**
+   * The name of the function.
+   */
+  const char* function;
+  
+  /**
+   * The number of calls.
+   */
+  unsigned long long int calls;
+  
+  /**
+   * The number of bytes of text passed
+   * to the function for processing.
+   */
+  unsigned long long int input_bytes;
+  
+  /**
+   * The number of bytes of text the function
+   * has written or allocated, excluding
+   * terminating NUL bytes.
+   */
+  unsigned long long int output_bytes;
+  
+  /**
+   * The number of allocations and reallocations
+   * the function has made, including failed ones.
+   */
+  unsigned long long int allocations;
+  
+  /**
+   * The number of allocations and
+   * reallocations that have failed.
+   */
+  unsigned long long int allocation_failures;
+};
+
+
+
+/**
+ * Concatenate strings.
+ * 
+ * Example:
+ *   const char* strings[] = {"alpha", "bet", "s", NULL};
+ *   s = libstring_cat(strings, NULL);
+ *   # s is "alphabets"
+ *   free(s);
+ * 
+ * Example:
+ *   const char* strings[] = {"alpha", "bet", "s"};
+ *   size_t n = 3;
+ *   s = libstring_cat(strings, &n);
+ *   # s is "alphabets"
+ *   free(s);
+ * 
+ * @param   strings  List of strings to concatenate, must
+ *                   not be `NULL` or contain `NULL`:s.
+ * @param   n        Either a pointer the number of strings
+ *                   stored in `strings`, or `NULL` if
+ *                   `strings` is `NULL`-terminated.
+ * @return           A string with all strings in `strings`
+ *                   concatenated in order, without any
+ *                   delimiter. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1))))
+char* libstring_cat(const char* const*, const size_t*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strmulcat  libstring_cat
+#endif
+
+
+/**
+ * Concatenate strings, using multiple threads.
+ * 
+ * This is the same as `libstring_cat`, except the strings
+ * are measured and copied by multiple threads, each
+ * handling a contiguous slice of them. Only one thread
+ * is used if there are few strings, as starting threads
+ * would then take longer than the work itself.
+ * 
+ * @param   strings  List of strings to concatenate, must
+ *                   not be `NULL` or contain `NULL`:s.
+ * @param   n        Either a pointer the number of strings
+ *                   stored in `strings`, or `NULL` if
+ *                   `strings` is `NULL`-terminated.
+ * @param   threads  The greatest number of threads to use, 0
+ *                   for the number of online processors.
+ * @return           A string with all strings in `strings`
+ *                   concatenated in order, without any
+ *                   delimiter. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1))))
+char* libstring_cat_parallel(const char* const*, const size_t*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strmulcat_parallel  libstring_cat_parallel
+#endif
+
+
+/**
+ * Concatenate strings into a caller-provided buffer.
+ * 
+ * This is the same as `libstring_cat`, except the result
+ * is stored in `buf` and truncated, in the same way as
+ * `snprintf` does, if it does not fit.
+ * 
+ * Example:
+ *   const char* strings[] = {"alpha", "bet", "s", NULL};
+ *   n = libstring_cat_into(NULL, 0, strings, NULL);
+ *   # n is 9
+ *   libstring_cat_into(buf, n + 1, strings, NULL);
+ *   # buf is "alphabets"
+ * 
+ * @param   buf      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size     The allocation size of `buf`.
+ * @param   strings  List of strings to concatenate, must
+ *                   not be `NULL` or contain `NULL`:s.
+ * @param   n        Either a pointer the number of strings
+ *                   stored in `strings`, or `NULL` if
+ *                   `strings` is `NULL`-terminated.
+ * @return           The length of the result, excluding the
+ *                   terminating NUL byte. The result was
+ *                   truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_cat_into(char*, size_t, const char* const*, const size_t*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strmulcat_into  libstring_cat_into
+#endif
+
+
+/**
+ * Concatenate strings of given lengths.
+ * 
+ * This is the same as `libstring_cat`, except the
+ * strings have given lengths, so they may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out      Output string, its allocation is reused
+ *                   if the result fits in it. Must not
+ *                   overlap any of `strings`.
+ * @param   strings  The strings to concatenate, only
+ *                   `.ptr` and `.len` are used.
+ * @param   n        The number of strings in `strings`.
+ * @return           0 on success, -1 on error, in which
+ *                   case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_cat_str(struct libstring_str*, const struct libstring_str*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strmulcat_str  libstring_cat_str
+#endif
+
+
+/**
+ * Concatenate strings.
+ * 
+ * Example:
+ *   s = libstring_vcat("alpha", "bet", "s", NULL);
+ *   # s is "alphabets"
+ *   free(s);
+ * 
+ * @param   strings...  List of strings to concatenate, end
+ *                      with a `NULL`.
+ * @return              A string with all strings in `strings`
+ *                      concatenated in order, without any
+ *                      delimiter. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__malloc__, __warn_unused_result__, __sentinel__(0))))
+char* libstring_vcat(const char*, ... /*, (char*)0 */);
+#ifdef LIBSTRING_SHORT_NAMES
+# define vstrmulcat  libstring_vcat
+#endif
+
+
+/**
+ * Concatenate strings into a caller-provided buffer.
+ * 
+ * This is the same as `libstring_vcat`, except the result
+ * is stored in `buf` and truncated, in the same way as
+ * `snprintf` does, if it does not fit.
+ * 
+ * @param   buf         Output buffer, may be `NULL` if `size` is 0.
+ * @param   size        The allocation size of `buf`.
+ * @param   strings...  List of strings to concatenate, end
+ *                      with a `NULL`.
+ * @return              The length of the result, excluding the
+ *                      terminating NUL byte. The result was
+ *                      truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __sentinel__(0))))
+size_t libstring_vcat_into(char*, size_t, const char*, ... /*, (char*)0 */);
+#ifdef LIBSTRING_SHORT_NAMES
+# define vstrmulcat_into  libstring_vcat_into
+#endif
+
+
+/**
+ * Concatenate strings, given as arguments.
+ * 
+ * This is the same as `libstring_vcat`, except no `NULL`
+ * is needed at the end, at least one string must be given,
+ * and the strings are collected into an array at compile
+ * time, so they are not read through a `va_list`.
+ * 
+ * Example:
+ *   s = libstring_cat_args("alpha", "bet", "s");
+ *   # s is "alphabets"
+ *   free(s);
+ * 
+ * @param   ...  List of strings to concatenate, must
+ *               not be `NULL` or contain `NULL`:s.
+ * @return       A string with all strings concatenated in
+ *               order, without any delimiter. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+#define libstring_cat_args(...)\
+  libstring_cat(LIBSTRING_ARGS(__VA_ARGS__))
+#ifdef LIBSTRING_SHORT_NAMES
+# define strmulcat_args  libstring_cat_args
+#endif
+
+
+/**
+ * Concatenate strings, given as arguments,
+ * into a caller-provided buffer.
+ * 
+ * This is the same as `libstring_cat_args`, except the
+ * result is stored in `buf` and truncated, in the same
+ * way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf   Output buffer, may be `NULL` if `size` is 0.
+ * @param   size  The allocation size of `buf`.
+ * @param   ...   List of strings to concatenate, must
+ *                not be `NULL` or contain `NULL`:s.
+ * @return        The length of the result, excluding the
+ *                terminating NUL byte. The result was
+ *                truncated if this is not less than `size`.
+ */
+#define libstring_cat_args_into(buf, size, ...)\
+  libstring_cat_into(buf, size, LIBSTRING_ARGS(__VA_ARGS__))
+#ifdef LIBSTRING_SHORT_NAMES
+# define strmulcat_args_into  libstring_cat_args_into
+#endif
+
+
+/**
+ * Concatenate strings and insert a delimiter between the strings.
+ * 
+ * Example:
+ *   const char* strings[] = {"alpha", "bet", "s", NULL};
+ *   s = libstring_join(strings, NULL, "--");
+ *   # s is "alpha--bet--s"
+ *   free(s);
+ * 
+ * Example:
+ *   const char* strings[] = {"alpha", "bet", "s"};
+ *   size_t n = 3;
+ *   s = libstring_join(strings, &n, "--");
+ *   # s is "alpha--bet--s"
+ *   free(s);
+ * 
+ * @param   strings    List of strings to join, must
+ *                     not be `NULL` or contain `NULL`:s.
+ * @param   n          Either a pointer the number of strings
+ *                     stored in `strings`, or `NULL` if
+ *                     `strings` is `NULL`-terminated.
+ * @param   delimiter  A string to insert between all strings.
+ * @return             A string with all strings in `strings`
+ *                     concatenated in order, with the
+ *                     delimiter `delimiter`. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1, 3))))
+char* libstring_join(const char* const*, const size_t*, const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strjoin  libstring_join
+#endif
+
+
+/**
+ * Concatenate strings and insert a delimiter between
+ * the strings, using multiple threads.
+ * 
+ * This is the same as `libstring_join`, except the strings
+ * are measured and copied by multiple threads, each
+ * handling a contiguous slice of them. Only one thread
+ * is used if there are few strings, as starting threads
+ * would then take longer than the work itself.
+ * 
+ * Example:
+ *   s = libstring_join_parallel(rows, &n, "\n", 0);
+ * 
+ * @param   strings    List of strings to join, must
+ *                     not be `NULL` or contain `NULL`:s.
+ * @param   n          Either a pointer the number of strings
+ *                     stored in `strings`, or `NULL` if
+ *                     `strings` is `NULL`-terminated.
+ * @param   delimiter  A string to insert between all strings.
+ * @param   threads    The greatest number of threads to use, 0
+ *                     for the number of online processors.
+ * @return             A string with all strings in `strings`
+ *                     concatenated in order, with the
+ *                     delimiter `delimiter`. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1, 3))))
+char* libstring_join_parallel(const char* const*, const size_t*, const char*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strjoin_parallel  libstring_join_parallel
+#endif
+
+
+/**
+ * Concatenate strings and insert a delimiter between the
+ * strings, into a caller-provided buffer.
+ * 
+ * This is the same as `libstring_join`, except the result
+ * is stored in `buf` and truncated, in the same way as
+ * `snprintf` does, if it does not fit.
+ * 
+ * @param   buf        Output buffer, may be `NULL` if `size` is 0.
+ * @param   size       The allocation size of `buf`.
+ * @param   strings    List of strings to join, must
+ *                     not be `NULL` or contain `NULL`:s.
+ * @param   n          Either a pointer the number of strings
+ *                     stored in `strings`, or `NULL` if
+ *                     `strings` is `NULL`-terminated.
+ * @param   delimiter  A string to insert between all strings.
+ * @return             The length of the result, excluding the
+ *                     terminating NUL byte. The result was
+ *                     truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3, 5))))
+size_t libstring_join_into(char*, size_t, const char* const*, const size_t*, const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strjoin_into  libstring_join_into
+#endif
+
+
+/**
+ * Concatenate strings of given lengths and
+ * insert a delimiter between the strings.
+ * 
+ * This is the same as `libstring_join`, except the
+ * strings and the delimiter have given lengths, so they
+ * may contain NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out        Output string, its allocation is reused
+ *                     if the result fits in it. Must not overlap
+ *                     any of `strings` or `delimiter`.
+ * @param   strings    The strings to join, only
+ *                     `.ptr` and `.len` are used.
+ * @param   n          The number of strings in `strings`.
+ * @param   delimiter  A string to insert between all strings.
+ * @param   dlen       The length of `delimiter`.
+ * @return             0 on success, -1 on error, in which
+ *                     case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_join_str(struct libstring_str*, const struct libstring_str*, size_t, const char*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strjoin_str  libstring_join_str
+#endif
+
+
+/**
+ * Concatenate strings and insert a delimiter between the strings.
+ * 
+ * Example:
+ *   s = libstring_vjoin("alpha", "bet", "s", NULL, "--");
+ *   # s is "alpha--bet--s"
+ *   free(s);
+ * 
+ * @param   strings...  List of strings to concatenate, end
+ *                      with a `NULL`.
+ * @param   delimiter   A string to insert between all strings.
+ * @return              A string with all strings in `strings`
+ *                      concatenated in order, with the
+ *                      delimiter `delimiter`. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__malloc__, __warn_unused_result__, __sentinel__(1))))
+char* libstring_vjoin(const char*, ... /*, (char*)0, const char* */);
+#ifdef LIBSTRING_SHORT_NAMES
+# define vstrjoin  libstring_vjoin
+#endif
+
+
+/**
+ * Concatenate strings and insert a delimiter between the
+ * strings, into a caller-provided buffer.
+ * 
+ * This is the same as `libstring_vjoin`, except the result
+ * is stored in `buf` and truncated, in the same way as
+ * `snprintf` does, if it does not fit.
+ * 
+ * @param   buf         Output buffer, may be `NULL` if `size` is 0.
+ * @param   size        The allocation size of `buf`.
+ * @param   strings...  List of strings to concatenate, end
+ *                      with a `NULL`.
+ * @param   delimiter   A string to insert between all strings.
+ * @return              The length of the result, excluding the
+ *                      terminating NUL byte. The result was
+ *                      truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __sentinel__(1))))
+size_t libstring_vjoin_into(char*, size_t, const char*, ... /*, (char*)0, const char* */);
+#ifdef LIBSTRING_SHORT_NAMES
+# define vstrjoin_into  libstring_vjoin_into
+#endif
+
+
+/**
+ * Concatenate strings, given as arguments, and
+ * insert a delimiter between the strings.
+ * 
+ * This is the same as `libstring_vjoin`, except the
+ * delimiter comes first, no `NULL` is needed after the
+ * strings, at least one string must be given, and the
+ * strings are collected into an array at compile time,
+ * so they are not read through a `va_list`.
+ * 
+ * Example:
+ *   s = libstring_join_args("--", "alpha", "bet", "s");
+ *   # s is "alpha--bet--s"
+ *   free(s);
+ * 
+ * @param   delimiter  A string to insert between all strings.
+ * @param   ...        List of strings to join, must
+ *                     not be `NULL` or contain `NULL`:s.
+ * @return             A string with all strings concatenated
+ *                     in order, with the delimiter `delimiter`.
+ *                     `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+#define libstring_join_args(delimiter, ...)\
+  libstring_join(LIBSTRING_ARGS(__VA_ARGS__), delimiter)
+#ifdef LIBSTRING_SHORT_NAMES
+# define strjoin_args  libstring_join_args
+#endif
+
+
+/**
+ * Concatenate strings, given as arguments, and insert a
+ * delimiter between the strings, into a caller-provided buffer.
+ * 
+ * This is the same as `libstring_join_args`, except the
+ * result is stored in `buf` and truncated, in the same
+ * way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf        Output buffer, may be `NULL` if `size` is 0.
+ * @param   size       The allocation size of `buf`.
+ * @param   delimiter  A string to insert between all strings.
+ * @param   ...        List of strings to join, must
+ *                     not be `NULL` or contain `NULL`:s.
+ * @return             The length of the result, excluding the
+ *                     terminating NUL byte. The result was
+ *                     truncated if this is not less than `size`.
+ */
+#define libstring_join_args_into(buf, size, delimiter, ...)\
+  libstring_join_into(buf, size, LIBSTRING_ARGS(__VA_ARGS__), delimiter)
+#ifdef LIBSTRING_SHORT_NAMES
+# define strjoin_args_into  libstring_join_args_into
+#endif
+
+
+/**
+ * Prepare a substring to search for, so that it can be
+ * used for any number of searches with the `_p` functions.
+ * 
+ * Nothing is allocated, so there is nothing to release.
+ * 
+ * @param  pattern  The prepared substring.
+ * @param  string   The substring, must remain valid
+ *                  while `pattern` is used.
+ * @param  flags    Additional options.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+void libstring_pattern_init(struct libstring_pattern*, const char*, enum libstring_pattern_init);
+
+
+/**
+ * Prepare a substring of a given length to search for.
+ * 
+ * This is the same as `libstring_pattern_init`, except
+ * `string` has a given length, so it may contain NUL bytes.
+ * 
+ * @param  pattern  The prepared substring.
+ * @param  string   The substring, must remain valid
+ *                  while `pattern` is used.
+ * @param  n        The length of `string`.
+ * @param  flags    Additional options.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+void libstring_pattern_init_n(struct libstring_pattern*, const char*, size_t, enum libstring_pattern_init);
+
+
+/**
+ * Split a string at each occurrence of a selected delimiter.
+ * 
+ * The list and all strings in it are stored in
+ * a single allocation, only the list shall be freed.
+ * 
+ * Example:
+ *   fields = libstring_split("a,b,,c", ",", &n, 0);
+ *   # fields is {"a", "b", "", "c", NULL}, n is 4
+ *   free(fields);
+ * 
+ * @param   string     String to split.
+ * @param   delimiter  The delimiter.
+ * @param   n          Output parameter for the number of
+ *                     strings in the returned list. May be `NULL`.
+ * @param   flags      Additional options.
+ * @return             `NULL`-terminated list of the substrings in
+ *                     `string` which had `delimiter` between them.
+ *                     `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1, 2))))
+char** libstring_split(const char*, const char*, size_t*, enum libstring_split);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strsplit  libstring_split
+#endif
+
+
+/**
+ * Split a string at each occurrence of a prepared delimiter.
+ * 
+ * This is the same as `libstring_split`, except the
+ * delimiter is prepared with `libstring_pattern_init`,
+ * which also selects whether case is ignored, so
+ * `LIBSTRING_SPLIT_IGNORE_CASE` is not used.
+ * 
+ * @param   string     String to split.
+ * @param   delimiter  The delimiter.
+ * @param   n          Output parameter for the number of
+ *                     strings in the returned list. May be `NULL`.
+ * @param   flags      Additional options.
+ * @return             `NULL`-terminated list of the substrings in
+ *                     `string` which had `delimiter` between them.
+ *                     `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1, 2))))
+char** libstring_split_p(const char*, const struct libstring_pattern*, size_t*, enum libstring_split);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strsplit_p  libstring_split_p
+#endif
+
+
+/**
+ * Split a string at each occurrence of a selected delimiter,
+ * without copying the fields.
+ * 
+ * Example:
+ *   spans = libstring_split_spans("a,bc,,d", ",", &n, 0);
+ *   # spans is {{0, 1}, {2, 2}, {5, 0}, {6, 1}}, n is 4
+ *   free(spans);
+ * 
+ * @param   string     String to split.
+ * @param   delimiter  The delimiter.
+ * @param   n          Output parameter for the number of
+ *                     elements in the returned list. May be `NULL`.
+ * @param   flags      Additional options.
+ * @return             List of the positions and lengths in `string`
+ *                     of the substrings which had `delimiter` between
+ *                     them. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1, 2))))
+struct libstring_span* libstring_split_spans(const char*, const char*, size_t*, enum libstring_split);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strsplitspans  libstring_split_spans
+#endif
+
+
+/**
+ * Split a string at each occurrence of a selected delimiter,
+ * without copying the fields, and store the positions of
+ * the fields in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_split_spans`, except
+ * the result is stored in `spans`, and truncated if it
+ * does not fit.
+ * 
+ * @param   spans      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size       The number of elements `spans` can hold.
+ * @param   string     String to split.
+ * @param   delimiter  The delimiter.
+ * @param   flags      Additional options.
+ * @return             The number of fields. The result was
+ *                     truncated if this is greater than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3, 4))))
+size_t libstring_split_spans_into(struct libstring_span*, size_t, const char*, const char*, enum libstring_split);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strsplitspans_into  libstring_split_spans_into
+#endif
+
+
+/**
+ * Split a string at each occurrence of a prepared delimiter,
+ * without copying the fields, and store the positions of
+ * the fields in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_split_spans_into`, except
+ * the delimiter is prepared with `libstring_pattern_init`,
+ * which also selects whether case is ignored, so
+ * `LIBSTRING_SPLIT_IGNORE_CASE` is not used.
+ * 
+ * @param   spans      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size       The number of elements `spans` can hold.
+ * @param   string     String to split.
+ * @param   delimiter  The delimiter.
+ * @param   flags      Additional options.
+ * @return             The number of fields. The result was
+ *                     truncated if this is greater than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3, 4))))
+size_t libstring_split_spans_p_into(struct libstring_span*, size_t, const char*,
+				    const struct libstring_pattern*, enum libstring_split);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strsplitspans_p_into  libstring_split_spans_p_into
+#endif
+
+
+/**
+ * Split a string of a given length at each occurrence
+ * of a prepared delimiter, without copying the fields,
+ * and store the positions of the fields in a
+ * caller-provided buffer.
+ * 
+ * This is the same as `libstring_split_spans_p_into`,
+ * except `string` has a given length, so it may
+ * contain NUL bytes.
+ * 
+ * @param   spans      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size       The number of elements `spans` can hold.
+ * @param   string     String to split.
+ * @param   n          The length of `string`.
+ * @param   delimiter  The delimiter.
+ * @param   flags      Additional options.
+ * @return             The number of fields. The result was
+ *                     truncated if this is greater than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(5))))
+size_t libstring_split_spans_n_into(struct libstring_span*, size_t, const char*, size_t,
+				    const struct libstring_pattern*, enum libstring_split);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strsplitspans_n_into  libstring_split_spans_n_into
+#endif
+
+
+/**
+ * Initialise an iterator over the fields of a string
+ * split at each occurrence of a selected delimiter.
+ * 
+ * With `LIBSTRING_SPLIT_FROM_RIGHT`, the fields are
+ * returned from the last to the first, and the input
+ * must be fed from its end to its beginning.
+ * 
+ * Example:
+ *   libstring_split_iter_init(&it, "a,b,,c", ",", 0);
+ *   while (libstring_split_iter_next(&it, &f, &n) == LIBSTRING_SPLIT_ITER_FIELD)
+ *     # f is "a", "b", "" and "c", n is the length of f
+ *   libstring_split_iter_destroy(&it);
+ * 
+ * @param  it         The iterator.
+ * @param  string     The string to split, `NULL` if the input
+ *                    will be fed with `libstring_split_iter_feed`.
+ * @param  delimiter  The delimiter, must remain valid until
+ *                    the iterator is destroyed.
+ * @param  flags      Additional options.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1, 3))))
+void libstring_split_iter_init(struct libstring_split_iter*, const char*, const char*, enum libstring_split);
+
+
+/**
+ * Initialise an iterator over the fields of a string
+ * split at each occurrence of a prepared delimiter.
+ * 
+ * This is the same as `libstring_split_iter_init`,
+ * except the delimiter is prepared with
+ * `libstring_pattern_init`, which also selects
+ * whether case is ignored, so
+ * `LIBSTRING_SPLIT_IGNORE_CASE` is not used.
+ * 
+ * @param  it         The iterator.
+ * @param  string     The string to split, `NULL` if the input
+ *                    will be fed with `libstring_split_iter_feed`.
+ * @param  delimiter  The delimiter, its substring must remain
+ *                    valid until the iterator is destroyed.
+ * @param  flags      Additional options.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1, 3))))
+void libstring_split_iter_init_p(struct libstring_split_iter*, const char*,
+				 const struct libstring_pattern*, enum libstring_split);
+
+
+/**
+ * Feed the next chunk of input to a split iterator.
+ * 
+ * This shall be done once, at the beginning, or
+ * when `libstring_split_iter_next` has returned
+ * `LIBSTRING_SPLIT_ITER_MORE`.
+ * 
+ * Example:
+ *   libstring_split_iter_init(&it, NULL, "\r\n", 0);
+ *   while ((n = read(fd, buf, sizeof(buf))) > 0)
+ *     {
+ *       libstring_split_iter_feed(&it, buf, n, 0);
+ *       while ((r = libstring_split_iter_next(&it, &f, &n)) != LIBSTRING_SPLIT_ITER_MORE)
+ *         # f is a line if r is LIBSTRING_SPLIT_ITER_FIELD,
+ *         # and a part of a line if r is LIBSTRING_SPLIT_ITER_PARTIAL
+ *     }
+ *   libstring_split_iter_feed(&it, "", 0, 1);
+ *   # get the rest of the fields
+ * 
+ * @param   it      The iterator.
+ * @param   chunk   The chunk, must remain valid until
+ *                  `libstring_split_iter_next` returns
+ *                  `LIBSTRING_SPLIT_ITER_MORE` again.
+ * @param   length  The length of `chunk`.
+ * @param   last    Whether this is the last chunk.
+ * @return          0 on success, -1 on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+int libstring_split_iter_feed(struct libstring_split_iter*, const char*, size_t, int);
+
+
+/**
+ * Get the next field, or part of a field, from a split iterator.
+ * 
+ * The returned text is not NUL-terminated, and is only
+ * valid until the next call to this function.
+ * 
+ * @param   it      The iterator.
+ * @param   field   Output parameter for the field.
+ * @param   length  Output parameter for the length of the field.
+ * @return          `LIBSTRING_SPLIT_ITER_FIELD` if the end of a field
+ *                  was found, `LIBSTRING_SPLIT_ITER_PARTIAL` if only a
+ *                  part of a field was found, `LIBSTRING_SPLIT_ITER_MORE`
+ *                  if the next chunk must be fed, or
+ *                  `LIBSTRING_SPLIT_ITER_END` if there are no more fields.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+enum libstring_split_iter_status libstring_split_iter_next(struct libstring_split_iter*, const char**, size_t*);
+
+
+/**
+ * Release the resources of a split iterator.
+ * 
+ * This may be done before the last field
+ * has been returned.
+ * 
+ * @param  it  The iterator.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+void libstring_split_iter_destroy(struct libstring_split_iter*);
+
+
+/**
+ * Replace a substrings in a string.
+ * 
+ * @param   string  The string to manipulate.
+ * @param   from    Substring to replace.
+ * @param   to      String to substitute for `from`.
+ * @param   flags   Additional options.
+ * @return          `string` with `to` substituted for `from`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
+char* libstring_replace(const char*, const char*, const char*, enum libstring_replace);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strreplace  libstring_replace
+#endif
+
+
+/**
+ * Replace a substrings in a string, and store the
+ * result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_replace`, except the
+ * result is stored in `buf` and truncated, in the same
+ * way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @param   from    Substring to replace.
+ * @param   to      String to substitute for `from`.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3, 4, 5))))
+size_t libstring_replace_into(char*, size_t, const char*, const char*, const char*, enum libstring_replace);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strreplace_into  libstring_replace_into
+#endif
+
+
+/**
+ * Replace a prepared substring in a string.
+ * 
+ * This is the same as `libstring_replace`, except
+ * `from` is prepared with `libstring_pattern_init`,
+ * which also selects whether case is ignored, so
+ * `LIBSTRING_REPLACE_IGNORE_CASE` is not used.
+ * 
+ * @param   string  The string to manipulate.
+ * @param   from    Substring to replace.
+ * @param   to      String to substitute for `from`.
+ * @param   flags   Additional options.
+ * @return          `string` with `to` substituted for `from`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
+char* libstring_replace_p(const char*, const struct libstring_pattern*, const char*, enum libstring_replace);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strreplace_p  libstring_replace_p
+#endif
+
+
+/**
+ * Replace a prepared substring in a string, and store
+ * the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_replace_p`, except the
+ * result is stored in `buf` and truncated, in the same
+ * way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @param   from    Substring to replace.
+ * @param   to      String to substitute for `from`.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3, 4, 5))))
+size_t libstring_replace_p_into(char*, size_t, const char*, const struct libstring_pattern*,
+				const char*, enum libstring_replace);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strreplace_p_into  libstring_replace_p_into
+#endif
+
+
+/**
+ * Replace a prepared substring in a string of a given
+ * length, and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_replace_p`, except
+ * `string` and `to` have given lengths, so they may
+ * contain NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string` or `to`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @param   from    Substring to replace.
+ * @param   to      String to substitute for `from`.
+ * @param   tn      The length of `to`.
+ * @param   flags   Additional options.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1, 4))))
+int libstring_replace_str(struct libstring_str*, const char*, size_t, const struct libstring_pattern*,
+			  const char*, size_t, enum libstring_replace);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strreplace_str  libstring_replace_str
+#endif
+
+
+/**
+ * Replace a prepared substring in each string in an array.
+ * 
+ * This is the same as `libstring_replace_p`, applied to each string
+ * in an array, except the results are packed into one
+ * allocation, with their offsets in another.
+ * 
+ * @param   out      Output parameter for the results.
+ * @param   strings  The strings to manipulate.
+ * @param   n        The number of strings in `strings`.
+ * @param   from     Substring to replace.
+ * @param   to       String to substitute for `from`.
+ * @param   flags    Additional options.
+ * @return           0 on success, -1 on error, in
+ *                   which case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1, 4, 5))))
+int libstring_replace_batch(struct libstring_batch*, const char* const*, size_t,
+			    const struct libstring_pattern*, const char*, enum libstring_replace);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strreplace_batch  libstring_replace_batch
+#endif
+
+
+/**
+ * Compile a set of substrings to replace,
+ * for `libstring_replace_many`.
+ * 
+ * Empty substrings are never matched. If a substring
+ * occurs more than once, the first occurrence is used.
+ * With `LIBSTRING_REPLACE_IGNORE_CASE`, every combination
+ * of the case variants of the non-ASCII characters in a
+ * substring is added to the automaton, so its size grows
+ * with the number of such combinations.
+ * 
+ * @param   replacer  The replacer to initialise.
+ * @param   from      Substrings to replace.
+ * @param   to        Strings to substitute for the
+ *                    corresponding strings in `from`.
+ * @param   n         The number of elements in `from` and `to`.
+ * @param   flags     Additional options.
+ * @return            0 on success, -1 on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__warn_unused_result__, __leaf__, __nonnull__(1))))
+int libstring_replacer_initialise(struct libstring_replacer*, const char* const*,
+				  const char* const*, size_t, enum libstring_replace);
+
+
+/**
+ * Release all memory of a replacer.
+ * 
+ * @param  replacer  The replacer.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+void libstring_replacer_destroy(struct libstring_replacer*);
+
+
+/**
+ * Replace multiple substrings in a string in one pass.
+ * 
+ * The string is scanned from left to right, or from
+ * right to left with `LIBSTRING_REPLACE_FROM_RIGHT`,
+ * and at each position the longest substring is
+ * replaced. Replacements are not rescanned.
+ * 
+ * @param   string    The string to manipulate.
+ * @param   replacer  The substrings and their replacements.
+ * @return            `string` with the replacements substituted
+ *                    for the substrings. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
+char* libstring_replace_many(const char*, const struct libstring_replacer*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strreplacemany  libstring_replace_many
+#endif
+
+
+/**
+ * Replace multiple substrings in a string in one pass,
+ * and store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_replace_many`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf       Output buffer, may be `NULL` if `size` is 0.
+ * @param   size      The allocation size of `buf`.
+ * @param   string    The string to manipulate.
+ * @param   replacer  The substrings and their replacements.
+ * @return            The length of the result, excluding the
+ *                    terminating NUL byte. The result was
+ *                    truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3, 4))))
+size_t libstring_replace_many_into(char*, size_t, const char*, const struct libstring_replacer*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strreplacemany_into  libstring_replace_many_into
+#endif
+
+
+/**
+ * Replace multiple substrings in a string of a given
+ * length in one pass, and store the result in a
+ * `struct libstring_str`.
+ * 
+ * This is the same as `libstring_replace_many`, except
+ * `string` has a given length, so it may contain NUL
+ * bytes, and the result is stored in `out`.
+ * 
+ * @param   out       Output string, its allocation is reused
+ *                    if the result fits in it. Must not
+ *                    overlap `string`.
+ * @param   string    The string to manipulate.
+ * @param   n         The length of `string`.
+ * @param   replacer  The substrings and their replacements.
+ * @return            0 on success, -1 on error, in which
+ *                    case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1, 4))))
+int libstring_replace_many_str(struct libstring_str*, const char*, size_t, const struct libstring_replacer*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strreplacemany_str  libstring_replace_many_str
+#endif
+
+
+/**
+ * `r = libstring_shellsafe(s)` is equivalent to
+ * `t = libstring_replace(s, "'", "'\''", 0);
+ *  if (t && (r = malloc(strlen(t) + 3)))
+ *    *r = '\'', strcpy(stpcpy(r + 1, t), "'");
+ *  saved_errno = errno, free(t), errno = saved_errno;
+ *  r;`.
+ * You guess what it does, and why.
+ * 
+ * @param   string  The string to manipulate.
+ * @return          The result. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
+char* libstring_shellsafe(const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strshsafe  libstring_shellsafe
+#endif
+
+
+/**
+ * Quote a string for the shell, and store the
+ * result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_shellsafe`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_shellsafe_into(char*, size_t, const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strshsafe_into  libstring_shellsafe_into
+#endif
+
+
+/**
+ * Quote a string of a given length for the shell,
+ * and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_shellsafe`, except
+ * `string` has a given length, so it may contain NUL
+ * bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_shellsafe_str(struct libstring_str*, const char*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strshsafe_str  libstring_shellsafe_str
+#endif
+
+
+/**
+ * Measure the length of a string.
+ * 
+ * @param   string  The string to measure.
+ * @param   flags   Additional options.
+ * @return          The length of `string`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__warn_unused_result__, __nonnull__, __leaf__)))
+size_t libstring_length(const char*, enum libstring_length);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strdisplen  libstring_length
+#endif
+
+
+/**
+ * Measure the length of a string of a given length.
+ * 
+ * This is the same as `libstring_length`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, which are counted as characters.
+ * 
+ * @param   string  The string to measure.
+ * @param   n       The length of `string`, in bytes.
+ * @param   flags   Additional options.
+ * @return          The length of `string`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__warn_unused_result__, __leaf__)))
+size_t libstring_length_n(const char*, size_t, enum libstring_length);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strdisplen_n  libstring_length_n
+#endif
+
+
+/**
+ * Validate teh encoding of a string.
+ * 
+ * @param   string  The string to validate.
+ * @param   flags   Additional options.
+ * @return          0 if the string is valid, -1 otherwise.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__warn_unused_result__, __nonnull__, __leaf__)))
+int libstring_utf8verify(const char*, enum libstring_utf8verify);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strverify  libstring_utf8verify
+#endif
+
+
+/**
+ * Validate the encoding of a string of a given length.
+ * 
+ * This is the same as `libstring_utf8verify`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, which are valid characters.
+ * 
+ * @param   string  The string to validate.
+ * @param   n       The length of `string`.
+ * @param   flags   Additional options.
+ * @return          0 if the string is valid, -1 otherwise.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__warn_unused_result__, __leaf__)))
+int libstring_utf8verify_n(const char*, size_t, enum libstring_utf8verify);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strverify_n  libstring_utf8verify_n
+#endif
+
+
+/**
+ * Split a string at each occurrence of a selected delimiter,
+ * but retain only select fields.
+ * 
+ * The list and all strings in it are stored in
+ * a single allocation, only the list shall be freed.
+ * 
+ * @param   string     The string to cut.
+ * @param   delimiter  The delimiter.
+ * @param   fields     List of fields to return.
+ * @param   fields_n   The number of elements in `fields`.
+ * @param   n          Output parameter for the number of
+ *                     returned fields. May be `NULL`.
+ * @param   flags      Additional options.
+ * @return             `NULL`-terminated list of the
+ *                     found fields. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1, 2, 3))))
+char** libstring_cut(const char*, const char*, const size_t*, size_t, size_t*, enum libstring_cut);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strcut  libstring_cut
+#endif
+
+
+/**
+ * Split a string at each occurrence of a prepared delimiter,
+ * but retain only select fields.
+ * 
+ * This is the same as `libstring_cut`, except the
+ * delimiter is prepared with `libstring_pattern_init`,
+ * which also selects whether case is ignored, so
+ * `LIBSTRING_CUT_IGNORE_CASE` is not used.
+ * 
+ * @param   string     The string to cut.
+ * @param   delimiter  The delimiter.
+ * @param   fields     List of fields to return.
+ * @param   fields_n   The number of elements in `fields`.
+ * @param   n          Output parameter for the number of
+ *                     returned fields. May be `NULL`.
+ * @param   flags      Additional options.
+ * @return             `NULL`-terminated list of the
+ *                     found fields. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1, 2, 3))))
+char** libstring_cut_p(const char*, const struct libstring_pattern*, const size_t*,
+		       size_t, size_t*, enum libstring_cut);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strcut_p  libstring_cut_p
+#endif
+
+
+/**
+ * Split a string at each occurrence of a selected delimiter,
+ * but retain only select fields, without copying the fields,
+ * and store the positions of the fields in a caller-provided
+ * buffer.
+ * 
+ * This is the same as `libstring_cut`, except the fields
+ * are returned as positions in `string`, in the order
+ * `libstring_cut` would return them. Memory is still
+ * allocated for the selection, but not for the result.
+ * 
+ * @param   spans      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size       The number of elements `spans` can hold.
+ * @param   string     The string to cut.
+ * @param   delimiter  The delimiter.
+ * @param   fields     List of fields to return.
+ * @param   fields_n   The number of elements in `fields`.
+ * @param   flags      Additional options.
+ * @return             The number of fields. The result was
+ *                     truncated if this is greater than `size`.
+ *                     `SIZE_MAX` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3, 4, 5))))
+size_t libstring_cut_spans_into(struct libstring_span*, size_t, const char*, const char*,
+				const size_t*, size_t, enum libstring_cut);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strcutspans_into  libstring_cut_spans_into
+#endif
+
+
+/**
+ * Split a string at each occurrence of a prepared delimiter,
+ * but retain only select fields, without copying the fields,
+ * and store the positions of the fields in a caller-provided
+ * buffer.
+ * 
+ * This is the same as `libstring_cut_spans_into`, except
+ * the delimiter is prepared with `libstring_pattern_init`,
+ * which also selects whether case is ignored, so
+ * `LIBSTRING_CUT_IGNORE_CASE` is not used.
+ * 
+ * @param   spans      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size       The number of elements `spans` can hold.
+ * @param   string     The string to cut.
+ * @param   delimiter  The delimiter.
+ * @param   fields     List of fields to return.
+ * @param   fields_n   The number of elements in `fields`.
+ * @param   flags      Additional options.
+ * @return             The number of fields. The result was
+ *                     truncated if this is greater than `size`.
+ *                     `SIZE_MAX` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3, 4, 5))))
+size_t libstring_cut_spans_p_into(struct libstring_span*, size_t, const char*,
+				  const struct libstring_pattern*, const size_t*, size_t,
+				  enum libstring_cut);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strcutspans_p_into  libstring_cut_spans_p_into
+#endif
+
+
+/**
+ * Split a string at each occurrence of a selected delimiter,
+ * but retain only select fields.
+ * 
+ * @param   string     The string to cut.
+ * @param   delimiter  The delimiter.
+ * @param   fields...  List of fields to return.
+ *                     End with `SIZE_MAX`.
+ * @param   n          Output parameter for the number of
+ *                     returned fields. May be `NULL`.
+ * @param   flags      Additional options.
+ * @return             `NULL`-terminated list of the
+ *                     found fields. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_COMMON(1, 2))))
+char** libstring_vcut(const char*, const char*, size_t, ... /*, SIZE_MAX, size_t*, enum libstring_cut */);
+#ifdef LIBSTRING_SHORT_NAMES
+# define vstrcut  libstring_vcut
+#endif
+
+
+/**
+ * Retrieve a substring.
+ * 
+ * @param   string  The string.
+ * @param   start   The position in `string` of the
+ *                  beginning of the substring.
+ * @param   end     The position in `string` of the
+ *                  end of the substring.
+ * @param   flags   Additional options.
+ * @return          The selected substring of `string`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
+char* libstring_substring(const char*, size_t, size_t, enum libstring_substring);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strsub  libstring_substring
+#endif
+
+
+/**
+ * Retrieve a substring, and store it in
+ * a caller-provided buffer.
+ * 
+ * This is the same as `libstring_substring`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string.
+ * @param   start   The position in `string` of the
+ *                  beginning of the substring.
+ * @param   end     The position in `string` of the
+ *                  end of the substring.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_substring_into(char*, size_t, const char*, size_t, size_t, enum libstring_substring);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strsub_into  libstring_substring_into
+#endif
+
+
+/**
+ * Retrieve a substring of a string of a given length,
+ * and store it in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_substring`, except
+ * `string` has a given length, so it may contain NUL
+ * bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string.
+ * @param   n       The length of `string`.
+ * @param   start   The position in `string` of the
+ *                  beginning of the substring.
+ * @param   end     The position in `string` of the
+ *                  end of the substring.
+ * @param   flags   Additional options.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_substring_str(struct libstring_str*, const char*, size_t, size_t, size_t, enum libstring_substring);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strsub_str  libstring_substring_str
+#endif
+
+
+/**
+ * Remove unnecessary whitespace in string.
+ * 
+ * Example:
+ *   s = libstring_trim("  hello   world!  ", NULL, 0);
+ *   # s is "hello   world!"
+ *   free(s);
+ * 
+ * @param   string   The string to manipulate.
+ * @param   symbols  Symbols to remove.
+ * @param   flags    Additional options.
+ * @return           Trimmed version of `string`.
+ *                   `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1))))
+char* libstring_trim(const char*, const char*, enum libstring_trim);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strtrim  libstring_trim
+#endif
+
+
+/**
+ * Remove unnecessary whitespace in string, and store
+ * the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_trim`, except the
+ * result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf      Output buffer, may be `NULL` if `size` is 0.
+ * @param   size     The allocation size of `buf`.
+ * @param   string   The string to manipulate.
+ * @param   symbols  Symbols to remove.
+ * @param   flags    Additional options.
+ * @return           The length of the result, excluding the
+ *                   terminating NUL byte. The result was
+ *                   truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_trim_into(char*, size_t, const char*, const char*, enum libstring_trim);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strtrim_into  libstring_trim_into
+#endif
+
+
+/**
+ * Remove unnecessary whitespace in a string of a given
+ * length, and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_trim`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out      Output string, its allocation is reused
+ *                   if the result fits in it. Must not
+ *                   overlap `string`.
+ * @param   string   The string to manipulate.
+ * @param   n        The length of `string`.
+ * @param   symbols  Symbols to remove.
+ * @param   flags    Additional options.
+ * @return           0 on success, -1 on error, in which
+ *                   case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_trim_str(struct libstring_str*, const char*, size_t, const char*, enum libstring_trim);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strtrim_str  libstring_trim_str
+#endif
+
+
+/**
+ * Remove unnecessary whitespace in each string in an array.
+ * 
+ * This is the same as `libstring_trim`, applied to each string
+ * in an array, except the results are packed into one
+ * allocation, with their offsets in another.
+ * 
+ * @param   out      Output parameter for the results.
+ * @param   strings  The strings to manipulate.
+ * @param   n        The number of strings in `strings`.
+ * @param   symbols  Symbols to remove.
+ * @param   flags    Additional options.
+ * @return           0 on success, -1 on error, in
+ *                   which case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_trim_batch(struct libstring_batch*, const char* const*, size_t, const char*, enum libstring_trim);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strtrim_batch  libstring_trim_batch
+#endif
+
+
+/**
+ * Reverse the order of the characters in a string.
+ * 
+ * The bytes of each UTF-8 character are kept in order.
+ * 
+ * Example:
+ *   s = libstring_reverse("hello world!", 0);
+ *   # s is "!dlrow olleh"
+ *   free(s);
+ * 
+ * @param   string  The string to reverse.
+ * @param   flags   Additional options.
+ * @return          String reversed. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
+char* libstring_reverse(const char*, enum libstring_reverse);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strrev  libstring_reverse
+#endif
+
+
+/**
+ * Reverse the order of the characters in a string,
+ * and store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_reverse`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to reverse.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_reverse_into(char*, size_t, const char*, enum libstring_reverse);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strrev_into  libstring_reverse_into
+#endif
+
+
+/**
+ * Reverse the order of the characters in a string of a
+ * given length, and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_reverse`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to reverse.
+ * @param   n       The length of `string`.
+ * @param   flags   Additional options.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_reverse_str(struct libstring_str*, const char*, size_t, enum libstring_reverse);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strrev_str  libstring_reverse_str
+#endif
+
+
+/**
+ * Shuffle the order of the characters in a string.
+ * 
+ * The characters are shuffled with a pseudorandom number
+ * generator whose state is kept by the caller, so the same
+ * seed always gives the same anagram, and threads do not
+ * share a generator.
+ * 
+ * Example:
+ *   unsigned long long int seed = 1;
+ *   s = libstring_anagram("hello world!", &seed, 0);
+ *   # s is "wl!hodleol r", whenever seed was 1.
+ *   free(s);
+ *   s = libstring_anagram("hello world!", &seed, 0);
+ *   # s is " weoldh!rllo", whenever seed was 1 before the first call.
+ *   free(s);
+ *   s = libstring_anagram("hello world!", NULL, 0);
+ *   # s is "hell row old!", or something else.
+ *   free(s);
+ * 
+ * @param   string  Anagram of the returned string.
+ * @param   state   The state of the pseudorandom number generator,
+ *                  any value can be used as a seed. It is updated
+ *                  so that the next call gives another anagram.
+ *                  `NULL` to use a generator private to the thread,
+ *                  which is seeded when it is first used.
+ * @param   flags   Additional options.
+ * @return          An anagram of `string`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1))))
+char* libstring_anagram(const char*, unsigned long long int*, enum libstring_anagram);
+#ifdef LIBSTRING_SHORT_NAMES
+# define stranagram  libstring_anagram
+#endif
+
+
+/**
+ * Shuffle the order of the characters in a string,
+ * and store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_anagram`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit. A
+ * truncated result is the beginning of an anagram of
+ * `string`, but if each character, or cluster, is one
+ * byte long, not necessarily of the anagram that a large
+ * enough buffer would have got. `state` is not updated
+ * if `size` is 0.
+ * 
+ * If each character, or cluster, is one byte long, the
+ * string is shuffled in place in `buf`, otherwise memory
+ * is allocated for the positions of the characters.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  Anagram of the returned string.
+ * @param   state   The state of the pseudorandom number
+ *                  generator, see `libstring_anagram`.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ *                  `SIZE_MAX` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_anagram_into(char*, size_t, const char*, unsigned long long int*, enum libstring_anagram);
+#ifdef LIBSTRING_SHORT_NAMES
+# define stranagram_into  libstring_anagram_into
+#endif
+
+
+/**
+ * Shuffle the order of the characters in a string of a
+ * given length, and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_anagram`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  Anagram of the returned string.
+ * @param   n       The length of `string`.
+ * @param   state   The state of the pseudorandom number
+ *                  generator, see `libstring_anagram`.
+ * @param   flags   Additional options.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_anagram_str(struct libstring_str*, const char*, size_t, unsigned long long int*, enum libstring_anagram);
+#ifdef LIBSTRING_SHORT_NAMES
+# define stranagram_str  libstring_anagram_str
+#endif
+
+
+/**
+ * Replace uppercase letters with lowercase letters.
+ * 
+ * Letters are changed with the full Unicode case
+ * mappings, so a letter can become longer or shorter,
+ * or become several letters. Mappings that depend on
+ * the language or on the surrounding letters, such
+ * as the final form of sigma, are not used.
+ * 
+ * Example:
+ *   s = libstring_lcase("Hello World!");
+ *   # s is "hello world!"
+ *   free(s);
+ * 
+ * @param   string  The string to manipulate.
+ * @return          Lowercase version of `string`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
+char* libstring_lcase(const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strlcase  libstring_lcase
+#endif
+
+
+/**
+ * Replace uppercase letters with lowercase letters,
+ * and store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_lcase`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_lcase_into(char*, size_t, const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strlcase_into  libstring_lcase_into
+#endif
+
+
+/**
+ * Replace uppercase letters with lowercase letters,
+ * modifying the string in place.
+ * 
+ * Example:
+ *   char s[] = "Hello World!";
+ *   libstring_lcase_inplace(s, NULL);
+ *   # s is "hello world!"
+ * 
+ * @param   string  The string to manipulate.
+ * @param   n       Either a pointer to the length of
+ *                  `string`, or `NULL` if `string`
+ *                  is NUL-terminated.
+ * @return          0 on success, -1 on error.
+ * 
+ * @throws  ERANGE  A character would be replaced by one
+ *                  of another length. `string` is left
+ *                  unmodified.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_lcase_inplace(char*, const size_t*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strlcase_inplace  libstring_lcase_inplace
+#endif
+
+
+/**
+ * Replace uppercase letters with lowercase letters in
+ * a string of a given length, and store the result
+ * in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_lcase`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_lcase_str(struct libstring_str*, const char*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strlcase_str  libstring_lcase_str
+#endif
+
+
+/**
+ * Replace uppercase letters with lowercase letters
+ * in each string in an array.
+ * 
+ * This is the same as `libstring_lcase`, applied to each string
+ * in an array, except the results are packed into one
+ * allocation, with their offsets in another.
+ * 
+ * @param   out      Output parameter for the results.
+ * @param   strings  The strings to manipulate.
+ * @param   n        The number of strings in `strings`.
+ * @return           0 on success, -1 on error, in
+ *                   which case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_lcase_batch(struct libstring_batch*, const char* const*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strlcase_batch  libstring_lcase_batch
+#endif
+
+
+/**
+ * Replace lowercase letters with uppercase letters.
+ * 
+ * This is done in the same way as `libstring_lcase`
+ * does the opposite, so for example "ß" becomes "SS".
+ * 
+ * Example:
+ *   s = libstring_ucase("Hello World!");
+ *   # s is "HELLO WORLD!"
+ *   free(s);
+ * 
+ * @param   string  The string to manipulate.
+ * @return          Uppercase version of `string`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
+char* libstring_ucase(const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strucase  libstring_ucase
+#endif
+
+
+/**
+ * Replace lowercase letters with uppercase letters,
+ * and store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_ucase`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_ucase_into(char*, size_t, const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strucase_into  libstring_ucase_into
+#endif
+
+
+/**
+ * Replace lowercase letters with uppercase letters,
+ * modifying the string in place.
+ * 
+ * Example:
+ *   char s[] = "Hello World!";
+ *   libstring_ucase_inplace(s, NULL);
+ *   # s is "HELLO WORLD!"
+ * 
+ * @param   string  The string to manipulate.
+ * @param   n       Either a pointer to the length of
+ *                  `string`, or `NULL` if `string`
+ *                  is NUL-terminated.
+ * @return          0 on success, -1 on error.
+ * 
+ * @throws  ERANGE  A character would be replaced by one
+ *                  of another length. `string` is left
+ *                  unmodified.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_ucase_inplace(char*, const size_t*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strucase_inplace  libstring_ucase_inplace
+#endif
+
+
+/**
+ * Replace lowercase letters with uppercase letters in
+ * a string of a given length, and store the result
+ * in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_ucase`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_ucase_str(struct libstring_str*, const char*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strucase_str  libstring_ucase_str
+#endif
+
+
+/**
+ * Replace lowercase letters with uppercase letters
+ * in each string in an array.
+ * 
+ * This is the same as `libstring_ucase`, applied to each string
+ * in an array, except the results are packed into one
+ * allocation, with their offsets in another.
+ * 
+ * @param   out      Output parameter for the results.
+ * @param   strings  The strings to manipulate.
+ * @param   n        The number of strings in `strings`.
+ * @return           0 on success, -1 on error, in
+ *                   which case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_ucase_batch(struct libstring_batch*, const char* const*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strucase_batch  libstring_ucase_batch
+#endif
+
+
+/**
+ * Replace the first letter with its title case
+ * variant, which is its upper case variant unless
+ * it is a ligature like "ǆ", which becomes "ǅ".
+ * 
+ * Example:
+ *   s = libstring_capitalise("hello world!");
+ *   # s is "Hello world!"
+ *   free(s);
+ * 
+ * @param   string  The string to manipulate.
+ * @return          Capitalised version of `string`.
+ *                  `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
+char* libstring_capitalise(const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strcap  libstring_capitalise
+#endif
+
+
+/**
+ * Capitalise a string, and store the result
+ * in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_capitalise`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_capitalise_into(char*, size_t, const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strcap_into  libstring_capitalise_into
+#endif
+
 
 /**
- * Replace a substrings in a string.
+ * Capitalise a string, modifying it in place.
+ * 
+ * Example:
+ *   char s[] = "hello world!";
+ *   libstring_capitalise_inplace(s, NULL);
+ *   # s is "Hello world!"
+ * 
+ * @param   string  The string to manipulate.
+ * @param   n       Either a pointer to the length of
+ *                  `string`, or `NULL` if `string`
+ *                  is NUL-terminated.
+ * @return          0 on success, -1 on error.
+ * 
+ * @throws  ERANGE  A character would be replaced by one
+ *                  of another length. `string` is left
+ *                  unmodified.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_capitalise_inplace(char*, const size_t*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strcap_inplace  libstring_capitalise_inplace
+#endif
+
+
+/**
+ * Capitalise a string of a given length, and
+ * store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_capitalise`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_capitalise_str(struct libstring_str*, const char*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strcap_str  libstring_capitalise_str
+#endif
+
+
+/**
+ * Replace lowercase letters with uppercase letters,
+ * and uppercase letters with lowercase letters.
+ * 
+ * Letters that have a lower case variant are changed
+ * to it, and other letters are changed to their upper
+ * case variant, in the same way as `libstring_lcase`
+ * and `libstring_ucase`.
+ * 
+ * Example:
+ *   s = libstring_swapcase("Hello World!");
+ *   # s is "hELLO wORLD!"
+ *   free(s);
+ * 
+ * @param   string  The string to manipulate.
+ * @return          `string` with swapped cased for
+ *                  all letters. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
+char* libstring_swapcase(const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strscase  libstring_swapcase
+#endif
+
+
+/**
+ * Swap the case of all letters in a string, and
+ * store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_swapcase`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_swapcase_into(char*, size_t, const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strscase_into  libstring_swapcase_into
+#endif
+
+
+/**
+ * Swap the case of all letters in a string,
+ * modifying it in place.
+ * 
+ * Example:
+ *   char s[] = "Hello World!";
+ *   libstring_swapcase_inplace(s, NULL);
+ *   # s is "hELLO wORLD!"
+ * 
+ * @param   string  The string to manipulate.
+ * @param   n       Either a pointer to the length of
+ *                  `string`, or `NULL` if `string`
+ *                  is NUL-terminated.
+ * @return          0 on success, -1 on error.
+ * 
+ * @throws  ERANGE  A character would be replaced by one
+ *                  of another length. `string` is left
+ *                  unmodified.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_swapcase_inplace(char*, const size_t*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strscase_inplace  libstring_swapcase_inplace
+#endif
+
+
+/**
+ * Replace lowercase letters with uppercase letters,
+ * and uppercase letters with lowercase letters, in
+ * a string of a given length, and store the result
+ * in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_swapcase`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_swapcase_str(struct libstring_str*, const char*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strscase_str  libstring_swapcase_str
+#endif
+
+
+/**
+ * Replace tabs with spaces.
  * 
  * @param   string  The string to manipulate.
- * @param   from    Substring to replace.
- * @param   to      String to substitute for `from`.
  * @param   flags   Additional options.
- * @return          `string` with `to` substituted for `from`.
+ * @return          `string` with 8 spaces substituted
+ *                  tabs for tab space. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
+char* libstring_expand(const char*, enum libstring_expand);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strexp  libstring_expand
+#endif
+
+
+/**
+ * Replace tabs with spaces, and store the result
+ * in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_expand`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @param   flags   Additional options.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_expand_into(char*, size_t, const char*, enum libstring_expand);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strexp_into  libstring_expand_into
+#endif
+
+
+/**
+ * Replace tabs with spaces in a string of a given length,
+ * and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_expand`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @param   flags   Additional options.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_expand_str(struct libstring_str*, const char*, size_t, enum libstring_expand);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strexp_str  libstring_expand_str
+#endif
+
+
+/**
+ * Replace initial spaces of groups of 8 with tabs.
+ * 
+ * @param   string  The string to manipulate.
+ * @return          `string` with initial spaces of
+ *                  groups of 8, replaced with tab
+ *                  spaces. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
+char* libstring_unexpand(const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strunexp  libstring_unexpand
+#endif
+
+
+/**
+ * Replace initial spaces of groups of 8 with tabs,
+ * and store the result in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_unexpand`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_unexpand_into(char*, size_t, const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strunexp_into  libstring_unexpand_into
+#endif
+
+
+/**
+ * Replace initial spaces of groups of 8 with tabs in a string
+ * of a given length, and store the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_unexpand`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_unexpand_str(struct libstring_str*, const char*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strunexp_str  libstring_unexpand_str
+#endif
+
+
+/**
+ * ROT13: Offensive joke and spoiler masker.
+ * 
+ * Example:
+ *   s = libstring_rot13("An offensive joke");
+ *   # s is "Na bssrafvir wbxr"
+ *   z = libstring_rot13(s);
+ *   # z is "An offensive joke"
+ *   free(s), free(z);
+ * 
+ * @param   string  The string to manipulate.
+ * @return          `string` with all ASCII letters
+ *                  substituted for the corresponding
+ *                  letter in the alphabet whose position
+ *                  is offset from that letter by 13.
  *                  `NULL` on error.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
 LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
-char* libstring_replace(const char*, const char*, const char*, enum libstring_replace);
+char* libstring_rot13(const char*);
 #ifdef LIBSTRING_SHORT_NAMES
-# define strreplace  libstring_replace
+# define strrot13  libstring_rot13
 #endif
 
 
 /**
- * `r = libstring_shellsafe(s)` is equivalent to
- * `t = libstring_replace(s, "'", "'\''", 0);
- *  if (t && (r = malloc(strlen(t) + 3)))
- *    *r = '\'', strcpy(stpcpy(r + 1, t), "'");
- *  saved_errno = errno, free(t), errno = saved_errno;
- *  r;`.
- * You guess what it does, and why.
+ * ROT13 a string, and store the result
+ * in a caller-provided buffer.
+ * 
+ * This is the same as `libstring_rot13`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to manipulate.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_rot13_into(char*, size_t, const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strrot13_into  libstring_rot13_into
+#endif
+
+
+/**
+ * ROT13 a string, modifying it in place.
+ * 
+ * Example:
+ *   char s[] = "An offensive joke";
+ *   libstring_rot13_inplace(s, NULL);
+ *   # s is "Na bssrafvir wbxr"
+ * 
+ * ROT13 never changes the length of the string,
+ * so unlike `libstring_lcase_inplace`, this
+ * function cannot fail.
+ * 
+ * @param   string  The string to manipulate.
+ * @param   n       Either a pointer to the length of
+ *                  `string`, or `NULL` if `string`
+ *                  is NUL-terminated.
+ * @return          0.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_rot13_inplace(char*, const size_t*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strrot13_inplace  libstring_rot13_inplace
+#endif
+
+
+/**
+ * ROT13 a string of a given length, and store
+ * the result in a `struct libstring_str`.
+ * 
+ * This is the same as `libstring_rot13`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
+ * @param   string  The string to manipulate.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_rot13_str(struct libstring_str*, const char*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strrot13_str  libstring_rot13_str
+#endif
+
+
+/**
+ * ROT13 each string in an array.
+ * 
+ * This is the same as `libstring_rot13`, applied to each string
+ * in an array, except the results are packed into one
+ * allocation, with their offsets in another.
+ * 
+ * @param   out      Output parameter for the results.
+ * @param   strings  The strings to manipulate.
+ * @param   n        The number of strings in `strings`.
+ * @return           0 on success, -1 on error, in
+ *                   which case `out` is left empty.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_rot13_batch(struct libstring_batch*, const char* const*, size_t);
+#ifdef LIBSTRING_SHORT_NAMES
+# define strrot13_batch  libstring_rot13_batch
+#endif
+
+
+/**
+ * Double ROT13: terrorist-grade encryption.
+ * 
+ * Example:
+ *   s = libstring_rot13("Secret message");
+ *   # s is "Secret message"
+ *   free(s);
+ * 
+ * @param   string  The string to copy.
+ * @return          A copy of `string`. `NULL` on error.
+ * 
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
+char* libstring_double_rot13(const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define str2rot13  libstring_double_rot13
+#endif
+
+
+/**
+ * Copy a string into a caller-provided buffer.
+ * 
+ * This is the same as `libstring_double_rot13`, except
+ * the result is stored in `buf` and truncated, in the
+ * same way as `snprintf` does, if it does not fit.
+ * 
+ * @param   buf     Output buffer, may be `NULL` if `size` is 0.
+ * @param   size    The allocation size of `buf`.
+ * @param   string  The string to copy.
+ * @return          The length of the result, excluding the
+ *                  terminating NUL byte. The result was
+ *                  truncated if this is not less than `size`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_INTO(3))))
+size_t libstring_double_rot13_into(char*, size_t, const char*);
+#ifdef LIBSTRING_SHORT_NAMES
+# define str2rot13_into  libstring_double_rot13_into
+#endif
+
+
+/**
+ * Copy a string of a given length
+ * into a `struct libstring_str`.
  * 
+ * This is the same as `libstring_double_rot13`, except
+ * `string` has a given length, so it may contain
+ * NUL bytes, and the result is stored in `out`.
+ * 
+ * @param   out     Output string, its allocation is reused
+ *                  if the result fits in it. Must not
+ *                  overlap `string`.
  * @param   string  The string to manipulate.
- * @return          The result. `NULL` on error.
+ * @param   n       The length of `string`.
+ * @return          0 on success, -1 on error, in which
+ *                  case `out` is left empty.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
-char* libstring_shellsafe(const char*);
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_double_rot13_str(struct libstring_str*, const char*, size_t);
 #ifdef LIBSTRING_SHORT_NAMES
-# define strshsafe  libstring_shellsafe
+# define str2rot13_str  libstring_double_rot13_str
 #endif
 
 
+
 /**
- * Measure the length of a string.
+ * Select the allocator used for all memory allocated
+ * by the library in the calling thread.
  * 
- * @param   string  The string to measure.
- * @param   flags   Additional options.
- * @return          The length of `string`.
+ * To use an allocator for a single call, select it
+ * before the call and restore the returned allocator
+ * after the call.
+ * 
+ * Example:
+ *   struct libstring_arena arena;
+ *   libstring_arena_initialise(&arena, 0);
+ *   old = libstring_set_allocator(&arena.allocator);
+ *   fields = libstring_split(line, ",", &n, 0);
+ *   s = libstring_join(fields, &n, ";");
+ *   libstring_set_allocator(old);
+ *   # use s
+ *   libstring_arena_destroy(&arena);
+ * 
+ * @param   allocator  The allocator, `NULL` for `malloc`, `realloc`
+ *                     and `free`. It must remain valid until it is
+ *                     replaced.
+ * @return             The previously selected allocator, `NULL`
+ *                     if it was `malloc`, `realloc` and `free`.
  */
-LIBSTRING_GCC_ONLY(__attribute__((__warn_unused_result__, __nonnull__, __leaf__)))
-size_t libstring_length(const char*, enum libstring_length);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strdisplen  libstring_length
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__)))
+const struct libstring_allocator* libstring_set_allocator(const struct libstring_allocator*);
 
 
 /**
- * Validate teh encoding of a string.
+ * Deallocate memory returned by the library, using
+ * the allocator selected in the calling thread.
  * 
- * @param   string  The string to validate.
- * @param   flags   Additional options.
- * @return          0 if the string is valid, -1 otherwise.
+ * `free` can be used instead of this function if
+ * no allocator has been selected.
+ * 
+ * @param  ptr  The memory to deallocate, may be `NULL`.
  */
-LIBSTRING_GCC_ONLY(__attribute__((__warn_unused_result__, __nonnull__, __leaf__)))
-int libstring_utf8verify(const char*, enum libstring_utf8verify);
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__)))
+void libstring_free(void*);
 #ifdef LIBSTRING_SHORT_NAMES
-# define strverify  libstring_utf8verify
+# define strfree  libstring_free
 #endif
 
 
 /**
- * Split a string at each occurrence of a selected delimiter,
- * but retain only select fields.
+ * Make room for a string of a given length
+ * in a `struct libstring_str`, keeping its
+ * contents.
  * 
- * @param   string     The string to cut.
- * @param   delimiter  The delimiter.
- * @param   fields     List of fields to return.
- * @param   fields_n   The number of elements in `fields`.
- * @param   n          Output parameter for the number of
- *                     returned fields. May be `NULL`.
- * @param   flags      Additional options.
- * @return             `NULL`-terminated list of the
- *                     found fields. `NULL` on error.
+ * @param   str  The string.
+ * @param   len  The length, excluding the terminating
+ *               NUL byte, to make room for.
+ * @return       0 on success, -1 on error, in which
+ *               case `str` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1, 2, 3))))
-char** libstring_cut(const char*, const char*, const size_t*, size_t, size_t*, enum libstring_cut);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strcut  libstring_cut
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+int libstring_str_reserve(struct libstring_str*, size_t);
 
 
 /**
- * Split a string at each occurrence of a selected delimiter,
- * but retain only select fields.
+ * Deallocate a `struct libstring_str`, and leave
+ * it empty so that it can be used again.
  * 
- * @param   string     The string to cut.
- * @param   delimiter  The delimiter.
- * @param   fields...  List of fields to return.
- *                     End with `SIZE_MAX`.
- * @param   n          Output parameter for the number of
- *                     returned fields. May be `NULL`.
- * @param   flags      Additional options.
- * @return             `NULL`-terminated list of the
- *                     found fields. `NULL` on error.
+ * @param  str  The string.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+void libstring_str_destroy(struct libstring_str*);
+
+
+/**
+ * Initialise a string builder, with an empty string.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * Nothing is allocated until something is appended.
+ * 
+ * @param  builder  The builder.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_COMMON(1, 2))))
-char** libstring_vcut(const char*, const char*, size_t, ... /*, SIZE_MAX, size_t*, enum libstring_cut */);
-#ifdef LIBSTRING_SHORT_NAMES
-# define vstrcut  libstring_vcut
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+void libstring_builder_initialise(struct libstring_builder*);
 
 
 /**
- * Retrieve a substring.
+ * Make room for more bytes in a string builder.
  * 
- * @param   string  The string.
- * @param   start   The position in `string` of the
- *                  beginning of the substring.
- * @param   end     The position in `string` of the
- *                  end of the substring.
- * @param   flags   Additional options.
- * @return          The selected substring of `string`.
- *                  `NULL` on error.
+ * @param   builder  The builder.
+ * @param   n        The number of bytes to make room
+ *                   for, after the current string.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
-char* libstring_substring(const char*, size_t, size_t, enum libstring_substring);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strsub  libstring_substring
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+int libstring_builder_reserve(struct libstring_builder*, size_t);
 
 
 /**
- * Remove unnecessary whitespace in string.
- * 
- * Example:
- *   s = libstring_trim("  hello   world!  ", NULL, 0);
- *   # s is "hello   world!"
- *   free(s);
+ * Append a string to a string builder.
  * 
- * @param   string   The string to manipulate.
- * @param   symbols  Symbols to remove.
- * @param   flags    Additional options.
- * @return           Trimmed version of `string`.
- *                   `NULL` on error.
+ * @param   builder  The builder.
+ * @param   string   The string to append, must not be
+ *                   stored in the builder.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF(1))))
-char* libstring_trim(const char*, const char*, enum libstring_trim);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strtrim  libstring_trim
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+int libstring_builder_append(struct libstring_builder*, const char*);
 
 
 /**
- * Reverse the order of the characters in a string.
- * 
- * Example:
- *   s = libstring_reverse("hello world!", 0);
- *   # s is "!dlrow olleh"
- *   free(s);
+ * Append a string of a given length to a string builder.
  * 
- * @param   string  The string to reverse.
- * @param   flags   Additional options.
- * @return          String reversed. `NULL` on error.
+ * @param   builder  The builder.
+ * @param   string   The string to append, must not be stored
+ *                   in the builder. May contain NUL bytes.
+ * @param   n        The length of `string`.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
-char* libstring_reverse(const char*, enum libstring_reverse);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strrev  libstring_reverse
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1))))
+int libstring_builder_append_n(struct libstring_builder*, const char*, size_t);
 
 
 /**
- * Shuffle the order of the characters in a string.
- * 
- * You should have called `srand` before calling
- * this function.
+ * Append a byte, repeated any number
+ * of times, to a string builder.
  * 
  * Example:
- *   s = libstring_anagram("hello world!");
- *   # s is "oh!owerld ll", or something else.
- *   free(s);
- *   s = libstring_anagram("hello world!");
- *   # s is "olw! lordlhe", or something else.
- *   free(s);
- *   s = libstring_anagram("hello world!");
- *   # s is "hell row old!", or something else.
- *   free(s);
+ *   libstring_builder_append_char(&b, ' ', 8 - col % 8);
  * 
- * @param   string  Anagram of the returned string.
- * @return          An anagram of `string`.
- *                  `NULL` on error.
+ * @param   builder  The builder.
+ * @param   c        The byte to append.
+ * @param   count    The number of times to append `c`.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
-char* libstring_anagram(const char*);
-#ifdef LIBSTRING_SHORT_NAMES
-# define stranagram  libstring_anagram
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+int libstring_builder_append_char(struct libstring_builder*, char, size_t);
 
 
 /**
- * Replace lowercase letters with uppercase letters.
+ * Append an unsigned integer, in decimal,
+ * to a string builder.
  * 
- * Example:
- *   s = libstring_lcase("Hello World!");
- *   # s is "hello world!"
- *   free(s);
+ * @param   builder  The builder.
+ * @param   value    The integer to append.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
  * 
- * @param   string  The string to manipulate.
- * @return          Lowercase version of `string`.
- *                  `NULL` on error.
+ * @throws  ENOMEM  The process cannot enough memory.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+int libstring_builder_append_uint(struct libstring_builder*, unsigned long long int);
+
+
+/**
+ * Append a signed integer, in decimal,
+ * to a string builder.
+ * 
+ * @param   builder  The builder.
+ * @param   value    The integer to append.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
-char* libstring_lcase(const char*);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strlcase  libstring_lcase
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+int libstring_builder_append_int(struct libstring_builder*, long long int);
 
 
 /**
- * Replace uppercase letters with lowercase letters.
+ * Append formatted text, in the same way as
+ * `printf` formats it, to a string builder.
  * 
  * Example:
- *   s = libstring_ucase("Hello World!");
- *   # s is "HELLO WORLD!"
- *   free(s);
+ *   libstring_builder_append_format(&b, "%s=%.2f\n", key, value);
  * 
- * @param   string  The string to manipulate.
- * @return          Uppercase version of `string`.
- *                  `NULL` on error.
+ * @param   builder  The builder.
+ * @param   format   The format string.
+ * @param   ...      The values to format.
+ * @return           0 on success, -1 on error, in which
+ *                   case `builder` is left unmodified.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * @throws  ENOMEM     The process cannot enough memory.
+ * @throws  EOVERFLOW  The text is longer than `INT_MAX`.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
-char* libstring_ucase(const char*);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strucase  libstring_ucase
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__, __format__(__printf__, 2, 3))))
+int libstring_builder_append_format(struct libstring_builder*, const char*, ...);
 
 
 /**
- * Replace the first letter with its lovercase
- * variant if it is in upper case.
+ * Append strings, with a delimiter between
+ * them, to a string builder.
  * 
- * Example:
- *   s = libstring_capitalise("hello world!");
- *   # s is "Hello world!"
- *   free(s);
+ * This appends the same string as
+ * `libstring_join` returns.
  * 
- * @param   string  The string to manipulate.
- * @return          Capitalised version of `string`.
- *                  `NULL` on error.
+ * @param   builder    The builder.
+ * @param   strings    List of strings to join, must
+ *                     not be `NULL` or contain `NULL`:s.
+ * @param   n          Either a pointer the number of strings
+ *                     stored in `strings`, or `NULL` if
+ *                     `strings` is `NULL`-terminated.
+ * @param   delimiter  A string to insert between all strings.
+ * @return             0 on success, -1 on error, in which
+ *                     case `builder` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
-char* libstring_capitalise(const char*);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strcap  libstring_capitalise
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__(1, 2, 4))))
+int libstring_builder_append_join(struct libstring_builder*, const char* const*,
+				  const size_t*, const char*);
 
 
 /**
- * Replace lowercase letters with uppercase letters,
- * and uppercase letters with lowercase letters.
+ * Append the result of an `_into` function, that has
+ * been stored at the end of a string builder.
  * 
- * Example:
- *   s = libstring_swapcase("Hello World!");
- *   # s is "hELLO wORLD!"
- *   free(s);
+ * If the result did not fit, room is made for it, and
+ * the `_into` function must be called again.
  * 
- * @param   string  The string to manipulate.
- * @return          `string` with swapped cased for
- *                  all letters. `NULL` on error.
+ * Example:
+ *   do
+ *     n = libstring_lcase_into(b.ptr + b.len, b.cap - b.len, s);
+ *   while ((r = libstring_builder_commit(&b, n)) > 0);
+ * 
+ * @param   builder  The builder.
+ * @param   n        The return value of the `_into` function,
+ *                   called with `builder->ptr + builder->len`
+ *                   as the buffer and `builder->cap - builder->len`
+ *                   as its size.
+ * @return           0 if the result was appended, 1 if the `_into`
+ *                   function must be called again, -1 on error, in
+ *                   which case `builder` is left unmodified.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
-char* libstring_swapcase(const char*);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strscase  libstring_swapcase
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+int libstring_builder_commit(struct libstring_builder*, size_t);
 
 
 /**
- * Replace tabs with spaces.
+ * Take the string from a string builder, without copying it.
  * 
- * @param   string  The string to manipulate.
- * @param   flags   Additional options.
- * @return          `string` with 8 spaces substituted
- *                  tabs for tab space. `NULL` on error.
+ * The builder is left empty, and can be used again.
+ * 
+ * @param   builder  The builder.
+ * @return           The string, which shall be deallocated
+ *                   with `libstring_free`. `NULL` on error.
  * 
  * @throws  ENOMEM  The process cannot enough memory.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
-char* libstring_expand(const char*, enum libstring_expand);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strexp  libstring_expand
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__, __warn_unused_result__)))
+char* libstring_builder_finalise(struct libstring_builder*);
 
 
 /**
- * Replace initial spaces of groups of 8 with tabs.
+ * Deallocate the string in a string builder, and
+ * leave it empty so that it can be used again.
  * 
- * @param   string  The string to manipulate.
- * @return          `string` with initial spaces of
- *                  groups of 8, replaced with tab
- *                  spaces. `NULL` on error.
+ * @param  builder  The builder.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+void libstring_builder_destroy(struct libstring_builder*);
+
+
+/**
+ * Deallocate the results of a batch transform.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * @param  batch  The results.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
-char* libstring_unexpand(const char*);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strunexp  libstring_unexpand
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+void libstring_batch_destroy(struct libstring_batch*);
 
 
 /**
- * ROT13: Offensive joke and spoiler masker.
+ * Initialise a memory arena.
  * 
- * Example:
- *   s = libstring_rot13("An offensive joke");
- *   # s is "Na bssrafvir wbxr"
- *   z = libstring_rot13(s);
- *   # z is "An offensive joke"
- *   free(s), free(z);
+ * No memory is allocated until the arena is used.
  * 
- * @param   string  The string to manipulate.
- * @return          `string` with all ASCII letters
- *                  substituted for the corresponding
- *                  letter in the alphabet whose position
- *                  is offset from that letter by 13.
- *                  `NULL` on error.
+ * @param  arena       The arena.
+ * @param  chunk_size  The number of bytes to allocate at a
+ *                     time, 0 for the default value.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+void libstring_arena_initialise(struct libstring_arena*, size_t);
+
+
+/**
+ * Deallocate everything that has been allocated in
+ * a memory arena, but keep the memory of the most
+ * recently used chunk for reuse.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * @param  arena  The arena.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
-char* libstring_rot13(const char*);
-#ifdef LIBSTRING_SHORT_NAMES
-# define strrot13  libstring_rot13
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+void libstring_arena_reset(struct libstring_arena*);
 
 
 /**
- * Double ROT13: terrorist-grade encryption.
+ * Release all memory of a memory arena.
  * 
- * Example:
- *   s = libstring_rot13("Secret message");
- *   # s is "Secret message"
- *   free(s);
+ * The arena can be used again without
+ * being reinitialised.
  * 
- * @param   string  The string to copy.
- * @return          A copy of `string`. `NULL` on error.
+ * @param  arena  The arena.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__, __nonnull__)))
+void libstring_arena_destroy(struct libstring_arena*);
+
+
+/**
+ * Get the performance counters of the functions.
+ * 
+ * The counters are only kept if the library was built
+ * with `LIBSTRING_STATS` defined. They cover all threads,
+ * including those that have exited, and count from the
+ * last call to `libstring_stats_reset`. A call that one
+ * function makes to another is not counted, and its
+ * allocations are counted for the calling function.
+ * 
+ * @param   buf  Output buffer, may be `NULL` if `n` is 0.
+ * @param   n    The number of elements in `buf`.
+ * @return       The number of counted functions, 0 if
+ *               the library was built without
+ *               `LIBSTRING_STATS`. Only the first
+ *               `n` are stored in `buf`.
+ */
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__)))
+size_t libstring_stats_snapshot(struct libstring_stats*, size_t);
+
+
+/**
+ * Start counting from zero again in the counters
+ * returned by `libstring_stats_snapshot`.
  * 
- * @throws  ENOMEM  The process cannot enough memory.
+ * Calls that are made at the same time by other
+ * threads may be counted either before or after
+ * the reset.
  */
-LIBSTRING_GCC_ONLY(__attribute__((LIBSTRING_LEAF)))
-char* libstring_double_rot13(const char*);
-#ifdef LIBSTRING_SHORT_NAMES
-# define str2rot13  libstring_double_rot13
-#endif
+LIBSTRING_GCC_ONLY(__attribute__((__leaf__)))
+void libstring_stats_reset(void);
 
 
 
@@ -799,6 +3564,9 @@ char* libstring_double_rot13(const char*);
 #ifdef LIBSTRING_LEAF
 # undef LIBSTRING_LEAF
 #endif
+#ifdef LIBSTRING_INTO
+# undef LIBSTRING_INTO
+#endif
 
 #endif
 
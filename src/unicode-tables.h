@@ -0,0 +1,2617 @@
+/* This file is generated by gen-unicode-tables.c from the
+ * Unicode Character Database, version 15.1.0. Do not edit. */
+
+#define UNICODE_WIDTH               0x03
+#define UNICODE_COMBINING           0x04
+#define UNICODE_EMOJI               0x08
+#define UNICODE_EMOJI_PRESENTATION  0x10
+
+#define UNICODE_ROOT_SHIFT    11
+#define UNICODE_MIDDLE_SHIFT  6
+#define UNICODE_MIDDLE_MASK   0x1F
+#define UNICODE_LEAF_MASK     0x3F
+
+#define UNICODE_CASE_FOLD     0
+#define UNICODE_CASE_NEXT     1
+#define UNICODE_CASE_LOWER    2
+#define UNICODE_CASE_UPPER    3
+#define UNICODE_CASE_TITLE    4
+#define UNICODE_CASE_SPECIAL  5
+
+#define UNICODE_GRAPHEME_BREAK          0x0F
+#define UNICODE_EXTENDED_PICTOGRAPHIC   0x10
+#define UNICODE_INCB                    0x60
+#define UNICODE_INCB_CONSONANT          0x20
+#define UNICODE_INCB_EXTEND             0x40
+#define UNICODE_INCB_LINKER             0x60
+
+#define UNICODE_GRAPHEME_OTHER               0
+#define UNICODE_GRAPHEME_CR                  1
+#define UNICODE_GRAPHEME_LF                  2
+#define UNICODE_GRAPHEME_CONTROL             3
+#define UNICODE_GRAPHEME_EXTEND              4
+#define UNICODE_GRAPHEME_ZWJ                 5
+#define UNICODE_GRAPHEME_REGIONAL_INDICATOR  6
+#define UNICODE_GRAPHEME_PREPEND             7
+#define UNICODE_GRAPHEME_SPACING_MARK        8
+#define UNICODE_GRAPHEME_L                   9
+#define UNICODE_GRAPHEME_V                   10
+#define UNICODE_GRAPHEME_T                   11
+#define UNICODE_GRAPHEME_LV                  12
+#define UNICODE_GRAPHEME_LVT                 13
+
+/* 16352 bytes in total. */
+
+static const uint8_t unicode_root[544] =
+  {
+    0,1,2,3,4,5,6,7,7,8,7,7,7,7,7,7,
+    7,7,7,7,9,10,7,7,7,7,11,12,12,12,12,13,
+    14,15,16,17,12,12,18,12,12,12,12,12,12,19,7,7,
+    20,21,12,12,12,22,23,24,12,25,26,27,28,29,30,31,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,32,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,32,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    33,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+    12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12
+  };
+
+static const uint8_t unicode_middle[34][32] =
+  {
+    {0,1,2,3,3,3,3,3,3,3,3,3,4,5,3,3,
+     3,3,6,3,3,3,7,8,9,10,3,11,12,13,14,15},
+    {16,17,18,19,20,21,22,23,24,25,24,26,27,28,29,30,
+     31,32,27,33,34,35,36,37,38,39,40,41,42,43,44,45},
+    {46,47,48,3,49,50,51,51,3,3,3,3,3,52,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,53,54,55,56},
+    {57,3,58,3,59,3,3,3,60,61,62,63,64,65,66,67,
+     68,3,3,69,3,3,3,4,3,3,3,3,3,3,3,3},
+    {70,71,3,72,73,3,74,3,3,3,3,3,75,3,3,76,
+     3,3,3,77,3,3,78,79,80,81,82,83,84,85,86,3},
+    {3,3,3,3,87,3,3,3,3,3,3,3,88,89,3,3,
+     3,3,3,90,3,91,3,92,3,3,93,94,49,49,49,95},
+    {96,97,98,49,99,49,100,101,102,103,104,49,49,49,49,49,
+     49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49},
+    {49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+     49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49},
+    {49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+     49,49,49,49,49,49,49,3,49,49,49,49,49,49,49,49},
+    {49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+     49,49,105,106,3,3,3,3,3,107,108,109,3,3,3,3},
+    {110,3,3,111,112,113,114,115,116,117,118,119,3,3,3,120,
+     49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49},
+    {49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+     49,49,49,49,49,49,49,49,49,49,49,49,49,49,121,51},
+    {3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,49,49,49,49,49,49,49,49,122,3,3,3,
+     3,3,3,3,3,3,3,3,123,124,3,1,97,125,3,126},
+    {3,3,3,3,3,3,3,127,3,3,3,128,3,129,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,3,3,3,3,130,3,3,131,3,3,3,3,
+     3,3,3,3,132,3,3,3,3,3,133,134,3,135,136,3},
+    {137,138,139,140,141,142,143,144,145,36,3,146,34,147,3,3,
+     148,149,150,151,3,3,152,153,154,155,156,3,157,3,3,3},
+    {158,3,3,3,159,160,3,161,162,163,164,3,3,3,3,3,
+     165,3,166,3,167,168,169,3,3,3,3,170,171,172,3,3},
+    {3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     173,174,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,3,3,3,3,3,3,3,175,176,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,177,178,179},
+    {49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+     49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,180},
+    {49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+     49,49,49,181,182,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,183},
+    {49,49,49,49,184,185,49,49,49,49,49,186,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,187,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,188,189,3,3},
+    {3,3,3,3,3,190,191,3,3,192,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,3,3,3,3,193,194,195,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {196,3,177,3,176,3,3,3,3,3,197,198,3,3,3,3,
+     3,3,3,198,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,199,3,200,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {201,3,3,202,3,203,204,205,206,207,3,3,208,209,210,211,
+     212,213,214,215,216,217,218,219,214,220,214,221,3,3,3,222},
+    {3,3,3,3,223,224,214,214,3,225,226,227,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+     49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,228},
+    {229,51,3,3,4,4,4,5,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3}
+  };
+
+static const uint8_t unicode_leaves[230][64] =
+  {
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     1,1,1,9,1,1,1,1,1,1,9,1,1,1,1,1,
+     9,9,9,9,9,9,9,9,9,9,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     1,1,1,1,1,1,1,1,1,9,1,1,1,1,9,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4},
+    {4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,4,4,4,4,4,4,4,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,1,4},
+    {1,4,4,1,4,4,1,4,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {0,0,0,0,0,0,1,1,1,1,1,1,1,1,1,1,
+     4,4,4,4,4,4,4,4,4,4,4,1,0,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,4,4,4,4,4,4,4,0,1,4,
+     4,4,4,4,4,1,1,4,4,1,4,4,4,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,
+     1,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4},
+    {4,4,4,4,4,4,4,4,4,4,4,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,4,4,4,4,4,4,4,4,4,4,
+     4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,4,4,4,4,4,
+     4,4,4,4,1,1,1,1,1,1,1,1,1,4,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,4,4,4,4,1,4,4,4,4,4,
+     4,4,4,4,1,4,4,4,1,4,4,4,4,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,4,4,4,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     0,0,1,1,1,1,1,1,4,4,4,4,4,4,4,4,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,0,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4},
+    {4,4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,4,1,4,1,1,1},
+    {1,4,4,4,4,4,4,4,4,1,1,1,1,4,1,1,
+     1,4,4,4,4,4,4,4,1,1,1,1,1,1,1,1,
+     1,1,4,4,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,4,1,1,1},
+    {1,4,4,4,4,1,1,1,1,1,1,1,1,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,4,4,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,1},
+    {1,4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,4,1,1,1},
+    {1,4,4,1,1,1,1,4,4,1,1,4,4,4,1,1,
+     1,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,1,1,1,4,1,1,1,1,1,1,1,1,1,1},
+    {1,4,4,4,4,4,1,4,4,1,1,1,1,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,4,4,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,4,4,4,4,4,4},
+    {1,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,4,1,1,4},
+    {1,4,4,4,4,1,1,1,1,1,1,1,1,4,1,1,
+     1,1,1,1,1,4,4,1,1,1,1,1,1,1,1,1,
+     1,1,4,4,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,4,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {4,1,1,1,1,1,1,1,1,1,1,1,1,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {4,1,1,1,4,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,4,1,4,4},
+    {4,1,1,1,1,1,4,4,4,1,4,4,4,4,1,1,
+     1,1,1,1,1,4,4,1,1,1,1,1,1,1,1,1,
+     1,1,4,4,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,4,1,1,1,1,1,4,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,4,4,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,4,4,1,1,1},
+    {1,4,4,4,4,1,1,1,1,1,1,1,1,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,4,4,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,4,1,1,1,1,1,
+     1,1,4,4,4,1,4,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,4,1,1,4,4,4,4,4,4,4,1,1,1,1,1},
+    {1,1,1,1,1,1,1,4,4,4,4,4,4,4,4,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,4,1,1,4,4,4,4,4,4,4,4,4,1,1,1},
+    {1,1,1,1,1,1,1,1,4,4,4,4,4,4,4,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,4,4,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,4,1,4,1,4,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,4,4,4,4,4,4,4,4,4,4,4,4,4,4,1},
+    {4,4,4,4,4,1,4,4,1,1,1,1,1,4,4,4,
+     4,4,4,4,4,4,4,4,1,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,1,1,1},
+    {1,1,1,1,1,1,4,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,4,4,4,
+     4,1,4,4,4,4,4,4,1,4,4,1,1,4,4,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,4,4,1,1,1,1,4,4,
+     4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,4,4,4,4,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,4,1,1,4,4,1,1,1,1,1,1,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,4,4,4,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,4,4,4,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,4,4,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,4,4,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,4,4,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,4,4,1,4,4,4,4,4,4,4,1,1},
+    {1,1,1,1,1,1,4,1,1,4,4,4,4,4,4,4,
+     4,4,4,4,1,1,1,1,1,1,1,1,1,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,4,4,4,0,4,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,4,4,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,4,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,4,1,1,1,1,4,4,1,1,1,1,1,1,1,
+     1,1,4,1,1,1,1,1,1,4,4,4,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,4,4,1,1,4,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,4,1,4,4,4,4,4,4,4,1,
+     4,1,4,1,1,4,4,4,4,4,4,4,4,1,1,1,
+     1,1,1,4,4,4,4,4,4,4,4,4,4,1,1,4},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4},
+    {4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {4,4,4,4,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,4,1,4,4,4,4,4,1,4,1,1,1},
+    {1,1,4,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,4,4,4,4,4,
+     4,4,4,4,1,1,1,1,1,1,1,1,1,1,1,1},
+    {4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,4,4,4,4,1,1,4,4,1,4,4,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,4,1,4,4,1,1,1,4,1,4,
+     4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,4,4,4,4,
+     4,4,4,4,1,1,4,4,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,4,1,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,1,4,4,4,4,4,4,4,1,1,1,1,4,1,1,
+     1,1,1,1,4,1,1,1,4,4,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,9,1,1,1},
+    {1,1,1,1,1,1,1,1,1,9,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,9,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,9,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,9,9,9,9,9,9,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,9,9,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,26,26,1,1,1,1,
+     1,1,1,1,1,1,1,1,9,2,2,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,9,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,26,26,26,26,9,9,9,
+     26,9,9,26,1,1,1,1,9,9,9,1,1,1,1,1},
+    {1,1,9,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,9,9,1,1,1,1,
+     1,1,1,1,1,1,9,1,1,1,1,1,1,1,1,1},
+    {9,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,9,9,26,26,1},
+    {9,9,9,9,9,1,1,1,1,1,1,1,1,1,9,1,
+     1,9,1,1,26,26,1,1,9,1,1,1,1,9,1,1,
+     9,1,9,9,1,1,9,1,1,1,9,1,1,1,9,9,
+     1,1,1,1,1,1,1,1,9,9,9,1,1,1,1,1},
+    {9,1,9,1,1,1,1,1,26,26,26,26,26,26,26,26,
+     26,26,26,26,1,1,1,1,1,1,1,1,1,1,1,9,
+     9,1,1,9,1,9,9,1,9,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,9,1,1,9,26},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,9,26,9,9,9,9,1,9,1,9,9,1,1,1,
+     9,26,1,1,1,1,1,9,1,1,26,26,1,1,1,1,
+     9,9,1,1,1,1,1,1,1,1,1,1,1,26,26,1},
+    {1,1,1,1,26,26,1,1,9,1,1,1,1,1,26,9,
+     1,9,1,9,26,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,9,26,1,1,1,1,1,
+     9,9,26,26,9,26,1,9,9,9,26,1,1,26,1,1},
+    {1,1,9,1,1,26,1,1,9,9,26,26,9,9,1,9,
+     1,1,9,1,9,1,9,1,1,1,1,1,1,9,1,1,
+     1,9,1,1,1,1,1,1,26,1,1,1,1,1,1,1,
+     1,1,1,9,9,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,9,1,1,9,1,1,1,1,26,1,26,1,
+     1,1,1,26,26,26,1,26,1,1,1,1,1,1,1,1,
+     1,1,1,9,9,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,26,26,26,1,1,1,1,1,1,1,1,
+     1,9,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     26,1,1,1,1,1,1,1,1,1,1,1,1,1,1,26},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,9,9,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,9,9,9,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,26,26,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     26,1,1,1,1,26,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,
+     4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,1,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,4,4,4,4,2,2,
+     10,2,2,2,2,2,2,2,2,2,2,2,2,10,2,1},
+    {1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,1,1,4,4,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,10,2,10,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,
+     4,4,4,1,4,4,4,4,4,4,4,4,4,4,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,4,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,4,1,1,1,4,1,1,1,1,4,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,4,4,1,1,1,1,1,4,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,4,4,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,4},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,4,4,4,4,4,4,4,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,4,4,4,4,4,4,4,4,4,
+     4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,1,1,1},
+    {4,4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,4,1,1,4,4,4,4,1,1,4,4,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,4,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,4,4,4,4,4,4,1,
+     1,4,4,1,1,4,4,1,1,1,1,1,1,1,1,1},
+    {1,1,1,4,1,1,1,1,1,1,1,1,4,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,4,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,1,4,4,4,1,1,4,4,1,1,1,1,1,4,4},
+    {1,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,4,4,1,1,
+     1,1,1,1,1,1,4,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,4,1,1,4,1,1,1,1,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     2,2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,1,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,1,2,2,2,2,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     2,2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,0,0,0,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,4,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,4,4,4,4,4,1,1,1,1,1},
+    {1,4,4,4,1,4,4,1,1,1,1,1,4,4,4,4,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,4,4,4,1,1,1,1,4},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,4,4,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,4,4,4,4,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,4,4,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,4,4,4},
+    {1,1,1,1,1,1,4,4,4,4,4,4,4,4,4,4,
+     4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,4,4,4,4,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,4,4,4,4,4,4,4,4},
+    {4,4,4,4,4,4,4,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,1,1,4,4,1,1,1,1,1,1,1,1,1,1,4},
+    {4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,4,4,4,4,1,1,4,4,1,1,0,1,1},
+    {1,1,4,1,1,1,1,1,1,1,1,1,1,0,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {4,4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,4,4,4,4,4,1,4,4,4,
+     4,4,4,4,4,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,4,1,1,1,1,1,1,1,1,1,1,1,1},
+    {4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,4,4,4,4,4,4,4,4,4,1},
+    {1,1,1,1,1,1,1,1,1,4,4,4,4,1,1,4,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,
+     4,4,1,1,4,1,4,4,1,1,1,1,1,1,4,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,
+     1,1,1,4,4,4,4,4,4,4,4,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,4,4,4,4,4,4,4,1,1,1,
+     4,4,4,4,4,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,4,4,4,4,4,4,4,4},
+    {1,1,4,4,4,1,4,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,4,4,4,4,4,4,1,4,1,1,1,1,4},
+    {4,1,4,4,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,4,4,4,4,1,1,1,1,1,1,4,4,1,4},
+    {4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,4,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,4,4,4,4,4,4,4,4,1,1,4,1,4},
+    {4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,4,1,4,1,1,
+     4,4,4,4,4,4,1,4,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,4,4,4,
+     1,1,4,4,4,4,1,4,4,4,4,4,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,
+     4,4,4,4,4,4,4,4,1,4,4,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,4,4,1,4,1},
+    {1,1,1,4,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,4,4,4,4,1,1,4,4,1,1,1,1,
+     4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,4,4,4,4,4,4,4,4,4,4,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,4,4,4,4,4,4,1,1,4,4,4,4,1},
+    {1,1,1,1,1,1,1,4,1,1,1,1,1,1,1,1,
+     1,4,4,4,4,4,4,1,1,4,4,4,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,1,4,4,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,4,4,4,4,4,1,4,4,4,4,4,4,1,4},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,1,1,4,4,4,4,4,4,
+     4,1,4,4,1,4,4,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,4,4,4,4,4,4,1,1,1,4,1,4,4,1,4},
+    {4,4,4,4,4,4,1,4,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,1,1,1,4,1,4,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,4,4,1,1,1,1,1,1,1,1,1,1,1},
+    {4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,4,4,4,4,4,1,1,1,1,1},
+    {4,1,4,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {4,1,1,1,1,1,1,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,4,4,4,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,4,4,4,4,4,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,
+     4,4,4,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     2,2,2,2,4,1,1,1,1,1,1,1,1,1,1,1,
+     2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,1},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     2,2,2,2,1,2,2,2,2,2,2,2,1,2,2,1},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,2,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     2,2,2,1,1,2,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,2,2,2,2,1,1,1,1,1,1,1,1,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,4,4,1,
+     0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,1,1,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4},
+    {4,4,4,4,4,4,4,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,4,4,4,1,1,1,1,1,1,
+     1,1,1,0,0,0,0,0,0,0,0,4,4,4,4,4},
+    {4,4,4,1,1,4,4,4,4,4,4,4,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,4,4,4,4,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,4,4,4,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,1,1,1,1,4,4,4,4,4},
+    {4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,4,4,4,4,1,1,1,
+     1,1,1,1,1,4,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,4,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,4,4,4,4,4,
+     1,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {4,4,4,4,4,4,4,1,4,4,4,4,4,4,4,4,
+     4,4,4,4,4,4,4,4,4,1,1,4,4,4,4,4,
+     4,4,1,4,4,1,4,4,4,4,4,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,4,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,4,4,4,4,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     4,4,4,4,4,4,4,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,4,4,4,4,4,4,4,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,26,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,26,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     9,9,1,1,1,1,1,1,1,1,1,1,1,1,9,9},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,26,1,
+     1,26,26,26,26,26,26,26,26,26,26,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,25,25,25,25,25,25,25,25,25,25,
+     25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25},
+    {2,26,10,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     2,2,2,2,2,2,2,2,2,2,26,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,26,
+     2,2,26,26,26,26,26,10,26,26,26,2,1,1,1,1},
+    {2,2,2,2,2,2,2,2,2,1,1,1,1,1,1,1,
+     26,26,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     2,2,2,2,2,2,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,9,1,1,9,9,9,9,9,9,9,9,9,26,26,26,
+     26,26,26,26,26,26,9,26,26,26,26,26,26,26,26,26},
+    {26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,9,26,26},
+    {26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,1,1,9,9,1,9,9,9,1,1,9,9,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26},
+    {26,26,26,26,26,26,26,26,26,26,26,9,9,9,9,26,
+     26,26,26,26,9,9,9,9,9,9,9,9,9,9,9,9,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,1,1,9,26,9,1,9,26,26,26,26,26,26,26,26},
+    {26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,9},
+    {26,9,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26},
+    {26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26},
+    {26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,9,1,26},
+    {26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,1,1},
+    {1,1,1,1,1,1,1,1,1,9,9,26,26,26,26,1,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,1,1,1,1,1,1,1,9,
+     9,1,1,9,9,9,9,9,9,9,26,1,1,1,1,1},
+    {1,1,1,1,1,1,1,9,1,1,9,9,9,9,1,1,
+     9,1,1,1,1,26,26,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,26,9,1,1,9,1,1,1,1,1,1,1,
+     1,9,9,1,1,1,1,1,1,1,1,1,9,1,1,1},
+    {1,1,9,9,9,1,1,1,1,1,1,1,1,1,1,1,
+     1,9,9,9,1,1,1,1,1,1,1,1,9,9,9,1,
+     1,9,1,9,1,1,1,1,9,1,1,1,1,1,1,9,
+     1,1,1,9,1,1,1,1,1,1,9,26,26,26,26,26},
+    {26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {26,26,26,26,26,26,1,1,1,1,1,9,26,9,9,9,
+     26,26,26,1,1,26,26,26,1,1,1,1,26,26,26,26,
+     9,9,9,9,9,9,1,1,1,9,1,26,26,1,1,1,
+     9,1,1,9,26,26,26,26,26,26,26,26,26,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     26,26,26,26,26,26,26,26,26,26,26,26,1,1,1,1,
+     26,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {1,1,1,1,1,1,1,1,1,1,1,1,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,1,26,26,26,26},
+    {26,26,26,26,26,26,1,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,1,1,1},
+    {26,26,26,26,26,26,26,26,26,1,1,1,1,1,1,1,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,26,26,1,26},
+    {26,26,26,26,26,26,1,1,1,1,1,1,1,1,26,26,
+     26,26,26,26,26,26,26,26,26,26,26,26,1,1,1,1,
+     26,26,26,26,26,26,26,26,26,1,1,1,1,1,1,1,
+     26,26,26,26,26,26,26,26,26,1,1,1,1,1,1,1},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,1,1},
+    {1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
+  };
+
+/* The offsets to the simple case folding, to the next code point
+ * with the same folding, and to the simple lower, upper and title
+ * case mappings, and whether there are special case mappings. */
+static const int32_t unicode_case[215][6] =
+  {
+    {0,0,0,0,0,0}, {32,32,32,0,0,0}, {0,-32,0,-32,-32,0}, {0,8383,0,-32,-32,0},
+    {0,268,0,-32,-32,0}, {775,743,0,743,743,0}, {0,7615,0,0,0,1}, {0,8262,0,-32,-32,0},
+    {0,121,0,121,121,0}, {1,1,1,0,0,0}, {0,-1,0,-1,-1,0}, {0,0,-199,0,0,1},
+    {0,0,0,-232,-232,0}, {0,0,0,0,0,1}, {-121,-121,-121,0,0,0}, {-268,-300,0,-300,-300,0},
+    {0,195,0,195,195,0}, {210,210,210,0,0,0}, {206,206,206,0,0,0}, {205,205,205,0,0,0},
+    {79,79,79,0,0,0}, {202,202,202,0,0,0}, {203,203,203,0,0,0}, {207,207,207,0,0,0},
+    {0,97,0,97,97,0}, {211,211,211,0,0,0}, {209,209,209,0,0,0}, {0,163,0,163,163,0},
+    {213,213,213,0,0,0}, {0,130,0,130,130,0}, {214,214,214,0,0,0}, {218,218,218,0,0,0},
+    {217,217,217,0,0,0}, {219,219,219,0,0,0}, {0,56,0,56,56,0}, {2,1,2,0,1,0},
+    {1,1,1,-1,0,0}, {0,-2,0,-2,-1,0}, {0,-79,0,-79,-79,0}, {-97,-97,-97,0,0,0},
+    {-56,-56,-56,0,0,0}, {-130,-130,-130,0,0,0}, {10795,10795,10795,0,0,0}, {-163,-163,-163,0,0,0},
+    {10792,10792,10792,0,0,0}, {0,10815,0,10815,10815,0}, {-195,-195,-195,0,0,0}, {69,69,69,0,0,0},
+    {71,71,71,0,0,0}, {0,10783,0,10783,10783,0}, {0,10780,0,10780,10780,0}, {0,10782,0,10782,10782,0},
+    {0,-210,0,-210,-210,0}, {0,-206,0,-206,-206,0}, {0,-205,0,-205,-205,0}, {0,-202,0,-202,-202,0},
+    {0,-203,0,-203,-203,0}, {0,42319,0,42319,42319,0}, {0,42315,0,42315,42315,0}, {0,-207,0,-207,-207,0},
+    {0,42280,0,42280,42280,0}, {0,42308,0,42308,42308,0}, {0,-209,0,-209,-209,0}, {0,-211,0,-211,-211,0},
+    {0,10743,0,10743,10743,0}, {0,42305,0,42305,42305,0}, {0,10749,0,10749,10749,0}, {0,-213,0,-213,-213,0},
+    {0,-214,0,-214,-214,0}, {0,10727,0,10727,10727,0}, {0,-218,0,-218,-218,0}, {0,42307,0,42307,42307,0},
+    {0,42282,0,42282,42282,0}, {0,-69,0,-69,-69,0}, {0,-217,0,-217,-217,0}, {0,-71,0,-71,-71,0},
+    {0,-219,0,-219,-219,0}, {0,42261,0,42261,42261,0}, {0,42258,0,42258,42258,0}, {116,84,0,84,84,0},
+    {116,116,116,0,0,0}, {38,38,38,0,0,0}, {37,37,37,0,0,0}, {64,64,64,0,0,0},
+    {63,63,63,0,0,0}, {0,7235,0,0,0,1}, {32,31,32,0,0,0}, {0,-38,0,-38,-38,0},
+    {0,-37,0,-37,-37,0}, {0,7219,0,0,0,1}, {0,30,0,-32,-32,0}, {0,64,0,-32,-32,0},
+    {0,25,0,-32,-32,0}, {0,7173,0,-32,-32,0}, {0,54,0,-32,-32,0}, {0,-775,0,-32,-32,0},
+    {0,22,0,-32,-32,0}, {0,48,0,-32,-32,0}, {1,1,0,-31,-31,0}, {0,15,0,-32,-32,0},
+    {0,7517,0,-32,-32,0}, {0,-64,0,-64,-64,0}, {0,-63,0,-63,-63,0}, {8,8,8,0,0,0},
+    {-30,-62,0,-62,-62,0}, {-25,35,0,-57,-57,0}, {-15,-47,0,-47,-47,0}, {-22,-54,0,-54,-54,0},
+    {0,-8,0,-8,-8,0}, {-54,-86,0,-86,-86,0}, {-48,-80,0,-80,-80,0}, {0,7,0,7,7,0},
+    {0,-116,0,-116,-116,0}, {-60,-92,-60,0,0,0}, {-64,-96,0,-96,-96,0}, {-7,-7,-7,0,0,0},
+    {80,80,80,0,0,0}, {0,6222,0,-32,-32,0}, {0,6221,0,-32,-32,0}, {0,6212,0,-32,-32,0},
+    {0,6210,0,-32,-32,0}, {0,6204,0,-32,-32,0}, {0,-80,0,-80,-80,0}, {0,6180,0,-1,-1,0},
+    {15,15,15,0,0,0}, {0,-15,0,-15,-15,0}, {48,48,48,0,0,0}, {0,-48,0,-48,-48,0},
+    {7264,7264,7264,0,0,0}, {0,3008,0,3008,0,0}, {0,38864,38864,0,0,0}, {0,8,8,0,0,0},
+    {-8,-8,0,-8,-8,0}, {-6222,-6254,0,-6254,-6254,0}, {-6221,-6253,0,-6253,-6253,0}, {-6212,-6244,0,-6244,-6244,0},
+    {-6210,-6242,0,-6242,-6242,0}, {-6210,1,0,-6242,-6242,0}, {-6211,-6243,0,-6243,-6243,0}, {-6204,-6236,0,-6236,-6236,0},
+    {-6180,-6181,0,-6181,-6181,0}, {35267,35266,0,35266,35266,0}, {-3008,-3008,-3008,0,0,0}, {0,35332,0,35332,35332,0},
+    {0,3814,0,3814,3814,0}, {0,35384,0,35384,35384,0}, {0,58,0,-1,-1,0}, {-58,-59,0,-59,-59,0},
+    {-7615,-7615,-7615,0,0,0}, {0,8,0,8,8,0}, {-8,-8,-8,0,0,0}, {0,74,0,74,74,0},
+    {0,86,0,86,86,0}, {0,100,0,100,100,0}, {0,128,0,128,128,0}, {0,112,0,112,112,0},
+    {0,126,0,126,126,0}, {0,8,0,8,8,1}, {-8,-8,-8,0,0,1}, {0,9,0,9,9,1},
+    {-74,-74,-74,0,0,0}, {-9,-9,-9,0,0,1}, {-7173,-7289,0,-7205,-7205,0}, {-86,-86,-86,0,0,0},
+    {-7235,-7235,0,0,0,1}, {-100,-100,-100,0,0,0}, {-7219,-7219,0,0,0,1}, {-112,-112,-112,0,0,0},
+    {-128,-128,-128,0,0,0}, {-126,-126,-126,0,0,0}, {-7517,-7549,-7517,0,0,0}, {-8383,-8415,-8383,0,0,0},
+    {-8262,-8294,-8262,0,0,0}, {28,28,28,0,0,0}, {0,-28,0,-28,-28,0}, {16,16,16,0,0,0},
+    {0,-16,0,-16,-16,0}, {26,26,26,0,0,0}, {0,-26,0,-26,-26,0}, {-10743,-10743,-10743,0,0,0},
+    {-3814,-3814,-3814,0,0,0}, {-10727,-10727,-10727,0,0,0}, {0,-10795,0,-10795,-10795,0}, {0,-10792,0,-10792,-10792,0},
+    {-10780,-10780,-10780,0,0,0}, {-10749,-10749,-10749,0,0,0}, {-10783,-10783,-10783,0,0,0}, {-10782,-10782,-10782,0,0,0},
+    {-10815,-10815,-10815,0,0,0}, {0,-7264,0,-7264,-7264,0}, {0,-35267,0,-1,-1,0}, {-35332,-35332,-35332,0,0,0},
+    {-42280,-42280,-42280,0,0,0}, {0,48,0,48,48,0}, {-42308,-42308,-42308,0,0,0}, {-42319,-42319,-42319,0,0,0},
+    {-42315,-42315,-42315,0,0,0}, {-42305,-42305,-42305,0,0,0}, {-42258,-42258,-42258,0,0,0}, {-42282,-42282,-42282,0,0,0},
+    {-42261,-42261,-42261,0,0,0}, {928,928,928,0,0,0}, {-48,-48,-48,0,0,0}, {-42307,-42307,-42307,0,0,0},
+    {-35384,-35384,-35384,0,0,0}, {0,-928,0,-928,-928,0}, {-38864,-38864,0,-38864,-38864,0}, {1,1,0,0,0,1},
+    {0,-1,0,0,0,1}, {40,40,40,0,0,0}, {0,-40,0,-40,-40,0}, {39,39,39,0,0,0},
+    {0,-39,0,-39,-39,0}, {34,34,34,0,0,0}, {0,-34,0,-34,-34,0}
+  };
+
+/* 5344 bytes in total. */
+
+static const uint8_t unicode_case_root[544] =
+  {
+    0,1,2,3,4,5,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,6,7,1,1,1,1,1,1,1,1,1,8,
+    9,10,1,11,1,1,1,1,1,1,1,1,1,12,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,13,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+  };
+
+static const uint8_t unicode_case_middle[14][32] =
+  {
+    {0,1,2,3,4,5,6,7,8,9,10,0,0,11,12,13,
+     14,15,16,17,18,19,20,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,21,22,0,0,0,0,0,0,0,0,0,0,23,24,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,25,0,0,26,27,0,28,29,30,28,31,32,33,34},
+    {0,0,0,0,35,36,37,0,0,0,0,0,0,0,0,0,
+     0,0,38,39,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     40,41,28,42,43,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,44,45,0,46,47,48,49},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,50,51,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,52,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,53,54,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     55,56,57,58,0,59,60,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,61,62,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,63,64,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,65,0,0,0,0,0,0},
+    {0,0,0,0,66,67,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
+  };
+
+static const uint8_t unicode_case_leaves[68][64] =
+  {
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+     0,2,2,2,2,2,2,2,2,2,2,3,2,2,2,2,
+     2,2,2,4,2,2,2,2,2,2,2,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,6,
+     2,2,2,2,2,7,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,8},
+    {9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     11,12,9,10,9,10,9,10,0,9,10,9,10,9,10,9},
+    {10,9,10,9,10,9,10,9,10,13,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,14,9,10,9,10,9,10,15},
+    {16,17,9,10,9,10,18,9,10,19,19,9,10,0,20,21,
+     22,9,10,19,23,24,25,26,9,10,27,0,25,28,29,30,
+     9,10,9,10,9,10,31,9,10,31,0,0,9,10,31,9,
+     10,32,32,9,10,9,10,33,9,10,0,0,9,10,0,34},
+    {0,0,0,0,35,36,37,35,36,37,35,36,37,9,10,9,
+     10,9,10,9,10,9,10,9,10,9,10,9,10,38,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     13,35,36,37,9,10,39,40,9,10,9,10,9,10,9,10},
+    {9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     41,0,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,0,0,0,0,0,0,42,9,10,43,44,45},
+    {45,9,10,46,47,48,9,10,9,10,9,10,9,10,9,10,
+     49,50,51,52,53,0,54,54,0,55,0,56,57,0,0,0,
+     54,58,0,59,0,60,61,0,62,63,61,64,65,0,0,63,
+     0,66,67,0,0,68,0,0,0,0,0,0,0,69,0,0},
+    {70,0,71,70,0,0,0,72,70,73,74,74,75,0,0,0,
+     0,0,76,0,0,0,0,0,0,0,0,0,0,77,78,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,79,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     9,10,9,10,0,0,9,10,0,0,0,29,29,29,0,80},
+    {0,0,0,0,0,0,81,0,82,82,82,0,83,0,84,84,
+     85,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,0,86,1,1,1,1,1,1,1,1,87,88,88,88,
+     89,2,90,2,2,91,2,2,92,93,94,2,95,2,2,2},
+    {96,97,98,2,2,2,99,2,2,100,2,2,101,102,102,103,
+     104,105,0,0,0,106,107,108,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     109,110,111,112,113,114,0,9,10,115,9,10,0,41,41,41},
+    {116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,116,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     2,2,117,2,118,2,2,2,2,2,2,2,2,2,119,2},
+    {2,120,120,2,2,2,2,2,2,2,121,2,2,2,2,2,
+     122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,122,
+     9,10,9,123,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10},
+    {9,10,0,0,0,0,0,0,0,0,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10},
+    {124,9,10,9,10,9,10,9,10,9,10,9,10,9,10,125,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10},
+    {9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     0,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126},
+    {126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,
+     126,126,126,126,126,126,126,0,0,0,0,0,0,0,0,0,
+     0,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
+     127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127},
+    {127,127,127,127,127,127,127,13,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,
+     128,128,128,128,128,128,128,128,128,128,128,128,128,128,128,128},
+    {128,128,128,128,128,128,0,128,0,0,0,0,0,128,0,0,
+     129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+     129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,129,
+     129,129,129,129,129,129,129,129,129,129,129,0,0,129,129,129},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+     130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130},
+    {130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+     130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+     130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,130,
+     131,131,131,131,131,131,0,0,132,132,132,132,132,132,0,0},
+    {133,134,135,136,137,138,139,140,141,0,0,0,0,0,0,0,
+     142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,
+     142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,142,
+     142,142,142,142,142,142,142,142,142,142,142,0,0,142,142,142},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,143,0,0,0,144,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,145,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10},
+    {9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,146,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10},
+    {9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,13,13,13,13,13,147,0,0,148,0,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10},
+    {149,149,149,149,149,149,149,149,150,150,150,150,150,150,150,150,
+     149,149,149,149,149,149,0,0,150,150,150,150,150,150,0,0,
+     149,149,149,149,149,149,149,149,150,150,150,150,150,150,150,150,
+     149,149,149,149,149,149,149,149,150,150,150,150,150,150,150,150},
+    {149,149,149,149,149,149,0,0,150,150,150,150,150,150,0,0,
+     13,149,13,149,13,149,13,149,0,150,0,150,0,150,0,150,
+     149,149,149,149,149,149,149,149,150,150,150,150,150,150,150,150,
+     151,151,152,152,152,152,153,153,154,154,155,155,156,156,0,0},
+    {157,157,157,157,157,157,157,157,158,158,158,158,158,158,158,158,
+     157,157,157,157,157,157,157,157,158,158,158,158,158,158,158,158,
+     157,157,157,157,157,157,157,157,158,158,158,158,158,158,158,158,
+     149,149,13,159,13,0,13,13,150,150,160,160,161,0,162,0},
+    {0,0,13,159,13,0,13,13,163,163,163,163,161,0,0,0,
+     149,149,13,164,0,0,13,13,150,150,165,165,0,0,0,0,
+     149,149,13,166,13,111,13,13,150,150,167,167,115,0,0,0,
+     0,0,13,159,13,0,13,13,168,168,169,169,161,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,170,0,0,0,171,172,0,0,0,0,
+     0,0,173,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,174,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,
+     176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176},
+    {0,0,0,9,10,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,177,177,177,177,177,177,177,177,177,177},
+    {177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,
+     178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,178,
+     178,178,178,178,178,178,178,178,178,178,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,
+     126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,
+     126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,126,
+     127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127},
+    {127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
+     127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,127,
+     9,10,179,180,181,182,183,9,10,9,10,9,10,184,185,186,
+     187,0,9,10,0,9,10,0,0,0,0,0,0,0,188,188},
+    {9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,0,0,0,0,0,0,0,9,10,9,10,0,
+     0,0,9,10,0,0,0,0,0,0,0,0,0,0,0,0},
+    {189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+     189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,189,
+     189,189,189,189,189,189,0,189,0,0,0,0,0,189,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {9,10,9,10,9,10,9,10,9,10,9,190,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     0,0,9,10,9,10,9,10,9,10,9,10,9,10,9,10},
+    {9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,9,10,9,10,9,10,
+     0,0,0,0,0,0,0,0,0,9,10,9,10,191,9,10},
+    {9,10,9,10,9,10,9,10,0,0,0,9,10,192,0,0,
+     9,10,9,10,193,0,9,10,9,10,9,10,9,10,9,10,
+     9,10,9,10,9,10,9,10,9,10,194,195,196,197,194,0,
+     198,199,200,201,9,10,9,10,9,10,9,10,9,10,9,10},
+    {9,10,9,10,202,203,204,9,10,9,10,0,0,0,0,0,
+     9,10,0,0,0,0,9,10,9,10,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,9,10,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,205,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206},
+    {206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+     206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+     206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,
+     206,206,206,206,206,206,206,206,206,206,206,206,206,206,206,206},
+    {13,13,13,13,13,207,208,0,0,0,0,0,0,0,0,0,
+     0,0,0,13,13,13,13,13,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0},
+    {0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,
+     209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,
+     209,209,209,209,209,209,209,209,210,210,210,210,210,210,210,210,
+     210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210},
+    {210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209},
+    {209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,209,
+     209,209,209,209,0,0,0,0,210,210,210,210,210,210,210,210,
+     210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,210,
+     210,210,210,210,210,210,210,210,210,210,210,210,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     211,211,211,211,211,211,211,211,211,211,211,0,211,211,211,211},
+    {211,211,211,211,211,211,211,211,211,211,211,0,211,211,211,211,
+     211,211,211,0,211,211,0,212,212,212,212,212,212,212,212,212,
+     212,212,0,212,212,212,212,212,212,212,212,212,212,212,212,212,
+     212,212,0,212,212,212,212,212,212,212,0,212,212,0,0,0},
+    {83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
+     83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
+     83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
+     83,83,83,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
+     101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
+     101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,101,
+     101,101,101,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1},
+    {2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+     2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2},
+    {213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,
+     213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,213,
+     213,213,214,214,214,214,214,214,214,214,214,214,214,214,214,214,
+     214,214,214,214,214,214,214,214,214,214,214,214,214,214,214,214},
+    {214,214,214,214,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}
+  };
+
+/* The code points with special case mappings. */
+static const uint32_t unicode_special_casing_keys[103] =
+  {
+    0x00DF, 0x0130, 0x0149, 0x01F0, 0x0390, 0x03B0, 0x0587, 0x1E96,
+    0x1E97, 0x1E98, 0x1E99, 0x1E9A, 0x1F50, 0x1F52, 0x1F54, 0x1F56,
+    0x1F80, 0x1F81, 0x1F82, 0x1F83, 0x1F84, 0x1F85, 0x1F86, 0x1F87,
+    0x1F88, 0x1F89, 0x1F8A, 0x1F8B, 0x1F8C, 0x1F8D, 0x1F8E, 0x1F8F,
+    0x1F90, 0x1F91, 0x1F92, 0x1F93, 0x1F94, 0x1F95, 0x1F96, 0x1F97,
+    0x1F98, 0x1F99, 0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F,
+    0x1FA0, 0x1FA1, 0x1FA2, 0x1FA3, 0x1FA4, 0x1FA5, 0x1FA6, 0x1FA7,
+    0x1FA8, 0x1FA9, 0x1FAA, 0x1FAB, 0x1FAC, 0x1FAD, 0x1FAE, 0x1FAF,
+    0x1FB2, 0x1FB3, 0x1FB4, 0x1FB6, 0x1FB7, 0x1FBC, 0x1FC2, 0x1FC3,
+    0x1FC4, 0x1FC6, 0x1FC7, 0x1FCC, 0x1FD2, 0x1FD3, 0x1FD6, 0x1FD7,
+    0x1FE2, 0x1FE3, 0x1FE4, 0x1FE6, 0x1FE7, 0x1FF2, 0x1FF3, 0x1FF4,
+    0x1FF6, 0x1FF7, 0x1FFC, 0xFB00, 0xFB01, 0xFB02, 0xFB03, 0xFB04,
+    0xFB05, 0xFB06, 0xFB13, 0xFB14, 0xFB15, 0xFB16, 0xFB17
+  };
+
+/* The lower, upper and title case mappings of the code points in
+ * unicode_special_casing_keys, each terminated by a zero unless it
+ * is three code points long. */
+static const uint32_t unicode_special_casing[103][3][3] =
+  {
+    {{0x00DF, 0x0000, 0x0000}, {0x0053, 0x0053, 0x0000}, {0x0053, 0x0073, 0x0000}},
+    {{0x0069, 0x0307, 0x0000}, {0x0130, 0x0000, 0x0000}, {0x0130, 0x0000, 0x0000}},
+    {{0x0149, 0x0000, 0x0000}, {0x02BC, 0x004E, 0x0000}, {0x02BC, 0x004E, 0x0000}},
+    {{0x01F0, 0x0000, 0x0000}, {0x004A, 0x030C, 0x0000}, {0x004A, 0x030C, 0x0000}},
+    {{0x0390, 0x0000, 0x0000}, {0x0399, 0x0308, 0x0301}, {0x0399, 0x0308, 0x0301}},
+    {{0x03B0, 0x0000, 0x0000}, {0x03A5, 0x0308, 0x0301}, {0x03A5, 0x0308, 0x0301}},
+    {{0x0587, 0x0000, 0x0000}, {0x0535, 0x0552, 0x0000}, {0x0535, 0x0582, 0x0000}},
+    {{0x1E96, 0x0000, 0x0000}, {0x0048, 0x0331, 0x0000}, {0x0048, 0x0331, 0x0000}},
+    {{0x1E97, 0x0000, 0x0000}, {0x0054, 0x0308, 0x0000}, {0x0054, 0x0308, 0x0000}},
+    {{0x1E98, 0x0000, 0x0000}, {0x0057, 0x030A, 0x0000}, {0x0057, 0x030A, 0x0000}},
+    {{0x1E99, 0x0000, 0x0000}, {0x0059, 0x030A, 0x0000}, {0x0059, 0x030A, 0x0000}},
+    {{0x1E9A, 0x0000, 0x0000}, {0x0041, 0x02BE, 0x0000}, {0x0041, 0x02BE, 0x0000}},
+    {{0x1F50, 0x0000, 0x0000}, {0x03A5, 0x0313, 0x0000}, {0x03A5, 0x0313, 0x0000}},
+    {{0x1F52, 0x0000, 0x0000}, {0x03A5, 0x0313, 0x0300}, {0x03A5, 0x0313, 0x0300}},
+    {{0x1F54, 0x0000, 0x0000}, {0x03A5, 0x0313, 0x0301}, {0x03A5, 0x0313, 0x0301}},
+    {{0x1F56, 0x0000, 0x0000}, {0x03A5, 0x0313, 0x0342}, {0x03A5, 0x0313, 0x0342}},
+    {{0x1F80, 0x0000, 0x0000}, {0x1F08, 0x0399, 0x0000}, {0x1F88, 0x0000, 0x0000}},
+    {{0x1F81, 0x0000, 0x0000}, {0x1F09, 0x0399, 0x0000}, {0x1F89, 0x0000, 0x0000}},
+    {{0x1F82, 0x0000, 0x0000}, {0x1F0A, 0x0399, 0x0000}, {0x1F8A, 0x0000, 0x0000}},
+    {{0x1F83, 0x0000, 0x0000}, {0x1F0B, 0x0399, 0x0000}, {0x1F8B, 0x0000, 0x0000}},
+    {{0x1F84, 0x0000, 0x0000}, {0x1F0C, 0x0399, 0x0000}, {0x1F8C, 0x0000, 0x0000}},
+    {{0x1F85, 0x0000, 0x0000}, {0x1F0D, 0x0399, 0x0000}, {0x1F8D, 0x0000, 0x0000}},
+    {{0x1F86, 0x0000, 0x0000}, {0x1F0E, 0x0399, 0x0000}, {0x1F8E, 0x0000, 0x0000}},
+    {{0x1F87, 0x0000, 0x0000}, {0x1F0F, 0x0399, 0x0000}, {0x1F8F, 0x0000, 0x0000}},
+    {{0x1F80, 0x0000, 0x0000}, {0x1F08, 0x0399, 0x0000}, {0x1F88, 0x0000, 0x0000}},
+    {{0x1F81, 0x0000, 0x0000}, {0x1F09, 0x0399, 0x0000}, {0x1F89, 0x0000, 0x0000}},
+    {{0x1F82, 0x0000, 0x0000}, {0x1F0A, 0x0399, 0x0000}, {0x1F8A, 0x0000, 0x0000}},
+    {{0x1F83, 0x0000, 0x0000}, {0x1F0B, 0x0399, 0x0000}, {0x1F8B, 0x0000, 0x0000}},
+    {{0x1F84, 0x0000, 0x0000}, {0x1F0C, 0x0399, 0x0000}, {0x1F8C, 0x0000, 0x0000}},
+    {{0x1F85, 0x0000, 0x0000}, {0x1F0D, 0x0399, 0x0000}, {0x1F8D, 0x0000, 0x0000}},
+    {{0x1F86, 0x0000, 0x0000}, {0x1F0E, 0x0399, 0x0000}, {0x1F8E, 0x0000, 0x0000}},
+    {{0x1F87, 0x0000, 0x0000}, {0x1F0F, 0x0399, 0x0000}, {0x1F8F, 0x0000, 0x0000}},
+    {{0x1F90, 0x0000, 0x0000}, {0x1F28, 0x0399, 0x0000}, {0x1F98, 0x0000, 0x0000}},
+    {{0x1F91, 0x0000, 0x0000}, {0x1F29, 0x0399, 0x0000}, {0x1F99, 0x0000, 0x0000}},
+    {{0x1F92, 0x0000, 0x0000}, {0x1F2A, 0x0399, 0x0000}, {0x1F9A, 0x0000, 0x0000}},
+    {{0x1F93, 0x0000, 0x0000}, {0x1F2B, 0x0399, 0x0000}, {0x1F9B, 0x0000, 0x0000}},
+    {{0x1F94, 0x0000, 0x0000}, {0x1F2C, 0x0399, 0x0000}, {0x1F9C, 0x0000, 0x0000}},
+    {{0x1F95, 0x0000, 0x0000}, {0x1F2D, 0x0399, 0x0000}, {0x1F9D, 0x0000, 0x0000}},
+    {{0x1F96, 0x0000, 0x0000}, {0x1F2E, 0x0399, 0x0000}, {0x1F9E, 0x0000, 0x0000}},
+    {{0x1F97, 0x0000, 0x0000}, {0x1F2F, 0x0399, 0x0000}, {0x1F9F, 0x0000, 0x0000}},
+    {{0x1F90, 0x0000, 0x0000}, {0x1F28, 0x0399, 0x0000}, {0x1F98, 0x0000, 0x0000}},
+    {{0x1F91, 0x0000, 0x0000}, {0x1F29, 0x0399, 0x0000}, {0x1F99, 0x0000, 0x0000}},
+    {{0x1F92, 0x0000, 0x0000}, {0x1F2A, 0x0399, 0x0000}, {0x1F9A, 0x0000, 0x0000}},
+    {{0x1F93, 0x0000, 0x0000}, {0x1F2B, 0x0399, 0x0000}, {0x1F9B, 0x0000, 0x0000}},
+    {{0x1F94, 0x0000, 0x0000}, {0x1F2C, 0x0399, 0x0000}, {0x1F9C, 0x0000, 0x0000}},
+    {{0x1F95, 0x0000, 0x0000}, {0x1F2D, 0x0399, 0x0000}, {0x1F9D, 0x0000, 0x0000}},
+    {{0x1F96, 0x0000, 0x0000}, {0x1F2E, 0x0399, 0x0000}, {0x1F9E, 0x0000, 0x0000}},
+    {{0x1F97, 0x0000, 0x0000}, {0x1F2F, 0x0399, 0x0000}, {0x1F9F, 0x0000, 0x0000}},
+    {{0x1FA0, 0x0000, 0x0000}, {0x1F68, 0x0399, 0x0000}, {0x1FA8, 0x0000, 0x0000}},
+    {{0x1FA1, 0x0000, 0x0000}, {0x1F69, 0x0399, 0x0000}, {0x1FA9, 0x0000, 0x0000}},
+    {{0x1FA2, 0x0000, 0x0000}, {0x1F6A, 0x0399, 0x0000}, {0x1FAA, 0x0000, 0x0000}},
+    {{0x1FA3, 0x0000, 0x0000}, {0x1F6B, 0x0399, 0x0000}, {0x1FAB, 0x0000, 0x0000}},
+    {{0x1FA4, 0x0000, 0x0000}, {0x1F6C, 0x0399, 0x0000}, {0x1FAC, 0x0000, 0x0000}},
+    {{0x1FA5, 0x0000, 0x0000}, {0x1F6D, 0x0399, 0x0000}, {0x1FAD, 0x0000, 0x0000}},
+    {{0x1FA6, 0x0000, 0x0000}, {0x1F6E, 0x0399, 0x0000}, {0x1FAE, 0x0000, 0x0000}},
+    {{0x1FA7, 0x0000, 0x0000}, {0x1F6F, 0x0399, 0x0000}, {0x1FAF, 0x0000, 0x0000}},
+    {{0x1FA0, 0x0000, 0x0000}, {0x1F68, 0x0399, 0x0000}, {0x1FA8, 0x0000, 0x0000}},
+    {{0x1FA1, 0x0000, 0x0000}, {0x1F69, 0x0399, 0x0000}, {0x1FA9, 0x0000, 0x0000}},
+    {{0x1FA2, 0x0000, 0x0000}, {0x1F6A, 0x0399, 0x0000}, {0x1FAA, 0x0000, 0x0000}},
+    {{0x1FA3, 0x0000, 0x0000}, {0x1F6B, 0x0399, 0x0000}, {0x1FAB, 0x0000, 0x0000}},
+    {{0x1FA4, 0x0000, 0x0000}, {0x1F6C, 0x0399, 0x0000}, {0x1FAC, 0x0000, 0x0000}},
+    {{0x1FA5, 0x0000, 0x0000}, {0x1F6D, 0x0399, 0x0000}, {0x1FAD, 0x0000, 0x0000}},
+    {{0x1FA6, 0x0000, 0x0000}, {0x1F6E, 0x0399, 0x0000}, {0x1FAE, 0x0000, 0x0000}},
+    {{0x1FA7, 0x0000, 0x0000}, {0x1F6F, 0x0399, 0x0000}, {0x1FAF, 0x0000, 0x0000}},
+    {{0x1FB2, 0x0000, 0x0000}, {0x1FBA, 0x0399, 0x0000}, {0x1FBA, 0x0345, 0x0000}},
+    {{0x1FB3, 0x0000, 0x0000}, {0x0391, 0x0399, 0x0000}, {0x1FBC, 0x0000, 0x0000}},
+    {{0x1FB4, 0x0000, 0x0000}, {0x0386, 0x0399, 0x0000}, {0x0386, 0x0345, 0x0000}},
+    {{0x1FB6, 0x0000, 0x0000}, {0x0391, 0x0342, 0x0000}, {0x0391, 0x0342, 0x0000}},
+    {{0x1FB7, 0x0000, 0x0000}, {0x0391, 0x0342, 0x0399}, {0x0391, 0x0342, 0x0345}},
+    {{0x1FB3, 0x0000, 0x0000}, {0x0391, 0x0399, 0x0000}, {0x1FBC, 0x0000, 0x0000}},
+    {{0x1FC2, 0x0000, 0x0000}, {0x1FCA, 0x0399, 0x0000}, {0x1FCA, 0x0345, 0x0000}},
+    {{0x1FC3, 0x0000, 0x0000}, {0x0397, 0x0399, 0x0000}, {0x1FCC, 0x0000, 0x0000}},
+    {{0x1FC4, 0x0000, 0x0000}, {0x0389, 0x0399, 0x0000}, {0x0389, 0x0345, 0x0000}},
+    {{0x1FC6, 0x0000, 0x0000}, {0x0397, 0x0342, 0x0000}, {0x0397, 0x0342, 0x0000}},
+    {{0x1FC7, 0x0000, 0x0000}, {0x0397, 0x0342, 0x0399}, {0x0397, 0x0342, 0x0345}},
+    {{0x1FC3, 0x0000, 0x0000}, {0x0397, 0x0399, 0x0000}, {0x1FCC, 0x0000, 0x0000}},
+    {{0x1FD2, 0x0000, 0x0000}, {0x0399, 0x0308, 0x0300}, {0x0399, 0x0308, 0x0300}},
+    {{0x1FD3, 0x0000, 0x0000}, {0x0399, 0x0308, 0x0301}, {0x0399, 0x0308, 0x0301}},
+    {{0x1FD6, 0x0000, 0x0000}, {0x0399, 0x0342, 0x0000}, {0x0399, 0x0342, 0x0000}},
+    {{0x1FD7, 0x0000, 0x0000}, {0x0399, 0x0308, 0x0342}, {0x0399, 0x0308, 0x0342}},
+    {{0x1FE2, 0x0000, 0x0000}, {0x03A5, 0x0308, 0x0300}, {0x03A5, 0x0308, 0x0300}},
+    {{0x1FE3, 0x0000, 0x0000}, {0x03A5, 0x0308, 0x0301}, {0x03A5, 0x0308, 0x0301}},
+    {{0x1FE4, 0x0000, 0x0000}, {0x03A1, 0x0313, 0x0000}, {0x03A1, 0x0313, 0x0000}},
+    {{0x1FE6, 0x0000, 0x0000}, {0x03A5, 0x0342, 0x0000}, {0x03A5, 0x0342, 0x0000}},
+    {{0x1FE7, 0x0000, 0x0000}, {0x03A5, 0x0308, 0x0342}, {0x03A5, 0x0308, 0x0342}},
+    {{0x1FF2, 0x0000, 0x0000}, {0x1FFA, 0x0399, 0x0000}, {0x1FFA, 0x0345, 0x0000}},
+    {{0x1FF3, 0x0000, 0x0000}, {0x03A9, 0x0399, 0x0000}, {0x1FFC, 0x0000, 0x0000}},
+    {{0x1FF4, 0x0000, 0x0000}, {0x038F, 0x0399, 0x0000}, {0x038F, 0x0345, 0x0000}},
+    {{0x1FF6, 0x0000, 0x0000}, {0x03A9, 0x0342, 0x0000}, {0x03A9, 0x0342, 0x0000}},
+    {{0x1FF7, 0x0000, 0x0000}, {0x03A9, 0x0342, 0x0399}, {0x03A9, 0x0342, 0x0345}},
+    {{0x1FF3, 0x0000, 0x0000}, {0x03A9, 0x0399, 0x0000}, {0x1FFC, 0x0000, 0x0000}},
+    {{0xFB00, 0x0000, 0x0000}, {0x0046, 0x0046, 0x0000}, {0x0046, 0x0066, 0x0000}},
+    {{0xFB01, 0x0000, 0x0000}, {0x0046, 0x0049, 0x0000}, {0x0046, 0x0069, 0x0000}},
+    {{0xFB02, 0x0000, 0x0000}, {0x0046, 0x004C, 0x0000}, {0x0046, 0x006C, 0x0000}},
+    {{0xFB03, 0x0000, 0x0000}, {0x0046, 0x0046, 0x0049}, {0x0046, 0x0066, 0x0069}},
+    {{0xFB04, 0x0000, 0x0000}, {0x0046, 0x0046, 0x004C}, {0x0046, 0x0066, 0x006C}},
+    {{0xFB05, 0x0000, 0x0000}, {0x0053, 0x0054, 0x0000}, {0x0053, 0x0074, 0x0000}},
+    {{0xFB06, 0x0000, 0x0000}, {0x0053, 0x0054, 0x0000}, {0x0053, 0x0074, 0x0000}},
+    {{0xFB13, 0x0000, 0x0000}, {0x0544, 0x0546, 0x0000}, {0x0544, 0x0576, 0x0000}},
+    {{0xFB14, 0x0000, 0x0000}, {0x0544, 0x0535, 0x0000}, {0x0544, 0x0565, 0x0000}},
+    {{0xFB15, 0x0000, 0x0000}, {0x0544, 0x053B, 0x0000}, {0x0544, 0x056B, 0x0000}},
+    {{0xFB16, 0x0000, 0x0000}, {0x054E, 0x0546, 0x0000}, {0x054E, 0x0576, 0x0000}},
+    {{0xFB17, 0x0000, 0x0000}, {0x0544, 0x053D, 0x0000}, {0x0544, 0x056D, 0x0000}}
+  };
+
+/* 15808 bytes in total. */
+
+static const uint8_t unicode_grapheme_root[544] =
+  {
+    0,1,2,3,4,5,6,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,8,9,10,11,12,13,14,7,7,7,7,15,
+    16,17,18,19,7,7,20,7,7,7,7,7,21,22,7,7,
+    7,7,7,7,7,7,7,23,7,24,25,26,27,28,29,30,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    31,32,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+    7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7
+  };
+
+static const uint8_t unicode_grapheme_middle[33][32] =
+  {
+    {0,1,2,3,3,3,3,3,3,3,3,3,4,5,3,3,
+     3,3,6,3,3,3,7,8,9,10,3,11,12,13,14,15},
+    {16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+     32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47},
+    {48,49,50,3,51,52,53,54,3,3,3,3,3,55,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,56,57,58,59},
+    {60,3,61,3,62,3,3,3,63,64,65,66,67,68,69,70,
+     71,3,3,72,3,3,3,4,3,3,3,3,3,3,3,3},
+    {73,74,3,75,76,3,77,3,3,3,3,3,78,3,79,80,
+     3,3,3,81,3,3,82,83,84,85,86,85,87,88,89,3},
+    {3,3,3,3,90,3,3,3,3,3,3,3,91,92,3,3,
+     3,3,3,93,3,94,3,95,3,3,3,3,3,3,3,3},
+    {96,3,97,3,3,3,3,3,3,3,98,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,99,100,101,3,3,3,3},
+    {102,3,103,104,105,106,107,108,109,110,111,112,3,3,3,113,
+     114,115,116,117,118,119,120,114,115,116,117,118,119,120,114,115},
+    {116,117,118,119,120,114,115,116,117,118,119,120,114,115,116,117,
+     118,119,120,114,115,116,117,118,119,120,114,115,116,117,118,119},
+    {120,114,115,116,117,118,119,120,114,115,116,117,118,119,120,114,
+     115,116,117,118,119,120,114,115,116,117,118,119,120,114,115,116},
+    {117,118,119,120,114,115,116,117,118,119,120,114,115,116,117,118,
+     119,120,114,115,116,117,118,119,120,114,115,116,117,118,119,120},
+    {114,115,116,117,118,119,120,114,115,116,117,118,119,120,114,115,
+     116,117,118,119,120,114,115,116,117,118,119,120,114,115,116,117},
+    {118,119,120,114,115,116,117,118,119,120,114,115,116,117,118,119,
+     120,114,115,116,117,118,119,120,114,115,116,117,118,119,121,122},
+    {3,3,3,3,3,3,3,3,3,3,3,3,123,3,3,3,
+     3,3,3,3,3,3,3,3,124,3,3,1,3,3,100,125},
+    {3,3,3,3,3,3,3,126,3,3,3,127,3,128,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,3,3,3,3,129,3,3,130,3,3,3,3,
+     3,3,3,3,131,132,3,3,3,3,133,134,3,135,136,3},
+    {137,138,139,140,141,142,143,144,145,146,3,147,148,149,150,151,
+     152,153,154,155,3,3,156,157,158,159,160,3,161,3,3,3},
+    {162,3,3,3,163,164,3,165,166,167,168,3,3,3,3,3,
+     169,3,170,3,171,172,173,3,3,3,3,174,175,176,3,3},
+    {3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     177,178,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,179,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,3,3,3,3,3,3,3,180,181,3,3,3,
+     3,3,3,3,3,182,3,3,3,3,3,3,3,183,184,185},
+    {3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,186,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,187,188,3,3},
+    {3,3,3,3,3,189,190,3,3,191,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {3,3,3,3,3,3,3,3,192,193,194,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {195,3,196,3,181,3,3,3,3,3,197,198,3,3,3,3,
+     3,3,3,198,3,3,3,199,3,3,3,3,3,3,3,3},
+    {3,3,3,200,3,201,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {85,85,85,85,202,203,204,205,206,207,85,85,85,85,85,208,
+     85,85,85,85,209,210,85,85,85,211,85,85,3,212,3,213},
+    {214,215,216,85,217,218,85,85,85,85,85,85,3,3,3,3,
+     85,85,85,85,85,85,85,85,85,85,85,85,85,85,85,209},
+    {219,4,220,220,4,4,4,221,220,220,220,220,220,220,220,220,
+     220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220},
+    {220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,
+     220,220,220,220,220,220,220,220,220,220,220,220,220,220,220,220}
+  };
+
+static const uint8_t unicode_grapheme_leaves[222][64] =
+  {
+    {3,3,3,3,3,3,3,3,3,3,2,3,3,1,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3},
+    {3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     0,0,0,0,0,0,0,0,0,16,0,0,0,3,16,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68},
+    {68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,68,68,68,68,68,68,68,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,0,68},
+    {0,68,68,0,68,68,0,68,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {7,7,7,7,7,7,0,0,0,0,0,0,0,0,0,0,
+     68,68,68,68,68,68,68,68,68,68,68,0,3,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,68,68,68,68,68,68,68,7,0,68,
+     68,68,68,68,68,0,0,68,68,0,68,68,68,68,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,
+     0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68},
+    {68,68,68,68,68,68,68,68,68,68,68,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,68,68,68,68,68,68,68,68,68,68,
+     68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,68,68,68,68,68,
+     68,68,68,68,0,0,0,0,0,0,0,0,0,68,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,68,68,68,68,0,68,68,68,68,68,
+     68,68,68,68,0,68,68,68,0,68,68,68,68,68,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,68,68,68,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     7,7,0,0,0,0,0,68,68,68,68,68,68,68,68,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,7,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68},
+    {68,68,68,8,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,32,32,32,32,32,32,32,32,32,32,32,
+     32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+     32,32,32,32,32,32,32,32,32,32,68,8,68,0,8,8},
+    {8,68,68,68,68,68,68,68,68,8,8,8,8,100,8,8,
+     0,68,68,68,68,68,68,68,32,32,32,32,32,32,32,32,
+     0,0,68,68,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,32,32,32,32,32,32,32,32},
+    {0,68,8,8,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,32,32,32,32,32,32,32,32,32,32,32,
+     32,32,32,32,32,32,32,32,32,0,32,32,32,32,32,32,
+     32,0,32,0,0,0,32,32,32,32,0,0,68,0,68,8},
+    {8,68,68,68,68,0,0,8,8,0,0,8,8,100,0,0,
+     0,0,0,0,0,0,0,68,0,0,0,0,32,32,0,32,
+     0,0,68,68,0,0,0,0,0,0,0,0,0,0,0,0,
+     32,32,0,0,0,0,0,0,0,0,0,0,0,0,68,0},
+    {0,68,68,8,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,68,0,8,8},
+    {8,68,68,0,0,0,0,68,68,0,0,68,68,68,0,0,
+     0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,0,0,0,68,0,0,0,0,0,0,0,0,0,0},
+    {0,68,68,8,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,32,32,32,32,32,32,32,32,32,32,32,
+     32,32,32,32,32,32,32,32,32,0,32,32,32,32,32,32,
+     32,0,32,32,0,32,32,32,32,32,0,0,68,0,8,8},
+    {8,68,68,68,68,68,0,68,68,8,0,8,8,100,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,68,68,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,32,68,68,68,68,68,68},
+    {0,68,8,8,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,32,32,32,32,32,32,32,32,32,32,32,
+     32,32,32,32,32,32,32,32,32,0,32,32,32,32,32,32,
+     32,0,32,32,0,32,32,32,32,32,0,0,68,0,68,68},
+    {8,68,68,68,68,0,0,8,8,0,0,8,8,100,0,0,
+     0,0,0,0,0,68,68,68,0,0,0,0,32,32,0,32,
+     0,0,68,68,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,8},
+    {68,8,8,0,0,0,8,8,8,0,8,8,8,68,0,0,
+     0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {68,8,8,8,68,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,32,32,32,32,32,32,32,32,32,32,32,
+     32,32,32,32,32,32,32,32,32,0,32,32,32,32,32,32,
+     32,32,32,32,32,32,32,32,32,32,0,0,68,0,68,68},
+    {68,8,8,8,8,0,68,68,68,0,68,68,68,100,0,0,
+     0,0,0,0,0,68,68,0,32,32,32,0,0,0,0,0,
+     0,0,68,68,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,68,8,8,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,68,0,8,68},
+    {68,8,68,8,8,0,68,68,68,0,68,68,68,68,0,0,
+     0,0,0,0,0,68,68,0,0,0,0,0,0,0,0,0,
+     0,0,68,68,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0},
+    {68,68,8,8,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,32,32,32,32,32,32,32,32,32,32,32,
+     32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+     32,32,32,32,32,32,32,32,32,32,32,68,68,0,68,8},
+    {8,68,68,68,68,0,8,8,8,0,8,8,8,100,7,0,
+     0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,
+     0,0,68,68,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,68,8,8,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,68,
+     8,8,68,68,68,0,68,0,8,8,8,8,8,8,8,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,8,8,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,68,0,8,68,68,68,68,68,68,68,0,0,0,0,0},
+    {0,0,0,0,0,0,0,68,68,68,68,68,68,68,68,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,68,0,8,68,68,68,68,68,68,68,68,68,0,0,0},
+    {0,0,0,0,0,0,0,0,68,68,68,68,68,68,68,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,68,68,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,68,0,68,0,68,0,0,0,0,8,8},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,68,68,68,68,68,68,68,68,68,68,68,68,68,68,8},
+    {68,68,68,68,68,0,68,68,0,0,0,0,0,68,68,68,
+     68,68,68,68,68,68,68,68,0,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,0,0,0},
+    {0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,68,68,68,
+     68,8,68,68,68,68,68,68,0,68,68,8,8,68,68,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,8,8,68,68,0,0,0,0,68,68,
+     68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,68,68,68,68,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,68,0,8,68,68,0,0,0,0,0,0,68,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+     9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+     9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+     9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9},
+    {9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+     9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+     10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+     10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10},
+    {10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+     10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,
+     10,10,10,10,10,10,10,10,11,11,11,11,11,11,11,11,
+     11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11},
+    {11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+     11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+     11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+     11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,68,68,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,68,68,68,68,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,68,68,68,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,68,68,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,68,68,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,68,68,8,68,68,68,68,68,68,68,8,8},
+    {8,8,8,8,8,8,68,8,8,68,68,68,68,68,68,68,
+     68,68,68,68,0,0,0,0,0,0,0,0,0,68,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,68,68,68,3,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,68,68,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,68,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,68,8,8,8,8,68,68,8,8,8,0,0,0,0,
+     8,8,68,8,8,8,8,8,8,68,68,68,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,68,68,8,8,68,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,8,68,8,68,68,68,68,68,68,68,0,
+     68,0,68,0,0,68,68,68,68,68,68,68,68,8,8,8,
+     8,8,8,68,68,68,68,68,68,68,68,68,68,0,0,68},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68},
+    {68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {68,68,68,68,8,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,68,68,68,68,68,68,68,68,68,68,8,8},
+    {8,8,68,68,68,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,68,68,68,68,68,
+     68,68,68,68,0,0,0,0,0,0,0,0,0,0,0,0},
+    {68,68,8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,8,68,68,68,68,8,8,68,68,68,68,68,68,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,68,8,68,68,8,8,8,68,8,68,
+     68,68,68,68,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,8,8,8,8,8,8,8,8,68,68,68,68,
+     68,68,68,68,8,8,68,68,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,68,0,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,8,68,68,68,68,68,68,68,0,0,0,0,68,0,0,
+     0,0,0,0,68,0,0,8,68,68,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,3,4,69,3,3,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,3,3,3,3,3,3,3,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0},
+    {0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,16,16,16,16,16,16,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,16,16,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,16,16,0,0,0,0,
+     0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,
+     16,16,16,16,0,0,0,0,16,16,16,0,0,0,0,0},
+    {0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,16,16,0,0,0,0,
+     0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0},
+    {16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,0},
+    {16,16,16,16,16,16,0,16,16,16,16,16,16,16,16,16,
+     16,16,16,0,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16},
+    {16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16},
+    {16,16,16,16,16,16,0,0,0,0,0,0,0,0,0,0,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16},
+    {16,16,16,16,16,16,0,0,16,16,16,16,16,16,16,16,
+     16,16,16,0,16,0,16,0,0,0,0,0,0,16,0,0,
+     0,16,0,0,0,0,0,0,16,0,0,0,0,0,0,0,
+     0,0,0,16,16,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,16,0,0,16,0,0,0,0,16,0,16,0,
+     0,0,0,16,16,16,0,16,0,0,0,0,0,0,0,0,
+     0,0,0,16,16,16,16,16,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,16,16,16,0,0,0,0,0,0,0,0,
+     0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,16,16,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,16,16,16,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,16,16,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     16,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,
+     68,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,68,68,68,68,68,68,
+     16,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,68,68,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,16,0,16,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,
+     68,68,68,0,68,68,68,68,68,68,68,68,68,68,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,68,0,0,0,68,0,0,0,0,68,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,8,8,68,68,8,0,0,0,0,68,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {8,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,8,8,8,8,8,8,8,8,8,8,8,8},
+    {8,8,8,8,68,68,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,0,0,0,0,0,0,0,0,0,0,0,0,0,68},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,68,68,68,68,68,68,68,68,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,68,68,68,68,68,68,68,68,68,
+     68,68,8,68,0,0,0,0,0,0,0,0,0,0,0,0,
+     9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,
+     9,9,9,9,9,9,9,9,9,9,9,9,9,0,0,0},
+    {68,68,68,8,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,68,8,8,68,68,68,68,8,8,68,68,8,8},
+    {68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,68,68,68,68,68,68,8,
+     8,68,68,8,8,68,68,0,0,0,0,0,0,0,0,0},
+    {0,0,0,68,0,0,0,0,0,0,0,0,68,8,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,0,68,68,68,0,0,68,68,0,0,0,0,0,68,68},
+    {0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,8,68,68,8,8,
+     0,0,0,0,0,8,68,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,8,8,68,8,8,68,8,8,0,8,68,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,13,13,13,13,13,13,13,13,13,12,13,13,13,
+     13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,13,13,13,13,13,12,13,13,13,13,13,13,13},
+    {13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,13,12,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13},
+    {13,13,13,13,13,13,13,13,13,13,13,13,12,13,13,13,
+     13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,13,13,13,13,13,12,13,13,13,13,13,13,13,
+     13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13},
+    {13,13,13,13,12,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,13,13,13,13,13,13,13,13,13,12,13,13,13},
+    {13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,13,13,13,13,13,12,13,13,13,13,13,13,13,
+     13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,13,12,13,13,13,13,13,13,13,13,13,13,13},
+    {13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     12,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,13,13,13,13,13,13,13,13,13,12,13,13,13,
+     13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13},
+    {13,13,13,13,13,13,13,13,12,13,13,13,13,13,13,13,
+     13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,13,12,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13},
+    {13,13,13,13,13,13,13,13,12,13,13,13,13,13,13,13,
+     13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,13,
+     13,13,13,13,0,0,0,0,0,0,0,0,0,0,0,0,
+     10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10},
+    {10,10,10,10,10,10,10,0,0,0,0,11,11,11,11,11,
+     11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+     11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,
+     11,11,11,11,11,11,11,11,11,11,11,11,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     3,3,3,3,3,3,3,3,3,3,3,3,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,68,68,68,68,68,0,0,0,0,0},
+    {0,68,68,68,0,68,68,0,0,0,0,0,68,68,68,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,68,68,68,0,0,0,0,68},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,68,68,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,68,68,68,68,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,68,68,68,68,68,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,68,68,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,68,68,68,68},
+    {0,0,0,0,0,0,68,68,68,68,68,68,68,68,68,68,
+     68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,68,68,68,68,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {8,68,8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,68,68,68,68,68,68,68,68},
+    {68,68,68,68,68,68,68,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,0,0,68,68,0,0,0,0,0,0,0,0,0,0,68},
+    {68,68,8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     8,8,8,68,68,68,68,8,8,68,68,0,0,7,0,0},
+    {0,0,68,0,0,0,0,0,0,0,0,0,0,7,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {68,68,68,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,68,68,68,68,68,8,68,68,68,
+     68,68,68,68,68,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,8,8,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0},
+    {68,68,8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,8,8,8,68,68,68,68,68,68,68,68,68,8},
+    {68,0,7,7,0,0,0,0,0,68,68,68,68,0,8,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,8,8,8,68,
+     68,68,8,8,68,68,68,68,0,0,0,0,0,0,68,0},
+    {0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,
+     8,8,8,68,68,68,68,68,68,68,68,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {68,68,8,8,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,68,68,0,68,8},
+    {68,8,8,8,8,0,0,8,8,0,0,8,8,68,0,0,
+     0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,
+     0,0,8,8,0,0,68,68,68,68,68,68,68,0,0,0,
+     68,68,68,68,68,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,68,8,8,68,68,68,68,68},
+    {68,0,68,0,0,68,0,68,68,68,8,0,8,8,68,68,
+     68,7,68,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,68,68,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,8,8,8,68,68,68,68,68,68,68,68},
+    {8,8,68,68,68,8,68,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,8,8,68,68,68,68,68,68,8,68,8,8,68,8,68},
+    {68,8,68,68,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,
+     8,8,68,68,68,68,0,0,8,8,8,8,68,68,8,68},
+    {68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,68,68,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     8,8,8,68,68,68,68,68,68,68,68,8,8,68,8,68},
+    {68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,68,8,68,8,8,
+     68,68,68,68,68,68,68,68,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,68,8,68,
+     0,0,68,68,68,68,8,68,68,68,68,68,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,8,8,8,68,
+     68,68,68,68,68,68,68,68,8,68,68,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,8,8,8,8,8,0,8,8,0,0,68,68,68,68,7},
+    {8,7,8,68,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,8,8,8,68,68,68,68,0,0,68,68,8,8,8,8,
+     68,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,68,68,68,68,68,68,68,68,68,68,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,68,68,68,68,68,68,8,7,68,68,68,68,0},
+    {0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,
+     0,68,68,68,68,68,68,8,8,68,68,68,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,7,7,7,7,7,7,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,8,68,68,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,
+     68,68,68,68,68,68,68,0,68,68,68,68,68,68,8,68},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,0,8,68,68,68,68,68,68,
+     68,8,68,68,8,68,68,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,68,68,68,68,68,68,0,0,0,68,0,68,68,0,68},
+    {68,68,68,68,68,68,7,68,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,8,8,8,8,8,0,
+     68,68,0,8,8,68,8,68,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,68,68,8,8,0,0,0,0,0,0,0,0,0},
+    {68,68,7,8,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,8,8,68,68,68,68,68,0,0,0,8,8},
+    {68,68,68,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {68,0,0,0,0,0,0,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,68,
+     68,68,68,68,68,68,68,68,68,68,8,8,8,68,68,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,68,68,68,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,68,68,68,68,68,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,10,0,0,0,10,10,10,10,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,
+     0,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+     8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+     8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8},
+    {8,8,8,8,8,8,8,8,0,0,0,0,0,0,0,68,
+     68,68,68,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,68,68,0,
+     3,3,3,3,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,0,0,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68},
+    {68,68,68,68,68,68,68,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,68,68,68,68,68,0,0,0,68,68,68,
+     68,68,68,3,3,3,3,3,3,3,3,68,68,68,68,68},
+    {68,68,68,0,0,68,68,68,68,68,68,68,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,68,68,68,68,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,68,68,68,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,0,0,0,0,68,68,68,68,68},
+    {68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,0,0,0,
+     0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,68,68,68,68,68,
+     0,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {68,68,68,68,68,68,68,0,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,0,0,68,68,68,68,68,
+     68,68,0,68,68,0,68,68,68,68,68,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,68,68,68,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,68,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     68,68,68,68,68,68,68,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,68,68,68,68,68,68,68,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,
+     16,16,0,0,0,0,0,0,0,0,0,0,0,0,16,16},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,
+     0,16,16,16,16,16,16,16,16,16,16,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16},
+    {16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,6,6,6,6,6,6,6,6,6,6,
+     6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6},
+    {0,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,
+     0,0,16,16,16,16,16,16,16,16,16,0,16,16,16,16},
+    {0,0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16},
+    {16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,68,68,68,68,68},
+    {16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,0,0},
+    {0,0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16},
+    {16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,16},
+    {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16},
+    {0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,
+     0,0,0,0,0,0,0,0,0,0,16,16,16,16,16,16,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0,0,0,0,0,0,0,0,16,16,16,16,16,16,16,16,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+     0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16},
+    {0,0,0,0,0,0,0,0,0,0,0,0,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,0,16,16,16,16},
+    {16,16,16,16,16,16,0,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+     16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16},
+    {3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68},
+    {3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3},
+    {68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+     3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3}
+  };
+
@@ -0,0 +1,196 @@
+/**
+ * libstring — String manipulation library
+ * 
+ * Copyright © 2015  Mattias Andrée (m@maandree.se)
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Tests that a string builder is left unmodified when an append
+ * fails, by running the same appends with an allocator that fails
+ * after a growing number of allocations, until none of them fails.
+ * 
+ * Run it with `make check`.
+ */
+#include "../src/libstring.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+
+/**
+ * The number of allocations the allocator
+ * may make before it fails.
+ */
+static size_t budget;
+
+
+/**
+ * Allocate memory, unless the budget is spent.
+ * 
+ * @param   size  The number of bytes to allocate.
+ * @param   data  Not used.
+ * @return        The allocated memory, `NULL` on error.
+ */
+static void* failing_allocate(size_t size, void* data)
+{
+  (void) data;
+  if (budget == 0)
+    return errno = ENOMEM, NULL;
+  budget--;
+  return malloc(size);
+}
+
+
+/**
+ * Change the size of an allocation, unless the budget is spent.
+ * 
+ * @param   ptr       The allocation.
+ * @param   old_size  Not used.
+ * @param   size      The new size of the allocation.
+ * @param   data      Not used.
+ * @return            The new allocation, `NULL` on error.
+ */
+static void* failing_reallocate(void* ptr, size_t old_size, size_t size, void* data)
+{
+  (void) old_size;
+  (void) data;
+  if (budget == 0)
+    return errno = ENOMEM, NULL;
+  budget--;
+  return realloc(ptr, size);
+}
+
+
+/**
+ * Deallocate memory.
+ * 
+ * @param  ptr   The allocation, may be `NULL`.
+ * @param  data  Not used.
+ */
+static void failing_deallocate(void* ptr, void* data)
+{
+  (void) data;
+  free(ptr);
+}
+
+
+/**
+ * Check the result of an append.
+ * 
+ * @param   what      Description of the append, for the error message.
+ * @param   r         The return value of the append.
+ * @param   builder   The builder.
+ * @param   expected  The expected string, if the append succeeded.
+ * @param   before    The length of the string before the append.
+ * @return            0 if the append succeeded, 1 if it failed
+ *                    correctly, -1 if the result is incorrect.
+ */
+static int check(const char* what, int r, const struct libstring_builder* builder,
+		 const char* expected, size_t before)
+{
+  size_t len = r ? before : strlen(expected);
+  
+  if (r && ((r != -1) || (errno != ENOMEM)))
+    {
+      fprintf(stderr, "%s: returned %i with errno %i\n", what, r, errno);
+      return -1;
+    }
+  if (builder->len != len)
+    {
+      fprintf(stderr, "%s: length is %zu, expected %zu\n", what, builder->len, len);
+      return -1;
+    }
+  if ((builder->cap == 0) ? (len != 0) : (memcmp(builder->ptr, expected, len) || builder->ptr[len]))
+    {
+      fprintf(stderr, "%s: string is incorrect\n", what);
+      return -1;
+    }
+  return r ? 1 : 0;
+}
+
+
+/**
+ * Run the appends with a given number of allocations.
+ * 
+ * @param   allocations  The number of allocations that succeed.
+ * @return               0 if all appends succeeded, 1 if one failed
+ *                       correctly, -1 if a result is incorrect.
+ */
+static int run(size_t allocations)
+{
+  static const char* const words[] = {"alpha", "beta", "gamma", NULL};
+  static char expected[1024], text[300], tail[200];
+  const char* const long_words[] = {text, tail, NULL};
+  struct libstring_builder builder;
+  size_t before;
+  int r, rc = 0;
+  
+  memset(text, 'x', sizeof(text) - 1);
+  memset(tail, 'y', sizeof(tail) - 1);
+  budget = allocations;
+  libstring_builder_initialise(&builder);
+  
+#define APPEND(WHAT, CALL, ...)\
+  do\
+    {\
+      before = builder.len;\
+      snprintf(expected + before, sizeof(expected) - before, __VA_ARGS__);\
+      r = (CALL);\
+      if ((rc = check(WHAT, r, &builder, expected, before)))\
+	goto done;\
+    }\
+  while (0)
+  
+  APPEND("append_join to an empty builder",
+	 libstring_builder_append_join(&builder, words, NULL, ", "), "alpha, beta, gamma");
+  APPEND("append", libstring_builder_append(&builder, "; "), "; ");
+  APPEND("append_format", libstring_builder_append_format(&builder, "%i-%s", 42, text), "42-%s", text);
+  APPEND("append_char", libstring_builder_append_char(&builder, '=', 3), "===");
+  APPEND("append_uint", libstring_builder_append_uint(&builder, 18446744073709551615ULL),
+	 "18446744073709551615");
+  APPEND("append_join", libstring_builder_append_join(&builder, long_words, NULL, "|"), "%s|%s", text, tail);
+  
+#undef APPEND
+  
+ done:
+  libstring_builder_destroy(&builder);
+  return rc;
+}
+
+
+int main(void)
+{
+  struct libstring_allocator allocator;
+  size_t allocations;
+  int r;
+  
+  allocator.allocate = failing_allocate;
+  allocator.reallocate = failing_reallocate;
+  allocator.deallocate = failing_deallocate;
+  allocator.data = NULL;
+  libstring_set_allocator(&allocator);
+  
+  for (allocations = 0; (r = run(allocations)) > 0; allocations++);
+  if (r < 0)
+    {
+      fprintf(stderr, "failed with %zu allocations\n", allocations);
+      return 1;
+    }
+  
+  libstring_set_allocator(NULL);
+  return 0;
+}
@@ -0,0 +1,152 @@
+/**
+ * libstring — String manipulation library
+ * 
+ * Copyright © 2015  Mattias Andrée (m@maandree.se)
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Tests the extended grapheme cluster boundaries against the
+ * cases in GraphemeBreakTest.txt from the Unicode Character
+ * Database, given as the only argument. The test is skipped
+ * if the file does not exist. `grapheme_break` is static, so
+ * the library is included rather than linked.
+ * 
+ * Run it with `make check UCD=path/to/UCD`.
+ */
+#include "../src/libstring.c"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+
+/**
+ * The maximum number of characters in a case.
+ */
+#define MAX_CHARS  64
+
+
+/**
+ * Parse the code points and boundaries of a case.
+ * 
+ * @param   line       The line, the comment is ignored.
+ * @param   cps        Output parameter for the code points.
+ * @param   boundary   Output parameter for whether there is a
+ *                     boundary before each code point.
+ * @param   n          Output parameter for the number of code points.
+ * @return             0 on success, -1 if the line is malformed.
+ */
+static int parse(char* line, uint32_t* cps, int* boundary, size_t* n)
+{
+  char* p = line;
+  char* end;
+  int before = -1;
+  
+  *n = 0;
+  if ((end = strchr(p, '#')))
+    *end = '\0';
+  for (;;)
+    {
+      p += strspn(p, " \t\r\n");
+      if (!*p)
+	break;
+      if (!strncmp(p, "\xC3\xB7", 2))      /* ÷ */
+	before = 1, p += 2;
+      else if (!strncmp(p, "\xC3\x97", 2)) /* × */
+	before = 0, p += 2;
+      else if ((before < 0) || (*n == MAX_CHARS))
+	return -1;
+      else
+	{
+	  cps[*n] = (uint32_t)strtoul(p, &end, 16);
+	  if ((end == p) || (cps[*n] > 0x10FFFF))
+	    return -1;
+	  boundary[(*n)++] = before;
+	  before = -1;
+	  p = end;
+	}
+    }
+  return 0;
+}
+
+
+int main(int argc, char* argv[])
+{
+  static char line[8192];
+  uint32_t cps[MAX_CHARS];
+  int boundary[MAX_CHARS];
+  struct grapheme_state state;
+  size_t i, n, lineno = 0, cases = 0, failures = 0;
+  FILE* f;
+  int c, r;
+  
+  if (argc != 2)
+    {
+      fprintf(stderr, "usage: %s GraphemeBreakTest.txt\n", *argv);
+      return 1;
+    }
+  if (!(f = fopen(argv[1], "r")))
+    {
+      r = (errno == ENOENT) ? 0 : 1;
+      fprintf(stderr, "%s: %s%s\n", argv[1], strerror(errno), r ? "" : ", skipping the grapheme cluster test");
+      return r;
+    }
+  
+  while (fgets(line, sizeof(line), f))
+    {
+      lineno++;
+      /* Only the comment can be cut off, drop the rest of it. */
+      if (!strchr(line, '\n'))
+	while (((c = getc(f)) != EOF) && (c != '\n'));
+      if (parse(line, cps, boundary, &n))
+	{
+	  fprintf(stderr, "%s:%zu: malformed line\n", argv[1], lineno);
+	  fclose(f);
+	  return 1;
+	}
+      if (n == 0)
+	continue;
+      cases++;
+  
+      state.prev = UNICODE_GRAPHEME_CONTROL;
+      state.pictographic = state.conjunct = state.odd_regional = 0;
+      for (i = 0; i < n; i++)
+	{
+	  r = grapheme_break(&state, unicode_grapheme_of(cps[i]));
+	  if ((i == 0) || (r == boundary[i]))
+	    continue;
+	  if (failures++ < 10)
+	    fprintf(stderr, "%s:%zu: expected %s before U+%04lX\n", argv[1], lineno,
+		    boundary[i] ? "a boundary" : "no boundary", (unsigned long)cps[i]);
+	  break;
+	}
+    }
+  
+  if (ferror(f))
+    {
+      fprintf(stderr, "%s: %s\n", argv[1], strerror(errno));
+      fclose(f);
+      return 1;
+    }
+  fclose(f);
+  
+  if (failures)
+    {
+      fprintf(stderr, "%zu of %zu cases failed\n", failures, cases);
+      return 1;
+    }
+  return 0;
+}
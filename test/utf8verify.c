@@ -0,0 +1,265 @@
+/**
+ * libstring — String manipulation library
+ * 
+ * Copyright © 2015  Mattias Andrée (m@maandree.se)
+ * 
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * Tests that the vectorised UTF-8 validators agree with the byte
+ * by byte validator, on random strings and on strings with
+ * sequences placed across, and truncated at, the edges of the
+ * 16 and 32 byte blocks. The validators are static, so the
+ * library is included rather than linked.
+ * 
+ * Run it with `make check`.
+ */
+#include "../src/libstring.c"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/**
+ * Sequences to build the tests strings from.
+ */
+static const struct
+{
+  /**
+   * The bytes of the sequence.
+   */
+  const char* bytes;
+  
+  /**
+   * The number of bytes in `bytes`.
+   */
+  size_t len;
+} pieces[] =
+  {
+    {"A", 1},
+    {"\xC3\xA9", 2},                 /* U+00E9 */
+    {"\xE2\x82\xAC", 3},             /* U+20AC */
+    {"\xEF\xBF\xBF", 3},             /* U+FFFF */
+    {"\xF0\x9F\x98\x80", 4},         /* U+1F600 */
+    {"\xF4\x8F\xBF\xBF", 4},         /* U+10FFFF */
+    {"\xED\x9F\xBF", 3},             /* U+D7FF */
+    {"\xED\xA0\x80", 3},             /* Surrogate */
+    {"\xED\xBF\xBF", 3},             /* Surrogate */
+    {"\xC0\x80", 2},                 /* Overlong, allowed in Modified UTF-8 */
+    {"\xC1\xBF", 2},                 /* Overlong */
+    {"\xE0\x80\x80", 3},             /* Overlong */
+    {"\xE0\x9F\xBF", 3},             /* Overlong */
+    {"\xF0\x80\x80\x80", 4},         /* Overlong */
+    {"\xF0\x8F\xBF\xBF", 4},         /* Overlong */
+    {"\xF4\x90\x80\x80", 4},         /* Too large */
+    {"\xF8\x88\x80\x80\x80", 5},     /* Too long */
+    {"\x80", 1},                     /* Stray continuation byte */
+    {"\xFF", 1},
+  };
+
+
+/**
+ * The number of elements in `pieces`.
+ */
+#define PIECES  (sizeof(pieces) / sizeof(*pieces))
+
+
+/**
+ * The number of failed checks.
+ */
+static size_t failures = 0;
+
+
+/**
+ * The state of the random number generator.
+ */
+static uint64_t seed = UINT64_C(88172645463325252);
+
+
+/**
+ * Generate a pseudo-random number.
+ * 
+ * @return  The next number.
+ */
+static unsigned next_random(void)
+{
+  seed ^= seed << 13;
+  seed ^= seed >> 7;
+  seed ^= seed << 17;
+  return (unsigned)(seed >> 32);
+}
+
+
+/**
+ * Report a disagreement between two validators.
+ * 
+ * @param  what      The validator that disagreed with the scalar one.
+ * @param  s         The string.
+ * @param  n         The length of `s`.
+ * @param  r         The return value of the validator.
+ * @param  expected  The return value of the scalar validator.
+ */
+static void fail(const char* what, const unsigned char* s, size_t n, int r, int expected)
+{
+  size_t i;
+  if (failures++ >= 10)
+    return;
+  fprintf(stderr, "%s: returned %i, expected %i, for", what, r, expected);
+  for (i = 0; i < n; i++)
+    fprintf(stderr, " %02X", s[i]);
+  fprintf(stderr, "\n");
+}
+
+
+/**
+ * Run every validator on a string and compare
+ * the results with the scalar validator.
+ * 
+ * @param  s  The string, NUL-terminated.
+ * @param  n  The length of `s`.
+ */
+static void check(const unsigned char* s, size_t n)
+{
+  int expected, r;
+  
+  expected = utf8verify_scalar(s, n, 0);
+#if defined(HAVE_X86_SIMD)
+  if (__builtin_cpu_supports("ssse3") && ((r = utf8verify_ssse3(s, n)) != expected))
+    fail("utf8verify_ssse3", s, n, r, expected);
+  if (__builtin_cpu_supports("avx2") && ((r = utf8verify_avx2(s, n)) != expected))
+    fail("utf8verify_avx2", s, n, r, expected);
+#endif
+  if ((r = libstring_utf8verify_n((const char*)s, n, 0)) != expected)
+    fail("libstring_utf8verify_n", s, n, r, expected);
+  if ((r = libstring_utf8verify((const char*)s, 0)) != expected)
+    fail("libstring_utf8verify", s, n, r, expected);
+  
+  /* Modified UTF-8 tries the vectorised validator first
+   * and falls back to the scalar one if it rejects. */
+  expected = utf8verify_scalar(s, n, LIBSTRING_UTF8VERIFY_MOD_UTF8);
+  if ((r = libstring_utf8verify_n((const char*)s, n, LIBSTRING_UTF8VERIFY_MOD_UTF8)) != expected)
+    fail("libstring_utf8verify_n with LIBSTRING_UTF8VERIFY_MOD_UTF8", s, n, r, expected);
+}
+
+
+/**
+ * Place every prefix of every sequence at, and around, the
+ * edges of the blocks, both at the end of the string and
+ * followed by ASCII, and with ASCII or a multibyte character
+ * before it.
+ * 
+ * @param  buf  Buffer of at least 140 bytes.
+ */
+static void check_block_edges(unsigned char* buf)
+{
+  static const size_t edges[] = {16, 32, 48, 64};
+  size_t e, p, len, at, tail, n;
+  
+  for (e = 0; e < sizeof(edges) / sizeof(*edges); e++)
+    for (p = 0; p < PIECES; p++)
+      for (len = 1; len <= pieces[p].len; len++)
+	for (at = edges[e] - len - 1; at <= edges[e] + 1; at++)
+	  for (tail = 0; tail <= 2 * 32; tail += 32)
+	    {
+	      memset(buf, 'a', at);
+	      if (at >= 4)
+		memcpy(buf + at - 4, "\xF0\x9F\x98\x80", 4);
+	      memcpy(buf + at, pieces[p].bytes, len);
+	      n = at + len;
+	      memset(buf + n, 'b', tail);
+	      n += tail;
+	      buf[n] = '\0';
+	      check(buf, n);
+	      if (at >= 4)
+		{
+		  memset(buf + at - 4, 'a', 4);
+		  check(buf, n);
+		}
+	    }
+}
+
+
+/**
+ * Check random strings built from `pieces` and random bytes.
+ * 
+ * @param  buf  Buffer of at least 200 bytes.
+ */
+static void check_random(unsigned char* buf)
+{
+  size_t i, j, k, n, p;
+  
+  for (i = 0; i < 200000; i++)
+    {
+      n = 0;
+      k = next_random() % 80;
+      for (j = 0; (j < k) && (n < 180); j++)
+	{
+	  if (next_random() % 3 == 0)
+	    {
+	      buf[n] = (unsigned char)(next_random() % 255 + 1);
+	      n++;
+	      continue;
+	    }
+	  /* Mostly valid sequences, so that the errors are sparse. */
+	  p = next_random() % PIECES;
+	  if (next_random() % 6)
+	    p = next_random() % 6;
+	  memcpy(buf + n, pieces[p].bytes, pieces[p].len);
+	  n += pieces[p].len;
+	}
+      buf[n] = '\0';
+      check(buf, n);
+    }
+}
+
+
+int main(void)
+{
+  static const struct { const char* s; enum libstring_utf8verify flags; int expected; } cases[] =
+    {
+      {"", 0, 0},
+      {"\xC0\x80", 0, -1},
+      {"\xC0\x80", LIBSTRING_UTF8VERIFY_MOD_UTF8, 0},
+      {"abcdefghijklmnopqrstuvwxyz0123456789\xC0\x80", LIBSTRING_UTF8VERIFY_MOD_UTF8, 0},
+      {"abcdefghijklmnopqrstuvwxyz0123456789\xC0\x80\xED\xA0\x80", LIBSTRING_UTF8VERIFY_MOD_UTF8, -1},
+      {"\xC1\x81", LIBSTRING_UTF8VERIFY_MOD_UTF8, -1},
+      {"\xED\xA0\x80", 0, -1},
+      {"\xF4\x8F\xBF\xBF", 0, 0},
+      {"\xF4\x90\x80\x80", 0, -1},
+      {"\xE0\x80\x80", 0, -1},
+      {"\xF0\x80\x80\x80", 0, -1},
+      {"abc\xE2\x82", 0, -1},
+    };
+  static unsigned char buf[256];
+  size_t i;
+  int r;
+  
+  for (i = 0; i < sizeof(cases) / sizeof(*cases); i++)
+    if ((r = libstring_utf8verify(cases[i].s, cases[i].flags)) != cases[i].expected)
+      {
+	fprintf(stderr, "case %zu: returned %i, expected %i\n", i, r, cases[i].expected);
+	failures++;
+      }
+  
+  check_block_edges(buf);
+  check_random(buf);
+  
+  if (failures)
+    {
+      fprintf(stderr, "%zu failures\n", failures);
+      return 1;
+    }
+  return 0;
+}